@@ -11,6 +11,7 @@
 #include "BehaviourManager.h"
 #include "BehaviorStatusExtensions.h"
 #include "../NodeAttributeModifier.h"
+#include "../SceneStateBuffer.h"
 #include <Util/Macros.h>
 #include <Util/ObjectExtension.h>
 
@@ -112,6 +113,11 @@ void BehaviourManager::executeBehaviours(AbstractBehaviour::timestamp_t timeSec,
 	executeBehaviors(timeSec);
 }
 
+void BehaviourManager::executeBehavioursBuffered(Behavior::timestamp_t timeSec, SceneStateBuffer & buffer){
+	SceneStateBuffer::UpdateScope update(buffer);
+	executeBehaviours(timeSec);
+}
+
 BehaviourManager::nodeBehaviourList_t BehaviourManager::getBehavioursByNode(Node * node)const{
 	nodeBehaviourList_t behaviours;
 	for(auto it=registeredNodeBehaviours.find(node);
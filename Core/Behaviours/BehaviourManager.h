@@ -18,6 +18,7 @@
 #include <vector>
 
 namespace MinSG{
+class SceneStateBuffer;
 
 /**
  * BehaviourManager
@@ -49,6 +50,11 @@ class BehaviourManager : public Util::ReferenceCounter<BehaviourManager> {
 		void clearBehaviours();
 		void executeBehaviours(Behavior::timestamp_t timeSec);
 		void executeBehaviours(Behavior::timestamp_t timeSec,behaviourList_t & finishedBehaviours);
+		/*!	Execute the behaviours as one simulation step of the given buffer (\see SceneStateBuffer::UpdateScope).
+			Behaviours writing through SceneStateBuffer::writeRelTransformation() do not modify the nodes;
+			their changes are applied by SceneStateBuffer::swap() in FrameContext::beginFrame().
+			\note May be called on a worker thread if all executed behaviours only write through the buffer.	*/
+		void executeBehavioursBuffered(Behavior::timestamp_t timeSec, SceneStateBuffer & buffer);
 
 		nodeBehaviourList_t getBehavioursByNode(Node * node)const;
 		stateBehaviourList_t getBehavioursByState(State * state)const;
@@ -12,6 +12,8 @@
 
 #include "Nodes/Node.h"
 #include "Nodes/AbstractCameraNode.h"
+#include "RenderQueue.h"
+#include "SceneStateBuffer.h"
 #include "Statistics.h"
 #include "../Helper/TextAnnotation.h"
 
@@ -42,7 +44,9 @@ namespace MinSG {
 FrameContext::FrameContext() : Util::ReferenceCounter<FrameContext>(),
 		worldUpVector(0,1,0), worldFrontVector(0,0,1), worldRightVector(1,0,0),
 		frameNumber(0),
+		sceneStateBuffer(),
 		renderingContext(new Rendering::RenderingContext),
+		renderQueue(new RenderQueue),
 		statistics(new Statistics) {
 
 	registerNodeRenderer(	DEFAULT_CHANNEL,
@@ -141,8 +145,19 @@ Geometry::Rect FrameContext::getProjectedRect(Node * node, const Geometry::Rect
 // -----------------------------------
 // --- Frame handling
 
+SceneStateBuffer & FrameContext::getSceneStateBuffer() {
+	// Created on first use, because the destructor of every node has to inform the existing buffers.
+	if(!sceneStateBuffer)
+		sceneStateBuffer.reset(new SceneStateBuffer);
+	return *sceneStateBuffer;
+}
+
 void FrameContext::beginFrame(int _frameNumber/*=-1*/){
 	
+	if(sceneStateBuffer)
+		sceneStateBuffer->swap();
+	Node::processPendingTransformations();
+
 	if(_frameNumber<0){
 		_frameNumber=this->frameNumber++;
 	}
@@ -204,6 +219,20 @@ bool FrameContext::displayNode(Node * node, const RenderParam & rp) {
 	return false;
 }
 
+bool FrameContext::displayNodeWithRenderQueue(Node * node, const RenderParam & rp) {
+	renderQueue->clear();
+	const bool handled = displayNode(node, rp + RENDER_QUEUE);
+	renderQueue->sort();
+	try {
+		renderQueue->submit(*this, rp - RENDER_QUEUE);
+	} catch(...) {
+		renderQueue->clear();
+		throw;
+	}
+	renderQueue->clear();
+	return handled;
+}
+
 FrameContext::node_renderer_registration_t FrameContext::registerNodeRenderer(const Util::StringIdentifier & channelName, NodeRenderer renderer) {
 	return renderingChannels[channelName].registerElement(std::move(renderer));
 }
@@ -47,6 +47,8 @@ class Color4f;
 namespace MinSG {
 class Node;
 class AbstractCameraNode;
+class RenderQueue;
+class SceneStateBuffer;
 class Statistics;
 class State;
 
@@ -145,7 +147,9 @@ class FrameContext : public Util::ReferenceCounter<FrameContext>{
 	private:
 		int frameNumber; // <- only used for statistics
 	public:
-		/*!	- Initializes rendering statistics (Statistics & FrameStats).
+		/*!	- Apply the states of the completed simulation steps of the scene state buffer (\see SceneStateBuffer::swap()).
+			- Resolve the pending transformations of the scene graph (\see Node::processPendingTransformations()).
+			- Initializes rendering statistics (Statistics & FrameStats).
 			- Inform Rendering::MeshDataStrategy about the start of a new frame.
 			- Inform the frameListeners about the start of a new frame by calling onBeginFrame().
 			@param frameNumber If <0 the internal frameNumber is taken and increased; used for statistics	*/
@@ -173,9 +177,14 @@ class FrameContext : public Util::ReferenceCounter<FrameContext>{
 		 @ param listener New event listener	*/                             
 		 void addEndFrameListener(const FrameListenerFunction & listener);
 
+		/*!	Buffer for the states of the nodes written by a simulation running on another thread.
+			It is created on the first call and swapped in beginFrame(). \see SceneStateBuffer	*/
+		SceneStateBuffer & getSceneStateBuffer();
+
 	private:
 		std::vector<FrameListenerFunction> beginFrameListenerCallbacks;
 		std::vector<FrameListenerFunction> endFrameListenerCallbacks;
+		std::unique_ptr<SceneStateBuffer> sceneStateBuffer;
 	//	@}
 
 	// -----------------------------------
@@ -195,6 +204,13 @@ class FrameContext : public Util::ReferenceCounter<FrameContext>{
 			@return true if the node could be handled by a renderer. */
 		bool displayNode(Node * node, const RenderParam & rp);
 
+		/*! Record the node into the render queue (using the flag RENDER_QUEUE), sort the queue and render it.
+			Consecutive draw items only change the states in which they differ.
+			@return true if the node could be handled by a renderer. \see RenderQueue */
+		bool displayNodeWithRenderQueue(Node * node, const RenderParam & rp);
+
+		RenderQueue & getRenderQueue()									{	return *renderQueue;	}
+
 		node_renderer_registration_t registerNodeRenderer(const Util::StringIdentifier & channelName, NodeRenderer renderer);
 		void unregisterNodeRenderer(const Util::StringIdentifier & channelName, node_renderer_registration_t handle);
 
@@ -215,6 +231,7 @@ class FrameContext : public Util::ReferenceCounter<FrameContext>{
 	private:
 		std::unique_ptr<Rendering::RenderingContext> renderingContext;
 		channelMap_t renderingChannels;
+		std::unique_ptr<RenderQueue> renderQueue;
 	//	@}
 
 	// -----------------------------------
@@ -0,0 +1,166 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "NodeMemoryPool.h"
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <iterator>
+#include <new>
+#include <vector>
+
+namespace MinSG {
+namespace NodeMemoryPool {
+
+/**
+ * Header in front of every block. It stores the size class (or HEAP_BLOCK) and the size of the block.
+ * The header is aligned like std::max_align_t, so the object behind it has the same alignment as
+ * memory returned by the global operator new.
+ */
+struct alignas(alignof(std::max_align_t)) Header {
+	std::size_t sizeClass;
+	std::size_t blockSize;
+};
+static const std::size_t HEAP_BLOCK = ~static_cast<std::size_t>(0);
+static const std::size_t HEADER_SIZE = sizeof(Header);
+
+static const std::size_t SIZE_CLASS_GRANULARITY = 16;
+static const std::size_t NUM_SIZE_CLASSES = 32; // blocks up to 512 bytes
+static const std::size_t CHUNK_SIZE = 64 * 1024;
+static_assert(SIZE_CLASS_GRANULARITY % alignof(std::max_align_t) == 0, "Blocks have to keep the alignment of their headers.");
+
+//! Number of calls of the global operator new made by this module.
+static std::atomic<std::size_t> heapAllocations(0);
+
+/**
+ * Pool of blocks of equal size. Free blocks are linked by storing the
+ * pointer to the next free block inside of the block.
+ */
+struct Pool {
+	std::mutex mutex;
+	std::size_t blockSize;
+	std::vector<char *> chunks;
+	void * freeList;
+	char * chunkCursor; // next unused block in the last chunk
+	char * chunkEnd;
+	std::size_t usedBlocks;
+
+	Pool() : blockSize(0), freeList(nullptr), chunkCursor(nullptr), chunkEnd(nullptr), usedBlocks(0) {}
+
+	void * allocateBlock() {
+		++usedBlocks;
+		if(freeList != nullptr) {
+			void * block = freeList;
+			freeList = *reinterpret_cast<void **>(block);
+			return block;
+		}
+		if(chunkCursor + blockSize > chunkEnd) {
+			++heapAllocations;
+			chunkCursor = static_cast<char *>(::operator new(CHUNK_SIZE));
+			chunkEnd = chunkCursor + CHUNK_SIZE;
+			chunks.push_back(chunkCursor);
+		}
+		void * block = chunkCursor;
+		chunkCursor += blockSize;
+		return block;
+	}
+
+	void freeBlock(void * block) {
+		*reinterpret_cast<void **>(block) = freeList;
+		freeList = block;
+		if(--usedBlocks == 0 && chunks.size() > 1) { // release the memory when the pool is empty, but keep one chunk
+			for(auto it = std::next(chunks.begin()); it != chunks.end(); ++it)
+				::operator delete(*it);
+			chunks.resize(1);
+			freeList = nullptr;
+			chunkCursor = chunks.front();
+			chunkEnd = chunkCursor + CHUNK_SIZE;
+		}
+	}
+};
+
+//! The pools are never destroyed, because nodes may be deleted during the destruction of static objects.
+static Pool * createPools() {
+	Pool * pools = new Pool[NUM_SIZE_CLASSES];
+	for(std::size_t i = 0; i < NUM_SIZE_CLASSES; ++i)
+		pools[i].blockSize = (i + 1) * SIZE_CLASS_GRANULARITY;
+	return pools;
+}
+
+static Pool * getPools() {
+	static Pool * pools = createPools();
+	return pools;
+}
+
+static std::atomic<int> activeScopes(0);
+
+void * allocate(std::size_t size) {
+	const std::size_t blockSize = size + HEADER_SIZE;
+	const std::size_t sizeClass = (blockSize + SIZE_CLASS_GRANULARITY - 1) / SIZE_CLASS_GRANULARITY - 1;
+	Header * header;
+	if(activeScopes.load(std::memory_order_relaxed) > 0 && sizeClass < NUM_SIZE_CLASSES) {
+		Pool & pool = getPools()[sizeClass];
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		header = static_cast<Header *>(pool.allocateBlock());
+		header->sizeClass = sizeClass;
+		header->blockSize = pool.blockSize;
+	} else {
+		++heapAllocations;
+		header = static_cast<Header *>(::operator new(blockSize));
+		header->sizeClass = HEAP_BLOCK;
+		header->blockSize = blockSize;
+	}
+	return header + 1;
+}
+
+void deallocate(void * ptr) {
+	if(ptr == nullptr)
+		return;
+	Header * header = static_cast<Header *>(ptr) - 1;
+	if(header->sizeClass == HEAP_BLOCK) {
+		::operator delete(header);
+	} else {
+		Pool & pool = getPools()[header->sizeClass];
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		pool.freeBlock(header);
+	}
+}
+
+std::size_t getAllocatedSize(const void * ptr) {
+	return ptr == nullptr ? 0 : (static_cast<const Header *>(ptr) - 1)->blockSize;
+}
+
+Scope::Scope(bool _active) : active(_active) {
+	if(active)
+		++activeScopes;
+}
+
+Scope::~Scope() {
+	if(active)
+		--activeScopes;
+}
+
+bool isEnabled() {
+	return activeScopes > 0;
+}
+
+Statistics getStatistics() {
+	Statistics stats = {0, 0, 0, 0, heapAllocations.load()};
+	Pool * pools = getPools();
+	for(std::size_t i = 0; i < NUM_SIZE_CLASSES; ++i) {
+		std::lock_guard<std::mutex> lock(pools[i].mutex);
+		stats.reservedBytes += pools[i].chunks.size() * CHUNK_SIZE;
+		stats.usedBytes += pools[i].usedBlocks * pools[i].blockSize;
+		stats.usedBlocks += pools[i].usedBlocks;
+		stats.chunkCount += pools[i].chunks.size();
+	}
+	return stats;
+}
+
+}
+}
@@ -0,0 +1,81 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_CORE_NODEMEMORYPOOL_H
+#define MINSG_CORE_NODEMEMORYPOOL_H
+
+#include <cstddef>
+
+namespace MinSG {
+
+/**
+ * Pooled allocation of nodes and their side structures (GeometryNode, ListNode,
+ * the relative transformation and the world location of a Node).
+ *
+ * While at least one NodeMemoryPool::Scope is active, these objects are allocated
+ * from large chunks divided into blocks of equal size (one pool per size class)
+ * instead of being allocated individually from the heap. Each block is preceded by
+ * a small header that identifies its pool, so objects can be deleted at any time,
+ * even if no scope is active anymore. When the last block of a pool is freed, all
+ * chunks of the pool except one are released.
+ *
+ * The pools are used during an import with IMPORT_OPTION_USE_NODE_MEMORY_POOLS
+ * (\see SceneManagement::SceneManager::setNodeMemoryPoolsEnabled).
+ * @ingroup helper
+ */
+namespace NodeMemoryPool {
+
+//! Allocate @p size bytes; taken from a pool if a Scope is active and the size is not too large.
+void * allocate(std::size_t size);
+
+//! Free memory that has been allocated with allocate().
+void deallocate(void * ptr);
+
+/**
+ * Return the number of bytes occupied by memory that has been allocated with allocate().
+ * This includes the header and, for pooled memory, the rounding to the size class.
+ */
+std::size_t getAllocatedSize(const void * ptr);
+
+/**
+ * While an instance exists, node allocations are taken from the pools.
+ * Scopes may be nested.
+ */
+class Scope {
+		bool active;
+	public:
+		explicit Scope(bool _active = true);
+		~Scope();
+		Scope(const Scope &) = delete;
+		Scope & operator=(const Scope &) = delete;
+};
+
+//! @return @c true iff at least one Scope is active.
+bool isEnabled();
+
+struct Statistics {
+	//! Number of bytes reserved by the chunks of all pools.
+	std::size_t reservedBytes;
+	//! Number of bytes of all blocks currently in use (including the headers).
+	std::size_t usedBytes;
+	//! Number of blocks currently in use.
+	std::size_t usedBlocks;
+	//! Number of chunks of all pools.
+	std::size_t chunkCount;
+	//! Number of calls of the global operator new made by allocate() (chunks and objects not taken from a pool).
+	std::size_t heapAllocations;
+};
+
+//! Return the current occupancy of all pools.
+Statistics getStatistics();
+
+}
+
+}
+
+#endif // MINSG_CORE_NODEMEMORYPOOL_H
@@ -12,10 +12,12 @@
 
 #include "GroupNode.h"
 #include "../FrameContext.h"
+#include "../RenderQueue.h"
 #include "../Statistics.h"
 
 #include <Rendering/Mesh/Mesh.h>
 #include <Rendering/Draw.h>
+#include <Rendering/RenderingContext/RenderingContext.h>
 #include <Util/Graphics/ColorLibrary.h>
 
 namespace MinSG {
@@ -55,7 +57,13 @@ void GeometryNode::doDisplay(FrameContext & context,const RenderParam & rp) {
 	}
 	if (!mesh.isNull() && !(rp.getFlag(NO_GEOMETRY))) {
 		context.getStatistics().countNode(this);
-		context.displayMesh(mesh.get());
+		if(rp.getFlag(RENDER_QUEUE)) {
+			const Geometry::Matrix4x4 modelToCamera = context.getRenderingContext().getMatrix_modelToCamera();
+			const Geometry::Vec3 cameraPos = modelToCamera.transformPosition(getBB().getCenter());
+			context.getRenderQueue().addItem(mesh.get(), modelToCamera, this, -cameraPos.z());
+		} else {
+			context.displayMesh(mesh.get());
+		}
 	}
 }
 
@@ -35,6 +35,12 @@ class GeometryNode : public Node {
 		GeometryNode(const Util::Reference<Rendering::Mesh> & _mesh);
 		virtual ~GeometryNode();
 
+		//! Allocation from the node memory pools. \see NodeMemoryPool
+		static void * operator new(std::size_t size)	{	return NodeMemoryPool::allocate(size);	}
+		static void operator delete(void * ptr)			{	NodeMemoryPool::deallocate(ptr);	}
+		static void * operator new(std::size_t, void * place)	{	return place;	}
+		static void operator delete(void *, void *)		{	}
+
 		void setMesh(const Util::Reference<Rendering::Mesh> & newMesh);
 		Rendering::Mesh * getMesh()const                {   return mesh.get();  }
 		bool hasMesh()const                				{   return mesh.isNotNull();  }
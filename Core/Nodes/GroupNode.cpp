@@ -10,6 +10,7 @@
 */
 #include "GroupNode.h"
 #include "../../Helper/StdNodeVisitors.h"
+#include <unordered_set>
 
 namespace MinSG {
 
@@ -20,6 +21,7 @@ GroupNode::GroupNode():Node() {
 
 void GroupNode::addChild(Util::Reference<Node> child){
 	if(child.isNotNull()){
+		validateChild(child.get());
 		child->removeFromParent();
 		doAddChild(child);
 		invalidateCompoundBB();
@@ -38,11 +40,68 @@ bool GroupNode::removeChild(Util::Reference<Node> child){
 	return false;
 }
 
-void GroupNode::clearChildren(){
-	for(auto & child : MinSG::getChildNodes(this)){
-		const Util::Reference<Node> childHolder( child );
-		this->removeChild(childHolder);
+void GroupNode::addChildren(const std::vector<Util::Reference<Node>> & newChildren){
+	std::vector<Util::Reference<Node>> uniqueChildren;
+	uniqueChildren.reserve(newChildren.size());
+	std::unordered_set<Node *> contained;
+	for(const auto & child : newChildren){
+		if(child.isNotNull() && contained.insert(child.get()).second){
+			validateChild(child.get());
+			uniqueChildren.push_back(child);
+		}
+	}
+	if(uniqueChildren.empty())
+		return;
+	// detach the children only after all of them have been accepted
+	for(const auto & child : uniqueChildren)
+		child->removeFromParent();
+	doAddChildren(uniqueChildren);
+	invalidateCompoundBB();
+	worldBBChanged();
+	if(getStatus(STATUS_TREE_OBSERVED)){
+		std::vector<Node *> addedNodes;
+		addedNodes.reserve(uniqueChildren.size());
+		for(const auto & child : uniqueChildren)
+			addedNodes.push_back(child.get());
+		Node::informNodesAddedObservers(addedNodes);
+	}
+}
+
+size_t GroupNode::removeChildren(const std::vector<Util::Reference<Node>> & childrenToRemove){
+	std::vector<Util::Reference<Node>> uniqueChildren;
+	uniqueChildren.reserve(childrenToRemove.size());
+	std::unordered_set<Node *> contained;
+	for(const auto & child : childrenToRemove){
+		if(child.isNotNull() && contained.insert(child.get()).second)
+			uniqueChildren.push_back(child);
+	}
+	std::vector<Node *> removedNodes;
+	if(!uniqueChildren.empty())
+		doRemoveChildren(uniqueChildren, removedNodes);
+	if(!removedNodes.empty()){
+		invalidateCompoundBB();
+		worldBBChanged();
+		Node::informNodesRemovedObservers(this, removedNodes);
 	}
+	return removedNodes.size();
+}
+
+void GroupNode::doAddChildren(const std::vector<Util::Reference<Node>> & newChildren){
+	for(const auto & child : newChildren)
+		doAddChild(child);
+}
+
+void GroupNode::doRemoveChildren(const std::vector<Util::Reference<Node>> & childrenToRemove,
+								std::vector<Node *> & removedChildren){
+	for(const auto & child : childrenToRemove){
+		if(doRemoveChild(child))
+			removedChildren.push_back(child.get());
+	}
+}
+
+void GroupNode::clearChildren(){
+	const auto childNodes = MinSG::getChildNodes(this);
+	removeChildren(childNodes.begin(), childNodes.end());
 }
 
 }
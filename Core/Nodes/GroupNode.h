@@ -12,6 +12,7 @@
 #define SG_GROUPNODE_H
 
 #include "Node.h"
+#include <vector>
 
 namespace MinSG {
 
@@ -44,6 +45,28 @@ class GroupNode : public Node {
 		/*!	Try to remove a child from this node.
 			@return @c true if @a child was removed.	*/
 		bool removeChild(Util::Reference<Node> child);
+
+		/*!	Add several children to this node and update their parents.
+			In contrast to calling addChild(...) for each child, the bounding boxes are invalidated only once
+			and the observers are informed only once (nodesAdded observers receive the whole list).
+			Null references and duplicates are ignored.
+			- May throw an exception on failure	*/
+		void addChildren(const std::vector<Util::Reference<Node>> & newChildren);
+
+		template<typename Iterator_t>
+		void addChildren(Iterator_t begin, Iterator_t end) {
+			addChildren(std::vector<Util::Reference<Node>>(begin, end));
+		}
+
+		/*!	Try to remove several children from this node.
+			The bounding boxes are invalidated only once and the observers are informed only once.
+			@return The number of removed children.	*/
+		size_t removeChildren(const std::vector<Util::Reference<Node>> & childrenToRemove);
+
+		template<typename Iterator_t>
+		size_t removeChildren(Iterator_t begin, Iterator_t end) {
+			return removeChildren(std::vector<Util::Reference<Node>>(begin, end));
+		}
 		
 		/*! (internal) Remove the given child from this node.
 			- called by removeChild(...).
@@ -70,6 +93,29 @@ class GroupNode : public Node {
 		//! Removes all children from the Node
 		void clearChildren();
 
+	protected:
+		/*! (internal) Check if the given child can be added to this node.
+			- called by addChild(...) and addChildren(...) before any child is removed from its old parent.
+			- Has to throw an exception (of base type std::exception) if the child can not be added.
+			- The default implementation accepts all nodes.
+			---o	*/
+		virtual void validateChild(Node * /*child*/) const	{}
+
+		/*! (internal) Add the given children to this node.
+			- called by addChildren(...).
+			- The given @p newChildren are not null, unique, have passed validateChild(...) and have been removed from their old parents.
+			- The default implementation calls doAddChild(...) for each child.
+			---o	*/
+		virtual void doAddChildren(const std::vector<Util::Reference<Node>> & newChildren);
+
+		/*! (internal) Remove the given children from this node.
+			- called by removeChildren(...).
+			- Has to set the parent of each removed child to null and append it to @p removedChildren.
+			- The default implementation calls doRemoveChild(...) for each child.
+			---o	*/
+		virtual void doRemoveChildren(const std::vector<Util::Reference<Node>> & childrenToRemove,
+									std::vector<Node *> & removedChildren);
+
 	private:
 		/*! (internal) Add the given child to this node.
 			- called by addChild(...).                            *
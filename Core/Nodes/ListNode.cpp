@@ -11,11 +11,14 @@
 #include "ListNode.h"
 #include "../FrameContext.h"
 #include "AbstractCameraNode.h"
+#include "../../Helper/FrustumBatchTest.h"
 #include <Geometry/BoxHelper.h>
 #include <Rendering/Draw.h>
 #include <Util/Graphics/ColorLibrary.h>
 #include <Util/Macros.h>
+#include <algorithm>
 #include <iterator>
+#include <unordered_set>
 
 namespace MinSG {
 
@@ -56,6 +59,33 @@ bool ListNode::doRemoveChild(Util::Reference<Node> childToRemove) {
 	return false;
 }
 
+//! ---|> GroupNode
+void ListNode::doRemoveChildren(const std::vector<Util::Reference<Node>> & childrenToRemove,
+								std::vector<Node *> & removedChildren) {
+	std::unordered_set<Node *> candidates;
+	for(const auto & child : childrenToRemove) {
+		if(child->getParent() == this)
+			candidates.insert(child.get());
+	}
+	if(candidates.empty())
+		return;
+	const size_t oldSize = removedChildren.size();
+	// the references in childrenToRemove keep the removed children alive
+	const auto newEnd = std::remove_if(children.begin(), children.end(),
+										[&candidates, &removedChildren](const Node::ref_t & child) {
+											if(candidates.count(child.get()) == 0)
+												return false;
+											removedChildren.push_back(child.get());
+											return true;
+										});
+	children.erase(newEnd, children.end());
+	for(size_t i = oldSize; i < removedChildren.size(); ++i)
+		removedChildren[i]->_setParent(nullptr);
+}
+
+//! Minimum number of children for which the batch frustum test is used (\see classifyBoxes()).
+static const size_t BATCH_CULLING_MIN_CHILDREN = 16;
+
 //! ---|> [Node]
 void ListNode::doDisplay(FrameContext & context, const RenderParam & rp) {
 	if (rp.getFlag(BOUNDING_BOXES)) {
@@ -65,7 +95,30 @@ void ListNode::doDisplay(FrameContext & context, const RenderParam & rp) {
 		Rendering::drawWireframeBox(context.getRenderingContext(), getBB(), Util::ColorLibrary::WHITE);
 	}
 
-	if (rp.getFlag(FRUSTUM_CULLING)) {
+	if (rp.getFlag(FRUSTUM_CULLING) && children.size() >= BATCH_CULLING_MIN_CHILDREN) {
+		// classify the boxes of the children in chunks with the batch kernel
+		static const size_t CHUNK_SIZE = 64;
+		float minX[CHUNK_SIZE], minY[CHUNK_SIZE], minZ[CHUNK_SIZE], maxX[CHUNK_SIZE], maxY[CHUNK_SIZE], maxZ[CHUNK_SIZE];
+		uint8_t results[CHUNK_SIZE];
+		const BoxArrays boxes = {minX, minY, minZ, maxX, maxY, maxZ};
+		const FrustumPlanes planes = FrustumPlanes::fromFrustum(context.getCamera()->getFrustum());
+		for(size_t first = 0; first < children.size(); first += CHUNK_SIZE) {
+			const size_t count = std::min(CHUNK_SIZE, children.size() - first);
+			for(size_t i = 0; i < count; ++i) {
+				const Geometry::Box & box = children[first + i]->getWorldBB();
+				minX[i] = box.getMinX();	minY[i] = box.getMinY();	minZ[i] = box.getMinZ();
+				maxX[i] = box.getMaxX();	maxY[i] = box.getMaxY();	maxZ[i] = box.getMaxZ();
+			}
+			classifyBoxes(planes, boxes, count, results);
+			for(size_t i = 0; i < count && first + i < children.size(); ++i) {
+				if (results[i] == BOX_INSIDE) {
+					context.displayNode(children[first + i].get(), rp - FRUSTUM_CULLING);
+				} else if (results[i] == BOX_INTERSECT) {
+					context.displayNode(children[first + i].get(), rp);
+				}
+			}
+		}
+	} else if (rp.getFlag(FRUSTUM_CULLING)) {
 		for(const auto & child : children) {
 			const auto t = context.getCamera()->testBoxFrustumIntersection(child->getWorldBB());
 
@@ -28,6 +28,12 @@ class ListNode : public GroupNode {
 		ListNode(ListNode && source);
 		virtual ~ListNode();
 
+		//! Allocation from the node memory pools. \see NodeMemoryPool
+		static void * operator new(std::size_t size)	{	return NodeMemoryPool::allocate(size);	}
+		static void operator delete(void * ptr)			{	NodeMemoryPool::deallocate(ptr);	}
+		static void * operator new(std::size_t, void * place)	{	return place;	}
+		static void operator delete(void *, void *)		{	}
+
 		Node * getChild(size_t index) const {
 			return (index < children.size()) ? children[index].get() : nullptr;
 		}
@@ -51,6 +57,9 @@ class ListNode : public GroupNode {
 	protected:
 		void doAddChild(Util::Reference<Node> child)override;
 		bool doRemoveChild(Util::Reference<Node> child)override;
+		//! Removes all children in a single pass over the child list.
+		void doRemoveChildren(const std::vector<Util::Reference<Node>> & childrenToRemove,
+								std::vector<Node *> & removedChildren)override;
 
 		void _pushChild(Util::Reference<Node> child)	{	children.push_back(child);	}
 		explicit ListNode(const ListNode & source);
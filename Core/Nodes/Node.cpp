@@ -13,7 +13,10 @@
 #include "../Transformations.h"
 #include "../FrameContext.h"
 #include "../NodeAttributeModifier.h"
+#include "../RenderQueue.h"
+#include "../SceneStateBuffer.h"
 #include "../States/State.h"
+#include "../../Helper/NodeTraversal.h"
 #include "../../Helper/StdNodeVisitors.h"
 #include "../RenderingLayer.h"
 #include <Geometry/BoxHelper.h>
@@ -21,9 +24,17 @@
 #include <Rendering/DrawCompound.h>
 #include <Util/Macros.h>
 #include <Util/ObjectExtension.h>
+#include <algorithm>
+#include <utility>
 
 namespace MinSG{
 
+/*! (internal) Nodes whose transformation changed while the updates are deferred. Every thread has its own
+	list and mode, so that threads working on different scenes do not interfere. The list keeps the nodes alive;
+	a node that is only referenced by the list is dead and is skipped. */
+static thread_local std::vector<Node::ref_t> pendingTransformations;
+static thread_local bool transformationUpdatesDeferred = false;
+
 // ---- Main
 
 //! (ctor)
@@ -77,6 +88,7 @@ Node::~Node() {
 		clearNodeAddedObservers();
 	if(getStatus(STATUS_CONTAINS_NODE_REMOVED_OBSERVER))
 		clearNodeRemovedObservers();
+	SceneStateBuffer::nodeDestroyed(this);
 	_setParent(nullptr);
 	removeStates();
 }
@@ -166,6 +178,17 @@ void Node::display(FrameContext & context, const RenderParam & rp) {
 		return;
 
 	bool matrixMustBePopped=false;
+	const bool recordStates = rp.getFlag(RENDER_QUEUE);
+	if(recordStates && hasStates() && !(rp.getFlag(NO_STATES))) {
+		for(const auto & stateEntry : *states) {
+			State * state = stateEntry.first.get();
+			if(state->isActive() && state->testRenderingLayer(rp.getRenderingLayers()) && !RenderQueue::isQueueable(state, rp)) {
+				// the state would not be active when the render queue is submitted
+				context.getRenderQueue().displayImmediately(context, this, rp);
+				return;
+			}
+		}
+	}
 
 	// - apply transformations
 	if( (rp.getFlag(USE_WORLD_MATRIX))>0 && getWorldTransformationMatrixPtr() ){
@@ -187,6 +210,12 @@ void Node::display(FrameContext & context, const RenderParam & rp) {
 		if(hasStates() && !(rp.getFlag(NO_STATES))) {
 			bool skipRendering = false;
 			for(auto & stateEntry : *states) {
+				if(recordStates && RenderQueue::isQueueable(stateEntry.first.get(), rp)) {
+					// the state is enabled when the render queue is submitted
+					context.getRenderQueue().pushState(stateEntry.first.get(), this);
+					stateEntry.second = true;
+					continue;
+				}
 				const State::stateResult_t result = stateEntry.first->enableState(context, this, rp);
 				if(result == State::STATE_OK) {
 					stateEntry.second = true;
@@ -214,7 +243,8 @@ void Node::display(FrameContext & context, const RenderParam & rp) {
 					auto& stateEntry = (*states)[i];
 					if( stateEntry.second ){ // state was enabled...
 						stateEntry.second = false;
-						stateEntry.first->disableState(context,this,rp);
+						if( !recordStates || !context.getRenderQueue().popState(stateEntry.first.get(),this) )
+							stateEntry.first->disableState(context,this,rp);
 					}
 				}
 			}
@@ -235,7 +265,8 @@ void Node::display(FrameContext & context, const RenderParam & rp) {
 				auto& stateEntry = (*states)[i];
 				if( stateEntry.second ){ // state was enabled...
 					stateEntry.second = false;
-					stateEntry.first->disableState(context,this,rp);
+					if( !recordStates || !context.getRenderQueue().popState(stateEntry.first.get(),this) )
+						stateEntry.first->disableState(context,this,rp);
 				}
 			}
 		}
@@ -266,7 +297,7 @@ void Node::destroy() {
 	std::deque<Node::ref_t> nodes; // keep references during the destruction process (can crash otherwise).
 	
 	// collect and mark as destroyed
-	MinSG::forEachNodeTopDown( this, [&nodes](Node * node){
+	NodeTraversal::forEachNodeTopDown(this, [&nodes](Node * node){
 		nodes.emplace_back(node);
 		node->setStatus( STATUS_IS_DESTROYED, true ); // set before dissolving the tree
 		node->setStatus( STATUS_CONTAINS_NODE_REMOVED_OBSERVER,false); // prevent observers to be triggered
@@ -280,7 +311,7 @@ void Node::destroy() {
 //! (internal)
 void Node::updateObservedStatus(){
 	
-	MinSG::traverseTopDown(this,[](Node * node){
+	NodeTraversal::traverseTopDown(this,[](Node * node){
 		const statusFlag_t initialStatus = node->statusFlags;
 		const Node * parent = node->getParent();
 
@@ -515,17 +546,46 @@ void Node::setWorldOrigin(const Geometry::Vec3 & v) {
 static Util::StringIdentifier attrName_transformationObservers( NodeAttributeModifier::create("transformationObservers", NodeAttributeModifier::PRIVATE_ATTRIBUTE) );
 static Util::StringIdentifier attrName_nodeAddedObservers( 		NodeAttributeModifier::create("nodeAddedObservers", NodeAttributeModifier::PRIVATE_ATTRIBUTE) );
 static Util::StringIdentifier attrName_nodeRemovedObservers( 	NodeAttributeModifier::create("nodeRemovedObservers", NodeAttributeModifier::PRIVATE_ATTRIBUTE) );
+static Util::StringIdentifier attrName_nodesAddedObservers( 	NodeAttributeModifier::create("nodesAddedObservers", NodeAttributeModifier::PRIVATE_ATTRIBUTE) );
+static Util::StringIdentifier attrName_nodesRemovedObservers( 	NodeAttributeModifier::create("nodesRemovedObservers", NodeAttributeModifier::PRIVATE_ATTRIBUTE) );
+
+typedef Util::WrapperAttribute<std::vector<std::pair<Node::observerId_t, Node::transformationObserverFunc>>> transformationObserversContainer_t;
+typedef Util::WrapperAttribute<std::vector<std::pair<Node::observerId_t, Node::nodeAddedObserverFunc>>> nodeAddedObserversContainer_t;
+typedef Util::WrapperAttribute<std::vector<std::pair<Node::observerId_t, Node::nodeRemovedObserverFunc>>> nodeRemovedObserversContainer_t;
+typedef Util::WrapperAttribute<std::vector<std::pair<Node::observerId_t, Node::nodesAddedObserverFunc>>> nodesAddedObserversContainer_t;
+typedef Util::WrapperAttribute<std::vector<std::pair<Node::observerId_t, Node::nodesRemovedObserverFunc>>> nodesRemovedObserversContainer_t;
+
+//! Identifier of the next observer function; the identifiers are unique for all nodes and kinds of observers.
+static Node::observerId_t nextObserverId = 0;
 
-typedef Util::WrapperAttribute<std::vector<Node::transformationObserverFunc>> transformationObserversContainer_t;
-typedef Util::WrapperAttribute<std::vector<Node::nodeAddedObserverFunc>> nodeAddedObserversContainer_t;
-typedef Util::WrapperAttribute<std::vector<Node::nodeRemovedObserverFunc>> nodeRemovedObserversContainer_t;
+//! (internal) Remove the observer function with the given id from the container. Return true if the container is empty afterwards.
+template<typename func_t>
+static bool eraseObserver(Util::WrapperAttribute<std::vector<std::pair<Node::observerId_t, func_t>>> * observers, Node::observerId_t id) {
+	if(observers == nullptr)
+		return true;
+	auto & functions = observers->ref();
+	functions.erase(std::remove_if(functions.begin(), functions.end(), [id](const std::pair<Node::observerId_t, func_t> & entry) {
+						return entry.first == id;
+					}), functions.end());
+	return functions.empty();
+}
 
 
 void Node::transformationChanged() {
 	setStatus(STATUS_MATRIX_REFLECTS_SRT, false);
+	if(transformationUpdatesDeferred) {
+		if(!getStatus(STATUS_TRANSFORMATION_PENDING)) {
+			setStatus(STATUS_TRANSFORMATION_PENDING, true);
+			pendingTransformations.push_back(this);
+		}
+		return;
+	}
 	invalidateWorldMatrix();
 	worldBBChanged();
+	informTransformationObservers();
+}
 
+void Node::informTransformationObservers() {
 	for(Node * n = this; n!=nullptr&&n->isTransformationObserved(); n = n->getParent()){
 		if(n->getStatus(STATUS_CONTAINS_TRANSFORMATION_OBSERVER)){
 			auto observers = dynamic_cast<transformationObserversContainer_t*>(n->getAttribute(attrName_transformationObservers));
@@ -535,7 +595,7 @@ void Node::transformationChanged() {
 				continue;
 			}
 			for(auto & observer : **observers)
-				observer(this);
+				observer.second(this);
 		}
 	}
 }
@@ -545,7 +605,14 @@ void Node::informNodeAddedObservers(Node * addedNode){
 			auto observers = dynamic_cast<nodeAddedObserversContainer_t*>(n->getAttribute(attrName_nodeAddedObservers));
 			if(observers){
 				for(auto & observer:**observers)
-					observer( addedNode );
+					observer.second( addedNode );
+			}
+			// the list for the batch observers is only created if there are any
+			auto batchObservers = dynamic_cast<nodesAddedObserversContainer_t*>(n->getAttribute(attrName_nodesAddedObservers));
+			if(batchObservers){
+				const std::vector<Node *> addedNodes(1, addedNode);
+				for(auto & observer:**batchObservers)
+					observer.second( addedNodes );
 			}
 		}
 	}
@@ -556,41 +623,134 @@ void Node::informNodeRemovedObservers(GroupNode * parent, Node * removedNode){
 			auto observers = dynamic_cast<nodeRemovedObserversContainer_t*>(n->getAttribute(attrName_nodeRemovedObservers));
 			if(observers){
 				for(auto & observer:**observers)
-					observer( parent, removedNode );
+					observer.second( parent, removedNode );
+			}
+			// the list for the batch observers is only created if there are any
+			auto batchObservers = dynamic_cast<nodesRemovedObserversContainer_t*>(n->getAttribute(attrName_nodesRemovedObservers));
+			if(batchObservers){
+				const std::vector<Node *> removedNodes(1, removedNode);
+				for(auto & observer:**batchObservers)
+					observer.second( parent, removedNodes );
+			}
+		}
+	}
+}
+void Node::informNodesAddedObservers(const std::vector<Node *> & addedNodes){
+	if(addedNodes.empty())
+		return;
+	for(Node * n = this; n!=nullptr&&n->getStatus(STATUS_TREE_OBSERVED); n = n->getParent()){
+		if(n->getStatus(STATUS_CONTAINS_NODE_ADDED_OBSERVER)){
+			auto observers = dynamic_cast<nodeAddedObserversContainer_t*>(n->getAttribute(attrName_nodeAddedObservers));
+			if(observers){
+				for(auto & observer:**observers){
+					for(auto & addedNode : addedNodes)
+						observer.second( addedNode );
+				}
+			}
+			auto batchObservers = dynamic_cast<nodesAddedObserversContainer_t*>(n->getAttribute(attrName_nodesAddedObservers));
+			if(batchObservers){
+				for(auto & observer:**batchObservers)
+					observer.second( addedNodes );
+			}
+		}
+	}
+}
+void Node::informNodesRemovedObservers(GroupNode * parent, const std::vector<Node *> & removedNodes){
+	if(removedNodes.empty())
+		return;
+	for(Node * n = this; n!=nullptr&&n->getStatus(STATUS_TREE_OBSERVED); n = n->getParent()){
+		if(n->getStatus(STATUS_CONTAINS_NODE_REMOVED_OBSERVER)){
+			auto observers = dynamic_cast<nodeRemovedObserversContainer_t*>(n->getAttribute(attrName_nodeRemovedObservers));
+			if(observers){
+				for(auto & observer:**observers){
+					for(auto & removedNode : removedNodes)
+						observer.second( parent, removedNode );
+				}
+			}
+			auto batchObservers = dynamic_cast<nodesRemovedObserversContainer_t*>(n->getAttribute(attrName_nodesRemovedObservers));
+			if(batchObservers){
+				for(auto & observer:**batchObservers)
+					observer.second( parent, removedNodes );
 			}
 		}
 	}
 }
 
-void Node::addTransformationObserver(const transformationObserverFunc & func){
+Node::observerId_t Node::addTransformationObserver(const transformationObserverFunc & func){
 	auto observers = dynamic_cast<transformationObserversContainer_t*>(getAttribute(attrName_transformationObservers));
 	if(observers==nullptr){
 		observers = new transformationObserversContainer_t;
 		setAttribute(attrName_transformationObservers,observers);
 	}
-	observers->ref().push_back(func);
+	const observerId_t id = nextObserverId++;
+	observers->ref().emplace_back(id, func);
 	setStatus(STATUS_CONTAINS_TRANSFORMATION_OBSERVER,true);
 	updateObservedStatus();
+	return id;
 }
-void Node::addNodeAddedObserver(const nodeAddedObserverFunc & func){
+Node::observerId_t Node::addNodeAddedObserver(const nodeAddedObserverFunc & func){
 	auto observers = dynamic_cast<nodeAddedObserversContainer_t*>(getAttribute(attrName_nodeAddedObservers));
 	if(observers==nullptr){
 		observers = new nodeAddedObserversContainer_t;
 		setAttribute(attrName_nodeAddedObservers,observers);
 	}
-	observers->ref().push_back(func);
+	const observerId_t id = nextObserverId++;
+	observers->ref().emplace_back(id, func);
 	setStatus(STATUS_CONTAINS_NODE_ADDED_OBSERVER,true);
 	updateObservedStatus();
+	return id;
 }
-void Node::addNodeRemovedObserver(const nodeRemovedObserverFunc & func){
+Node::observerId_t Node::addNodeRemovedObserver(const nodeRemovedObserverFunc & func){
 	auto observers = dynamic_cast<nodeRemovedObserversContainer_t*>(getAttribute(attrName_nodeRemovedObservers));
 	if(observers==nullptr){
 		observers = new nodeRemovedObserversContainer_t;
 		setAttribute(attrName_nodeRemovedObservers,observers);
 	}
-	observers->ref().push_back(func);
+	const observerId_t id = nextObserverId++;
+	observers->ref().emplace_back(id, func);
 	setStatus(STATUS_CONTAINS_NODE_REMOVED_OBSERVER,true);
 	updateObservedStatus();
+	return id;
+}
+Node::observerId_t Node::addNodesAddedObserver(const nodesAddedObserverFunc & func){
+	auto observers = dynamic_cast<nodesAddedObserversContainer_t*>(getAttribute(attrName_nodesAddedObservers));
+	if(observers==nullptr){
+		observers = new nodesAddedObserversContainer_t;
+		setAttribute(attrName_nodesAddedObservers,observers);
+	}
+	const observerId_t id = nextObserverId++;
+	observers->ref().emplace_back(id, func);
+	setStatus(STATUS_CONTAINS_NODE_ADDED_OBSERVER,true);
+	updateObservedStatus();
+	return id;
+}
+Node::observerId_t Node::addNodesRemovedObserver(const nodesRemovedObserverFunc & func){
+	auto observers = dynamic_cast<nodesRemovedObserversContainer_t*>(getAttribute(attrName_nodesRemovedObservers));
+	if(observers==nullptr){
+		observers = new nodesRemovedObserversContainer_t;
+		setAttribute(attrName_nodesRemovedObservers,observers);
+	}
+	const observerId_t id = nextObserverId++;
+	observers->ref().emplace_back(id, func);
+	setStatus(STATUS_CONTAINS_NODE_REMOVED_OBSERVER,true);
+	updateObservedStatus();
+	return id;
+}
+void Node::removeTransformationObserver(observerId_t id){
+	if(eraseObserver(dynamic_cast<transformationObserversContainer_t*>(getAttribute(attrName_transformationObservers)), id))
+		clearTransformationObservers();
+}
+void Node::removeNodeAddedObserver(observerId_t id){
+	const bool singleEmpty = eraseObserver(dynamic_cast<nodeAddedObserversContainer_t*>(getAttribute(attrName_nodeAddedObservers)), id);
+	const bool batchEmpty = eraseObserver(dynamic_cast<nodesAddedObserversContainer_t*>(getAttribute(attrName_nodesAddedObservers)), id);
+	if(singleEmpty && batchEmpty)
+		clearNodeAddedObservers();
+}
+void Node::removeNodeRemovedObserver(observerId_t id){
+	const bool singleEmpty = eraseObserver(dynamic_cast<nodeRemovedObserversContainer_t*>(getAttribute(attrName_nodeRemovedObservers)), id);
+	const bool batchEmpty = eraseObserver(dynamic_cast<nodesRemovedObserversContainer_t*>(getAttribute(attrName_nodesRemovedObservers)), id);
+	if(singleEmpty && batchEmpty)
+		clearNodeRemovedObservers();
 }
 void Node::clearTransformationObservers(){
 	unsetAttribute(attrName_transformationObservers);
@@ -599,16 +759,103 @@ void Node::clearTransformationObservers(){
 }
 void Node::clearNodeAddedObservers(){
 	unsetAttribute(attrName_nodeAddedObservers);
+	unsetAttribute(attrName_nodesAddedObservers);
 	setStatus(STATUS_CONTAINS_NODE_ADDED_OBSERVER,false);
 	updateObservedStatus();
 }
 void Node::clearNodeRemovedObservers(){
 	unsetAttribute(attrName_nodeRemovedObservers);
+	unsetAttribute(attrName_nodesRemovedObservers);
 	setStatus(STATUS_CONTAINS_NODE_REMOVED_OBSERVER,false);
 	updateObservedStatus();
 }
 
 
+// -----------------------------------
+// ---- Deferred transformation updates
+
+//! (static)
+void Node::setTransformationUpdatesDeferred(bool b) {
+	if(!b)
+		processPendingTransformations();
+	transformationUpdatesDeferred = b;
+}
+
+//! (static)
+bool Node::areTransformationUpdatesDeferred() {
+	return transformationUpdatesDeferred;
+}
+
+//! (static)
+void Node::processPendingTransformations() {
+	if(pendingTransformations.empty())
+		return;
+	// The nodes are kept alive until the observers have been called.
+	std::vector<Node::ref_t> nodes;
+	using std::swap;
+	swap(nodes, pendingTransformations);
+	nodes.erase(std::remove_if(nodes.begin(), nodes.end(), [](const Node::ref_t & node) {
+					if(node->countReferences() > 1)
+						return false;
+					node->setStatus(STATUS_TRANSFORMATION_PENDING, false);
+					return true;
+				}), nodes.end());
+	std::vector<Node *> markedNodes;
+
+	// 1. Bottom-up: invalidate the world bbs and compound bbs. A walk stops at a node that has already been invalidated.
+	for(const auto & node : nodes) {
+		node->setStatus(STATUS_WORLD_BB_VALID, false);
+		for(GroupNode * p = node->getParent(); p && !p->hasFixedBB() && !p->getStatus(STATUS_PENDING_BB_INVALIDATED); p = p->getParent()) {
+			p->invalidateCompoundBB();
+			p->setStatus(STATUS_WORLD_BB_VALID, false);
+			p->setStatus(STATUS_PENDING_BB_INVALIDATED, true);
+			markedNodes.push_back(p);
+		}
+	}
+
+	/* 2. Find the roots of the independent subtrees: pending nodes without a pending ancestor.
+		Every node on a path to the root is visited once and stores if it is covered by a pending node. */
+	std::vector<Node *> roots;
+	std::vector<Node *> path;
+	for(const auto & node : nodes) {
+		path.clear();
+		bool covered = false;
+		for(Node * p = node->getParent(); p != nullptr; p = p->getParent()) {
+			if(p->getStatus(STATUS_PENDING_PATH_VISITED)) {
+				covered = p->getStatus(STATUS_PENDING_PATH_COVERED);
+				break;
+			}
+			path.push_back(p);
+		}
+		for(auto it = path.rbegin(); it != path.rend(); ++it) {
+			covered = covered || (*it)->getStatus(STATUS_TRANSFORMATION_PENDING);
+			(*it)->setStatus(STATUS_PENDING_PATH_VISITED, true);
+			(*it)->setStatus(STATUS_PENDING_PATH_COVERED, covered);
+			markedNodes.push_back(*it);
+		}
+		if(!covered)
+			roots.push_back(node.get());
+	}
+
+	// 3. Top-down: invalidate the world matrices. The subtrees of the roots are disjoint.
+	const int rootCount = static_cast<int>(roots.size());
+COMPILER_WARN_PUSH
+COMPILER_WARN_OFF_CLANG(-Wunknown-pragmas)
+#pragma omp parallel for schedule(dynamic) if(rootCount > 64)
+	for(int i = 0; i < rootCount; ++i)
+		roots[i]->invalidateWorldMatrix();
+COMPILER_WARN_POP
+
+	for(const auto & node : markedNodes)
+		node->setStatus(STATUS_PENDING_BB_INVALIDATED | STATUS_PENDING_PATH_VISITED | STATUS_PENDING_PATH_COVERED, false);
+	for(const auto & node : nodes)
+		node->setStatus(STATUS_TRANSFORMATION_PENDING, false);
+
+	// 4. Inform the observers in the order of the transformations.
+	for(const auto & node : nodes)
+		node->informTransformationObservers();
+}
+
 // -----------------------------------
 // ---- Traversal
 
@@ -627,7 +874,7 @@ size_t Node::getMemoryUsage() const {
 		size += sizeof(Util::GenericAttributeMap) + getAttributes()->size() * sizeof(Util::GenericAttribute);
 	}
 	if(worldLocation) {
-		size += sizeof(worldLocation);
+		size += NodeMemoryPool::getAllocatedSize(worldLocation.get());
 	}
 	if(states) {
 		size += sizeof(stateList_t) + states->size() * sizeof(stateList_t::value_type);
@@ -638,7 +885,7 @@ size_t Node::getMemoryUsage() const {
 		}
 	}
 	if(relTransformation) {
-		size += sizeof(RelativeTransformation);
+		size += NodeMemoryPool::getAllocatedSize(relTransformation.get());
 	}
 	return size;
 }
@@ -695,7 +942,7 @@ const Geometry::Matrix4x4* Node::getWorldTransformationMatrixPtr() const {
 }
 
 void Node::invalidateWorldMatrix() const {
-	traverseTopDown(const_cast<Node*>(this),[](Node* node){
+	NodeTraversal::traverseTopDown(const_cast<Node*>(this),[](Node* node){
 		if(node->getStatus(STATUS_WORLD_MATRIX_VALID)){
 			node->setStatus(STATUS_WORLD_MATRIX_VALID,false);
 			node->setStatus(STATUS_WORLD_BB_VALID,false);
@@ -12,6 +12,7 @@
 #define MINSG_NODE_H
 
 #include "../States/State.h"
+#include "../NodeMemoryPool.h"
 #include "../NodeVisitor.h"
 
 #include <Geometry/Angle.h>
@@ -189,6 +190,15 @@ class Node :
 		/// (internal) the Node contains a fixed bounding box
 		static const statusFlag_t STATUS_CONTAINS_FIXED_BB					= 1 << 11;
 
+		/// (internal) the Node is on the list of pending transformations
+		static const statusFlag_t STATUS_TRANSFORMATION_PENDING				= 1 << 12;
+		/// (internal) used by processPendingTransformations() to mark nodes whose compound bb has been invalidated
+		static const statusFlag_t STATUS_PENDING_BB_INVALIDATED				= 1 << 13;
+		/// (internal) used by processPendingTransformations() to mark nodes whose path to the root has been visited
+		static const statusFlag_t STATUS_PENDING_PATH_VISITED				= 1 << 14;
+		/// (internal) used by processPendingTransformations() to mark nodes that are pending or have a pending ancestor
+		static const statusFlag_t STATUS_PENDING_PATH_COVERED				= 1 << 15;
+
 
 		//! This function is const because it has to called from other const member functions. The member @a statusFlags is mutable.
 		void setStatus(statusFlag_t f, bool value) const	{	statusFlags = value ? (statusFlags | f) : (statusFlags & ~f);	}
@@ -251,6 +261,7 @@ class Node :
 	public:
 		/**
 		 * Get the amount of memory that is required to store this node.
+		 * The side structures of the node are counted with the size of their NodeMemoryPool blocks.
 		 * 
 		 * @return Amount of memory in bytes
 		 */
@@ -319,12 +330,16 @@ class Node :
 		struct RelativeTransformation{
 			Geometry::SRT srt;
 			Geometry::Matrix4x4 matrix;
+			static void * operator new(std::size_t size)		{	return NodeMemoryPool::allocate(size);	}
+			static void operator delete(void * ptr)				{	NodeMemoryPool::deallocate(ptr);	}
 		};
 		mutable std::unique_ptr<RelativeTransformation> relTransformation;
 
 		struct WorldLocation{
 			Geometry::Matrix4x4 matrix_localToWorld;
 			Geometry::Box worldBB;
+			static void * operator new(std::size_t size)		{	return NodeMemoryPool::allocate(size);	}
+			static void operator delete(void * ptr)				{	NodeMemoryPool::deallocate(ptr);	}
 		};
 		mutable std::unique_ptr<WorldLocation> worldLocation;
 
@@ -421,34 +436,80 @@ class Node :
 		 * this node or in the nodes up to the root) are notified.
 		 */
 		void transformationChanged();
+		//! (internal) Call all transformation observers registered at this node or in the nodes up to the root.
+		void informTransformationObservers();
 		//! (internal) Called by GroupNode::addNode(...)
 		void informNodeAddedObservers(Node * addedNode); 
 		//! (internal) Called by GroupNode::removeNode(...)
 		void informNodeRemovedObservers(GroupNode * parent, Node * removedNode);
+		//! (internal) Called by GroupNode::addChildren(...)
+		void informNodesAddedObservers(const std::vector<Node *> & addedNodes);
+		//! (internal) Called by GroupNode::removeChildren(...)
+		void informNodesRemovedObservers(GroupNode * parent, const std::vector<Node *> & removedNodes);
 	public:
 		bool isTransformationObserved() const			{	return getStatus(STATUS_TRANSFORMATION_OBSERVED);	}
 		
 		typedef std::function<void (Node *)> transformationObserverFunc;
 		typedef std::function<void (Node *)> nodeAddedObserverFunc;
 		typedef std::function<void (GroupNode *,Node *)> nodeRemovedObserverFunc;
+		typedef std::function<void (const std::vector<Node *> &)> nodesAddedObserverFunc;
+		typedef std::function<void (GroupNode *,const std::vector<Node *> &)> nodesRemovedObserverFunc;
+		//! Identifier of a registered observer function, which can be used to remove it again.
+		typedef uint32_t observerId_t;
 
 		//! Register a function that is called whenever an observed node in the subtree is transformed.
-		void addTransformationObserver(const transformationObserverFunc & func);
+		observerId_t addTransformationObserver(const transformationObserverFunc & func);
 		//! Register a function that is called whenever a node is added somewhere in the subtree.
-		void addNodeAddedObserver(const nodeAddedObserverFunc & func);
+		observerId_t addNodeAddedObserver(const nodeAddedObserverFunc & func);
 		//! Register a function that is called whenever a node is removed somewhere in the subtree.
-		void addNodeRemovedObserver(const nodeRemovedObserverFunc & func);
+		observerId_t addNodeRemovedObserver(const nodeRemovedObserverFunc & func);
+		/*! Register a function that is called once per GroupNode::addChildren(...) (or addChild(...)) call
+			somewhere in the subtree with the list of added nodes.	*/
+		observerId_t addNodesAddedObserver(const nodesAddedObserverFunc & func);
+		/*! Register a function that is called once per GroupNode::removeChildren(...) (or removeChild(...)) call
+			somewhere in the subtree with the list of removed nodes.	*/
+		observerId_t addNodesRemovedObserver(const nodesRemovedObserverFunc & func);
+
+		//! Remove the transformation observer function with the given id.
+		void removeTransformationObserver(observerId_t id);
+		//! Remove the nodeAdded or nodesAdded observer function with the given id.
+		void removeNodeAddedObserver(observerId_t id);
+		//! Remove the nodeRemoved or nodesRemoved observer function with the given id.
+		void removeNodeRemovedObserver(observerId_t id);
 
 		//! Remove all transformation observer functions.
 		void clearTransformationObservers();
-		//! Remove all nodeAdded observer functions.
+		//! Remove all nodeAdded and nodesAdded observer functions.
 		void clearNodeAddedObservers();
-		//! Remove all nodeAdded observer functions.
+		//! Remove all nodeRemoved and nodesRemoved observer functions.
 		void clearNodeRemovedObservers();
 	//@}
 
 	// -----------------
 
+	/**
+	 * @name Deferred transformation updates
+	 * If enabled, a transformation does not invalidate the world matrices and world bounding boxes
+	 * immediately. Instead, the node is put on a list of pending transformations, which is processed
+	 * by processPendingTransformations() (called by FrameContext::beginFrame()). The processing
+	 * invalidates the matrices top-down (in parallel for independent subtrees) and the bounding boxes
+	 * bottom-up, visiting every affected node only once. Afterwards, the state is identical to the one
+	 * produced by the immediate updates.
+	 * The mode and the list of pending transformations belong to the calling thread. The list holds a
+	 * reference to each node; nodes that are no longer referenced elsewhere are released by the processing.
+	 * \note Until the pending transformations are processed, world matrices and world bounding boxes
+	 *	reflect the old transformation and transformation observers have not been called.
+	 */
+	//@{
+	public:
+		static void setTransformationUpdatesDeferred(bool b);
+		static bool areTransformationUpdatesDeferred();
+		//! Resolve all pending transformations and inform the transformation observers.
+		static void processPendingTransformations();
+	//@}
+
+	// -----------------
+
 	/**
 	 * @name Traversal
 	 */
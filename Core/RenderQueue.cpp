@@ -0,0 +1,265 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "RenderQueue.h"
+#include "FrameContext.h"
+#include "Nodes/Node.h"
+#include "RenderParam.h"
+#include "States/MaterialState.h"
+#include "States/ShaderState.h"
+#include "States/ShaderUniformState.h"
+#include "States/TextureState.h"
+#include <Rendering/RenderingContext/RenderingContext.h>
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+namespace MinSG {
+
+static const uint32_t MAX_RANK = (1u << 12) - 1;
+
+RenderQueue::RenderQueue() : currentSignature(-1) {
+}
+
+RenderQueue::~RenderQueue() = default;
+
+bool RenderQueue::isQueueable(const State * state, const RenderParam & rp) {
+	if(!state->isActive() || !state->testRenderingLayer(rp.getRenderingLayers()))
+		return false;
+	if(const MaterialState * materialState = dynamic_cast<const MaterialState *>(state)) {
+		// transparent materials pass their node to the transparency channel (\see MaterialState::doEnableState)
+		const auto & material = materialState->getParameters();
+		return material.getAmbient().getA() >= 1.0f && material.getDiffuse().getA() >= 1.0f;
+	}
+	return dynamic_cast<const TextureState *>(state) != nullptr
+			|| dynamic_cast<const ShaderState *>(state) != nullptr
+			|| dynamic_cast<const ShaderUniformState *>(state) != nullptr;
+}
+
+void RenderQueue::pushState(State * state, Node * node) {
+	stateStack.emplace_back(state, node);
+	currentSignature = -1;
+}
+
+bool RenderQueue::popState(State * state, Node * node) {
+	if(stateStack.empty() || stateStack.back().state != state || stateStack.back().node != node)
+		return false;
+	stateStack.pop_back();
+	currentSignature = -1;
+	return true;
+}
+
+//! (internal) Rank of @p state; new states get the next free rank.
+static uint32_t getRank(std::unordered_map<const State *, uint32_t> & ranks, const State * state) {
+	if(state == nullptr)
+		return 0;
+	const auto result = ranks.emplace(state, static_cast<uint32_t>(ranks.size() + 1));
+	return std::min(result.first->second, MAX_RANK);
+}
+
+//! (internal) Innermost state of type @p State_t in the signature.
+template<typename State_t>
+static const State * findInnermost(const RenderQueue::signature_t & signature) {
+	for(auto it = signature.rbegin(); it != signature.rend(); ++it) {
+		if(dynamic_cast<const State_t *>(it->state) != nullptr)
+			return it->state;
+	}
+	return nullptr;
+}
+
+//! (internal) Signatures are compared by their states only.
+static bool isEqual(const RenderQueue::signature_t & a, const RenderQueue::signature_t & b) {
+	if(a.size() != b.size())
+		return false;
+	for(size_t i = 0; i < a.size(); ++i) {
+		if(a[i].state != b[i].state)
+			return false;
+	}
+	return true;
+}
+
+uint32_t RenderQueue::findOrCreateSignature() {
+	size_t hash = stateStack.size();
+	for(const auto & entry : stateStack) {
+		hash = hash * 31 + std::hash<const State *>()(entry.state);
+	}
+	const auto range = signatureIndices.equal_range(hash);
+	for(auto it = range.first; it != range.second; ++it) {
+		if(isEqual(signatures[it->second], stateStack))
+			return it->second;
+	}
+	const uint32_t index = static_cast<uint32_t>(signatures.size());
+	signatures.push_back(stateStack);
+	signatureKeys.push_back((static_cast<uint64_t>(getRank(shaderRanks, findInnermost<ShaderState>(stateStack))) << 52)
+						| (static_cast<uint64_t>(getRank(textureRanks, findInnermost<TextureState>(stateStack))) << 40)
+						| (static_cast<uint64_t>(getRank(materialRanks, findInnermost<MaterialState>(stateStack))) << 28));
+	signatureIndices.emplace(hash, index);
+	return index;
+}
+
+void RenderQueue::addItem(Rendering::Mesh * mesh, const Geometry::Matrix4x4 & modelToCamera, Node * node, float depth) {
+	if(currentSignature < 0)
+		currentSignature = findOrCreateSignature();
+	DrawItem item;
+	item.sortKey = 0;
+	item.signatureIndex = static_cast<uint32_t>(currentSignature);
+	item.depth = depth;
+	item.modelToCamera = modelToCamera;
+	item.mesh = mesh;
+	item.node = node;
+	items.push_back(item);
+}
+
+void RenderQueue::clear() {
+	items.clear();
+	signatures.clear();
+	signatureKeys.clear();
+	signatureIndices.clear();
+	stateStack.clear();
+	currentSignature = -1;
+	shaderRanks.clear();
+	textureRanks.clear();
+	materialRanks.clear();
+}
+
+void RenderQueue::sort() {
+	if(items.empty())
+		return;
+	float minDepth = std::numeric_limits<float>::max();
+	float maxDepth = std::numeric_limits<float>::lowest();
+	for(const auto & item : items) {
+		minDepth = std::min(minDepth, item.depth);
+		maxDepth = std::max(maxDepth, item.depth);
+	}
+	const float depthScale = maxDepth > minDepth ? 65535.0f / (maxDepth - minDepth) : 0.0f;
+	for(auto & item : items) {
+		const uint64_t depthKey = static_cast<uint64_t>((item.depth - minDepth) * depthScale);
+		item.sortKey = signatureKeys[item.signatureIndex]
+					| (static_cast<uint64_t>(std::min(item.signatureIndex, MAX_RANK)) << 16)
+					| std::min(depthKey, static_cast<uint64_t>(0xffff));
+	}
+	std::stable_sort(items.begin(), items.end(), [](const DrawItem & a, const DrawItem & b) {
+		return a.sortKey < b.sortKey;
+	});
+}
+
+//! (internal) Number of leading states two signatures have in common.
+static size_t commonPrefix(const RenderQueue::signature_t & a, const RenderQueue::signature_t & b) {
+	const size_t count = std::min(a.size(), b.size());
+	size_t i = 0;
+	while(i < count && a[i].state == b[i].state)
+		++i;
+	return i;
+}
+
+size_t RenderQueue::countStateTransitions() const {
+	static const signature_t emptySignature;
+	const signature_t * active = &emptySignature;
+	size_t transitions = 0;
+	for(const auto & item : items) {
+		const signature_t & next = signatures[item.signatureIndex];
+		if(&next == active)
+			continue;
+		const size_t prefix = commonPrefix(*active, next);
+		transitions += (active->size() - prefix) + (next.size() - prefix);
+		active = &next;
+	}
+	return transitions + active->size();
+}
+
+namespace {
+//! A state of the active signature. States that have been skipped are kept to preserve the positions.
+struct ActiveState {
+	State * state;
+	Node * node;
+	bool enabled;
+};
+}
+
+//! (internal) Disable the active states in reverse order until @p size states remain.
+static void disableStates(FrameContext & context, std::vector<ActiveState> & active, size_t size, const RenderParam & rp) {
+	while(active.size() > size) {
+		const ActiveState & entry = active.back();
+		if(entry.enabled)
+			entry.state->disableState(context, entry.node, rp);
+		active.pop_back();
+	}
+}
+
+/*! (internal) Enable the states of the signature starting at @p prefix and append them to the active states.
+	@return @c false iff a state requests to skip the rendering; the remaining states are not enabled then.	*/
+static bool enableStates(FrameContext & context, const RenderQueue::signature_t & signature, size_t prefix,
+						 std::vector<ActiveState> & active, const RenderParam & rp) {
+	bool skipOtherStates = false;
+	for(size_t s = prefix; s < signature.size(); ++s) {
+		ActiveState entry = {signature[s].state, signature[s].node, false};
+		if(!skipOtherStates) {
+			const State::stateResult_t result = entry.state->enableState(context, entry.node, rp);
+			if(result == State::STATE_SKIP_RENDERING)
+				return false;
+			entry.enabled = (result == State::STATE_OK || result == State::STATE_SKIP_OTHER_STATES);
+			skipOtherStates = (result == State::STATE_SKIP_OTHER_STATES);
+		}
+		active.push_back(entry);
+	}
+	return true;
+}
+
+void RenderQueue::displayImmediately(FrameContext & context, Node * node, const RenderParam & rp) {
+	const RenderParam immediateParam = rp - RENDER_QUEUE;
+	std::vector<ActiveState> active;
+	try {
+		if(enableStates(context, stateStack, 0, active, immediateParam))
+			node->display(context, immediateParam);
+	} catch(...) {
+		disableStates(context, active, 0, immediateParam);
+		throw;
+	}
+	disableStates(context, active, 0, immediateParam);
+}
+
+void RenderQueue::submit(FrameContext & context, const RenderParam & rp) {
+	if(items.empty() || rp.getFlag(NO_GEOMETRY))
+		return;
+
+	auto & renderingContext = context.getRenderingContext();
+	renderingContext.pushMatrix_modelToCamera();
+
+	const bool applyStates = !rp.getFlag(NO_STATES);
+	std::vector<ActiveState> active;
+	uint32_t activeSignature = 0;
+	bool skipRendering = false;
+	bool first = true;
+	try {
+		for(const auto & item : items) {
+			if(applyStates && (first || item.signatureIndex != activeSignature)) {
+				first = false;
+				activeSignature = item.signatureIndex;
+				const signature_t & signature = signatures[activeSignature];
+				size_t prefix = 0;
+				while(prefix < active.size() && prefix < signature.size() && active[prefix].state == signature[prefix].state)
+					++prefix;
+				disableStates(context, active, prefix, rp);
+				// if a state skips the rendering, the remaining states are tried again for the next signature
+				skipRendering = !enableStates(context, signature, prefix, active, rp);
+			}
+			if(skipRendering)
+				continue;
+			renderingContext.setMatrix_modelToCamera(item.modelToCamera);
+			context.displayMesh(item.mesh);
+		}
+		disableStates(context, active, 0, rp);
+	} catch(...) {
+		disableStates(context, active, 0, rp);
+		renderingContext.popMatrix_modelToCamera();
+		throw;
+	}
+	renderingContext.popMatrix_modelToCamera();
+}
+
+}
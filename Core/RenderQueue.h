@@ -0,0 +1,130 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_CORE_RENDERQUEUE_H
+#define MINSG_CORE_RENDERQUEUE_H
+
+#include <Geometry/Matrix4x4.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Rendering {
+class Mesh;
+}
+namespace MinSG {
+class FrameContext;
+class Node;
+class RenderParam;
+class State;
+
+/**
+ * Queue of draw items that is filled during a traversal and rendered afterwards.
+ *
+ * While the render flag RENDER_QUEUE is set, Node::display() does not enable
+ * the queueable states of a node (MaterialState, TextureState, ShaderState and
+ * ShaderUniformState), but pushes them onto the state stack of the queue.
+ * A GeometryNode adds a draw item consisting of the current state stack (the
+ * state signature), the current model to camera matrix and its mesh.
+ * A node with an active state that cannot be queued is displayed immediately
+ * during the traversal together with its subtree; the states on the state
+ * stack are enabled for it (\see displayImmediately()).
+ *
+ * sort() orders the items by the shader, texture and material of their
+ * signature and by their depth. submit() renders the items in this order and
+ * only enables and disables the states in which the signatures of consecutive
+ * items differ.
+ *
+ * \see FrameContext::displayNodeWithRenderQueue()
+ */
+class RenderQueue {
+	public:
+		/*! A state and the node it has been attached to. The queueable states do
+			not depend on the node: signatures with the same states are merged and
+			the node of the first occurrence is used to enable a state.	*/
+		struct StateEntry {
+			State * state;
+			Node * node;
+			StateEntry(State * _state, Node * _node) : state(_state), node(_node) {}
+		};
+		typedef std::vector<StateEntry> signature_t;
+
+		struct DrawItem {
+			uint64_t sortKey;
+			uint32_t signatureIndex;
+			float depth;
+			Geometry::Matrix4x4 modelToCamera;
+			Rendering::Mesh * mesh;
+			Node * node;
+		};
+
+		RenderQueue();
+		~RenderQueue();
+
+		//! @return @c true iff the state is enabled through the queue if RENDER_QUEUE is set.
+		static bool isQueueable(const State * state, const RenderParam & rp);
+
+		//! @name Recording
+		//	@{
+		void pushState(State * state, Node * node);
+		//! Remove the topmost state, if it equals @p state (attached to @p node). @return @c true iff the state was removed.
+		bool popState(State * state, Node * node);
+		size_t getStateStackSize() const					{	return stateStack.size();	}
+
+		//! Add a draw item with the current state stack. @p depth is the distance to the camera.
+		void addItem(Rendering::Mesh * mesh, const Geometry::Matrix4x4 & modelToCamera, Node * node, float depth);
+
+		/*! Display the node without the render flag RENDER_QUEUE. The states on the
+			state stack are enabled before and disabled afterwards.	*/
+		void displayImmediately(FrameContext & context, Node * node, const RenderParam & rp);
+		//	@}
+
+		//! Remove all items and signatures.
+		void clear();
+
+		bool empty() const									{	return items.empty();	}
+		size_t getItemCount() const							{	return items.size();	}
+		const DrawItem & getItem(size_t i) const			{	return items[i];	}
+		size_t getSignatureCount() const					{	return signatures.size();	}
+		const signature_t & getSignature(uint32_t i) const	{	return signatures[i];	}
+
+		/*! Sort the items by shader, texture, material and signature; items with
+			the same signature are sorted front to back. The sort is stable.	*/
+		void sort();
+
+		/*! Number of state changes (enable and disable calls) that submit() issues
+			for the current order of the items.	*/
+		size_t countStateTransitions() const;
+
+		/*! Render the items in their current order. Between two items, only the
+			states that differ between their signatures are disabled and enabled.	*/
+		void submit(FrameContext & context, const RenderParam & rp);
+
+	private:
+		std::vector<DrawItem> items;
+		std::vector<signature_t> signatures;
+		//! Upper bits of the sort key (shader, texture and material rank) for each signature.
+		std::vector<uint64_t> signatureKeys;
+		//! Indices of the signatures by the hash of their states.
+		std::unordered_multimap<size_t, uint32_t> signatureIndices;
+		signature_t stateStack;
+		//! Index of the signature equal to the state stack or -1 if the stack has been changed.
+		int64_t currentSignature;
+
+		uint32_t findOrCreateSignature();
+
+		//! Rank of the states by the order of their first appearance; rank 0 means "no state".
+		std::unordered_map<const State *, uint32_t> shaderRanks;
+		std::unordered_map<const State *, uint32_t> textureRanks;
+		std::unordered_map<const State *, uint32_t> materialRanks;
+};
+
+}
+
+#endif // MINSG_CORE_RENDERQUEUE_H
@@ -0,0 +1,185 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "SceneStateBuffer.h"
+#include "Nodes/Node.h"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+namespace MinSG {
+
+//! Buffer of the simulation step running on this thread.
+static thread_local SceneStateBuffer * updatingBuffer = nullptr;
+
+/*! All existing buffers; they are informed about destroyed nodes. The mutex is locked before
+	the entries of a buffer. It is recursive, because a node may be destroyed in swap().	*/
+static std::recursive_mutex registryMutex;
+static std::vector<SceneStateBuffer *> & getRegistry() {
+	// never destroyed, because nodes may be deleted during the destruction of static objects
+	static std::vector<SceneStateBuffer *> * registry = new std::vector<SceneStateBuffer *>;
+	return *registry;
+}
+static std::atomic<size_t> registeredBuffers(0);
+
+SceneStateBuffer::SceneStateBuffer() {
+	std::lock_guard<std::recursive_mutex> lock(registryMutex);
+	getRegistry().push_back(this);
+	++registeredBuffers;
+}
+
+SceneStateBuffer::~SceneStateBuffer() {
+	std::lock_guard<std::recursive_mutex> lock(registryMutex);
+	auto & registry = getRegistry();
+	registry.erase(std::remove(registry.begin(), registry.end(), this), registry.end());
+	--registeredBuffers;
+}
+
+//! (static)
+void SceneStateBuffer::nodeDestroyed(Node * node) {
+	if(registeredBuffers.load(std::memory_order_relaxed) == 0)
+		return;
+	std::lock_guard<std::recursive_mutex> lock(registryMutex);
+	for(const auto & buffer : getRegistry()) {
+		std::lock_guard<std::recursive_mutex> entriesLock(buffer->entriesMutex);
+		buffer->removeEntries(node);
+	}
+}
+
+void SceneStateBuffer::beginUpdate() {
+	if(updatingBuffer != nullptr)
+		throw std::logic_error("SceneStateBuffer::beginUpdate: A simulation step is already running on this thread.");
+	mutex.lock();
+	updatingBuffer = this;
+}
+
+void SceneStateBuffer::endUpdate() {
+	if(updatingBuffer != this)
+		throw std::logic_error("SceneStateBuffer::endUpdate: No simulation step of this buffer is running on this thread.");
+	updatingBuffer = nullptr;
+	mutex.unlock();
+}
+
+//! (static)
+SceneStateBuffer * SceneStateBuffer::getUpdatingBuffer() {
+	return updatingBuffer;
+}
+
+SceneStateBuffer::Entry & SceneStateBuffer::accessBackEntry(Node * node) {
+	const auto result = backIndices.emplace(node, backBuffer.size());
+	if(result.second)
+		backBuffer.emplace_back(node);
+	return backBuffer[result.first->second];
+}
+
+void SceneStateBuffer::setRelTransformation(Node * node, const Geometry::SRT & srt) {
+	std::lock_guard<std::recursive_mutex> lock(entriesMutex);
+	Entry & entry = accessBackEntry(node);
+	entry.srt = srt;
+	entry.changes |= CHANGED_TRANSFORMATION;
+	latestTransformations[node] = srt;
+}
+
+void SceneStateBuffer::setActive(Node * node, bool active) {
+	std::lock_guard<std::recursive_mutex> lock(entriesMutex);
+	Entry & entry = accessBackEntry(node);
+	entry.active = active;
+	entry.changes |= CHANGED_ACTIVE;
+}
+
+const Geometry::SRT * SceneStateBuffer::getRelTransformation(Node * node) const {
+	std::lock_guard<std::recursive_mutex> lock(entriesMutex);
+	const auto it = latestTransformations.find(node);
+	return it == latestTransformations.end() ? nullptr : &it->second;
+}
+
+//! (static)
+void SceneStateBuffer::writeRelTransformation(Node * node, const Geometry::SRT & srt) {
+	if(updatingBuffer != nullptr) {
+		updatingBuffer->setRelTransformation(node, srt);
+	} else {
+		node->setRelTransformation(srt);
+	}
+}
+
+//! (static)
+void SceneStateBuffer::writeActive(Node * node, bool active) {
+	if(updatingBuffer != nullptr) {
+		updatingBuffer->setActive(node, active);
+	} else if(active) {
+		node->activate();
+	} else {
+		node->deactivate();
+	}
+}
+
+size_t SceneStateBuffer::swap() {
+	std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+	if(!lock.owns_lock())
+		return 0;
+	// Nodes destroyed on other threads wait until the states have been applied.
+	std::lock_guard<std::recursive_mutex> registryLock(registryMutex);
+	std::lock_guard<std::recursive_mutex> entriesLock(entriesMutex);
+	if(backBuffer.empty())
+		return 0;
+	frontBuffer.swap(backBuffer);
+	backIndices.clear();
+	// The next simulation step may start, but it cannot write states before the nodes have been updated.
+	lock.unlock();
+
+	/* Nodes destroyed while applying the states are removed from the front buffer by
+		removeEntries(). Therefore, the entries are accessed by their index. */
+	for(size_t i = 0; i < frontBuffer.size(); ++i) {
+		const Entry entry = frontBuffer[i];
+		if(entry.node == nullptr)
+			continue;
+		if(entry.changes & CHANGED_TRANSFORMATION)
+			entry.node->setRelTransformation(entry.srt);
+		if((entry.changes & CHANGED_ACTIVE) && frontBuffer[i].node != nullptr) {
+			if(entry.active) {
+				entry.node->activate();
+			} else {
+				entry.node->deactivate();
+			}
+		}
+	}
+	const size_t count = frontBuffer.size();
+	frontBuffer.clear();
+	return count;
+}
+
+void SceneStateBuffer::track(Node * node) {
+	std::lock_guard<std::recursive_mutex> lock(entriesMutex);
+	latestTransformations[node] = node->getRelTransformationSRT();
+}
+
+void SceneStateBuffer::untrack(Node * node) {
+	std::lock_guard<std::recursive_mutex> lock(entriesMutex);
+	removeEntries(node);
+}
+
+void SceneStateBuffer::removeEntries(Node * node) {
+	latestTransformations.erase(node);
+	// only non-empty while swap() applies the states
+	for(auto & entry : frontBuffer) {
+		if(entry.node == node)
+			entry.node = nullptr;
+	}
+	const auto it = backIndices.find(node);
+	if(it == backIndices.end())
+		return;
+	const size_t index = it->second;
+	backIndices.erase(it);
+	if(index + 1 != backBuffer.size()) {
+		backBuffer[index] = backBuffer.back();
+		backIndices[backBuffer[index].node] = index;
+	}
+	backBuffer.pop_back();
+}
+
+}
@@ -0,0 +1,141 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_CORE_SCENESTATEBUFFER_H
+#define MINSG_CORE_SCENESTATEBUFFER_H
+
+#include <Geometry/SRT.h>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace MinSG {
+class Node;
+
+/**
+ * Double buffer for the relative transformations and the activation of nodes,
+ * which allows to run a simulation (e.g. the behaviours) on a worker thread
+ * while the scene is rendered on the render thread.
+ *
+ * The simulation thread encloses each simulation step in beginUpdate() and
+ * endUpdate() (or an UpdateScope) and writes the new states into the back
+ * buffer instead of modifying the nodes. The render thread calls swap() once
+ * per frame (\see FrameContext::beginFrame()), which exchanges the buffers and
+ * applies the states of all completed simulation steps to the nodes. Thereby,
+ * a frame always shows the result of complete simulation steps, and the nodes
+ * are only modified by the render thread.
+ *
+ * Reading a node on the simulation thread is not safe, as the render thread
+ * updates cached values (e.g. world matrices and bounding boxes) of the nodes.
+ * Instead, the simulation reads the states it has written before, or the
+ * states that have been captured with track().
+ *
+ * The nodes are referenced by raw pointers. A node that is destroyed is removed
+ * from all buffers by its destructor (\see nodeDestroyed()). Therefore, the
+ * destruction of nodes is slower while a buffer exists.
+ */
+class SceneStateBuffer {
+	public:
+		SceneStateBuffer();
+		~SceneStateBuffer();
+		SceneStateBuffer(const SceneStateBuffer &) = delete;
+		SceneStateBuffer & operator=(const SceneStateBuffer &) = delete;
+
+		/**
+		 * @name Simulation thread
+		 */
+		//@{
+		//! Start a simulation step. Blocks while swap() is running.
+		void beginUpdate();
+		//! Finish the simulation step; its states are applied by the next swap().
+		void endUpdate();
+
+		//! A simulation step for the lifetime of the object.
+		class UpdateScope {
+				SceneStateBuffer & buffer;
+			public:
+				explicit UpdateScope(SceneStateBuffer & _buffer) : buffer(_buffer)	{	buffer.beginUpdate();	}
+				~UpdateScope()														{	buffer.endUpdate();	}
+				UpdateScope(const UpdateScope &) = delete;
+				UpdateScope & operator=(const UpdateScope &) = delete;
+		};
+
+		//! @return The buffer of the simulation step running on the calling thread, or nullptr.
+		static SceneStateBuffer * getUpdatingBuffer();
+
+		void setRelTransformation(Node * node, const Geometry::SRT & srt);
+		void setActive(Node * node, bool active);
+
+		/*! @return The last relative transformation of @p node written to or tracked by
+			this buffer, or nullptr if the buffer does not know the node.	*/
+		const Geometry::SRT * getRelTransformation(Node * node) const;
+
+		/*! Set the relative transformation in the buffer of the simulation step running on
+			the calling thread, or directly at the node if there is none. Behaviours use this
+			to support the execution on a worker thread.	*/
+		static void writeRelTransformation(Node * node, const Geometry::SRT & srt);
+		//! \see writeRelTransformation()
+		static void writeActive(Node * node, bool active);
+		//@}
+
+		/**
+		 * @name Render thread
+		 */
+		//@{
+		/*! Exchange the buffers and apply the states written by the completed simulation
+			steps to the nodes. Does not block: if a simulation step is running, the nodes
+			keep their states until the next call.
+			@return The number of nodes that have been updated.	*/
+		size_t swap();
+
+		//! Make the current relative transformation of @p node available to the simulation.
+		void track(Node * node);
+		//! Remove all states of @p node from the buffer.
+		void untrack(Node * node);
+		//@}
+
+		//! (internal) Remove @p node from all existing buffers; called by the destructor of Node.
+		static void nodeDestroyed(Node * node);
+
+	private:
+		static const uint8_t CHANGED_TRANSFORMATION = 1 << 0;
+		static const uint8_t CHANGED_ACTIVE = 1 << 1;
+
+		struct Entry {
+			Node * node;
+			Geometry::SRT srt;
+			uint8_t changes;
+			bool active;
+			explicit Entry(Node * _node) : node(_node), changes(0), active(true) {}
+		};
+
+		//! Held during a simulation step and while swapping the buffers.
+		std::mutex mutex;
+		/*! Held while the containers are accessed and while swap() applies the states to the
+			nodes. In contrast to @a mutex, it is not held during a simulation step, so a node can
+			be destroyed on any thread then. It is recursive, because applying a state may destroy
+			a node on the render thread.	*/
+		mutable std::recursive_mutex entriesMutex;
+		//! States written by the simulation since the last swap().
+		std::vector<Entry> backBuffer;
+		std::unordered_map<Node *, size_t> backIndices;
+		//! States that are applied to the nodes by swap(); empty outside of swap().
+		std::vector<Entry> frontBuffer;
+		//! Latest relative transformation of each node known to the simulation.
+		std::unordered_map<Node *, Geometry::SRT> latestTransformations;
+
+		Entry & accessBackEntry(Node * node);
+		//! Remove the entries of @p node; @a entriesMutex has to be held.
+		void removeEntries(Node * node);
+};
+
+}
+
+#endif /* MINSG_CORE_SCENESTATEBUFFER_H */
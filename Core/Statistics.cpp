@@ -11,13 +11,30 @@
 #include "Statistics.h"
 #include <Rendering/Mesh/Mesh.h>
 #include <Util/Utils.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <istream>
 #include <limits>
+#include <ostream>
+#include <stdexcept>
 
 namespace MinSG {
 
 const uint32_t Statistics::COUNTER_KEY_INVALID = std::numeric_limits<uint32_t>::max();
 
-Statistics::Statistics() : counters(), eventsEnabled(false) {
+//! Source of the ids of the Statistics objects.
+static std::atomic<uint64_t> nextInstanceId(1);
+
+//! Shard of the Statistics object last used by this thread.
+struct CachedShard {
+	uint64_t instanceId;
+	void * shard;
+};
+static thread_local CachedShard cachedShard = {0, nullptr};
+
+Statistics::Statistics() : counters(), instanceId(nextInstanceId++),
+		eventsEnabled(false), eventCapacity(1 << 20), eventsBegin(0), droppedEvents(0) {
 	frameNumberCounter = addCounter("frame number", "1");
 	frameDurationCounter = addCounter("frame duration", "ms");
 	vboCounter = addCounter("VBOs rendered", "1");
@@ -28,11 +45,15 @@ Statistics::Statistics() : counters(), eventsEnabled(false) {
 
 	ioRateReadCounter = addCounter("I/O rate read", "MiB/s");
 	ioRateWriteCounter = addCounter("I/O rate write", "MiB/s");
+
+	enableHistory(frameDurationCounter);
 }
 
+Statistics::~Statistics() = default;
+
 void Statistics::beginFrame(int32_t newFrameNumber/*=-1*/){
 	if(eventsEnabled) {
-		events.clear();
+		clearEvents();
 	}
 	const int32_t oldFrameNumber = getValueAsInt(frameNumberCounter);
 	if(newFrameNumber == -1) {
@@ -52,6 +73,7 @@ void Statistics::beginFrame(int32_t newFrameNumber/*=-1*/){
 
 void Statistics::endFrame() {
 	setValue(frameDurationCounter, frameTimer.getMilliseconds());
+	mergeThreadShards();
 
 	{ // IO
 		static Util::Timer ioTimer;
@@ -78,6 +100,8 @@ void Statistics::endFrame() {
 	}
 
 	pushEvent(EVENT_TYPE_FRAME_END, 1);
+
+	recordHistories();
 }
 
 uint32_t Statistics::getCounterForDescription(const std::string & description) const {
@@ -124,10 +148,184 @@ uint32_t Statistics::addCounter(const std::string & description, const std::stri
 	return newKey;
 }
 
+// ------------------------------------------------------------
+// Thread shards
+
+Statistics::ThreadShard & Statistics::getThreadShard() {
+	if(cachedShard.instanceId == instanceId)
+		return *static_cast<ThreadShard *>(cachedShard.shard);
+	// A shard is created once per thread; it is identified by its thread-local cache entry.
+	static thread_local std::vector<CachedShard> threadShards;
+	for(const auto & entry : threadShards) {
+		if(entry.instanceId == instanceId) {
+			cachedShard = entry;
+			return *static_cast<ThreadShard *>(entry.shard);
+		}
+	}
+	ThreadShard * shard = new ThreadShard;
+	{
+		std::lock_guard<std::mutex> lock(shardsMutex);
+		shards.emplace_back(shard);
+	}
+	cachedShard = {instanceId, shard};
+	threadShards.push_back(cachedShard);
+	return *shard;
+}
+
+void Statistics::addValueFromThread(uint32_t key, double value) {
+	ThreadShard & shard = getThreadShard();
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	if(shard.values.size() <= key)
+		shard.values.resize(key + 1, 0.0);
+	shard.values[key] += value;
+	shard.modified = true;
+}
+
+void Statistics::mergeThreadShards() {
+	std::lock_guard<std::mutex> lock(shardsMutex);
+	for(auto & shard : shards) {
+		std::lock_guard<std::mutex> shardLock(shard->mutex);
+		if(!shard->modified)
+			continue;
+		const std::size_t count = std::min(shard->values.size(), counters.size());
+		for(std::size_t key = 0; key < count; ++key) {
+			counters[key].value += shard->values[key];
+			shard->values[key] = 0.0;
+		}
+		shard->modified = false;
+	}
+}
+
+// ------------------------------------------------------------
+// Histories
+
+void Statistics::enableHistory(uint32_t key, uint32_t frameCount/*=256*/) {
+	disableHistory(key);
+	if(frameCount > 0)
+		histories.emplace_back(key, frameCount);
+}
+
+void Statistics::disableHistory(uint32_t key) {
+	histories.erase(std::remove_if(histories.begin(), histories.end(),
+									[key](const History & history) { return history.key == key; }),
+					histories.end());
+}
+
+const Statistics::History * Statistics::findHistory(uint32_t key) const {
+	for(const auto & history : histories) {
+		if(history.key == key)
+			return &history;
+	}
+	return nullptr;
+}
+
+bool Statistics::isHistoryEnabled(uint32_t key) const {
+	return findHistory(key) != nullptr;
+}
+
+std::size_t Statistics::getHistorySize(uint32_t key) const {
+	const History * history = findHistory(key);
+	return history == nullptr ? 0 : history->values.size();
+}
+
+double Statistics::getPercentile(uint32_t key, double percentile) const {
+	const History * history = findHistory(key);
+	if(history == nullptr || history->values.empty())
+		return 0.0;
+	std::vector<double> values(history->values);
+	const double rank = std::ceil(std::max(0.0, std::min(percentile, 100.0)) / 100.0 * static_cast<double>(values.size()));
+	const std::size_t index = rank < 1.0 ? 0 : static_cast<std::size_t>(rank) - 1;
+	std::nth_element(values.begin(), values.begin() + index, values.end());
+	return values[index];
+}
+
+void Statistics::recordHistories() {
+	for(auto & history : histories) {
+		if(history.key >= counters.size())
+			continue;
+		const double value = counters[history.key].value;
+		if(history.values.size() < history.frameCount) {
+			history.values.push_back(value);
+		} else {
+			history.values[history.next] = value;
+			history.next = (history.next + 1) % history.frameCount;
+		}
+	}
+}
+
+// ------------------------------------------------------------
+// Events
+
 void Statistics::pushEvent(eventType_t type, double value) {
 	if(eventsEnabled) {
-		events.emplace_back(type, frameTimer.getMicroseconds(), value);
+		if(events.size() < eventCapacity) {
+			events.emplace_back(type, frameTimer.getMicroseconds(), value);
+		} else {
+			events[eventsBegin] = Event(type, frameTimer.getMicroseconds(), value);
+			eventsBegin = (eventsBegin + 1) % events.size();
+			++droppedEvents;
+		}
+	}
+}
+
+void Statistics::clearEvents() {
+	events.clear();
+	eventsBegin = 0;
+	droppedEvents = 0;
+}
+
+void Statistics::setEventCapacity(std::size_t capacity) {
+	std::vector<Event> newEvents;
+	const std::size_t count = std::min(events.size(), capacity);
+	newEvents.reserve(count);
+	// keep the newest events
+	for(std::size_t i = events.size() - count; i < events.size(); ++i)
+		newEvents.push_back(getEvent(i));
+	droppedEvents += events.size() - count;
+	events.swap(newEvents);
+	eventsBegin = 0;
+	eventCapacity = std::max<std::size_t>(capacity, 1);
+}
+
+static const char eventsMagic[4] = {'M', 'S', 'G', 'E'};
+static const uint32_t eventsVersion = 1;
+
+void Statistics::writeEvents(std::ostream & output) const {
+	const uint64_t count = events.size();
+	output.write(eventsMagic, sizeof(eventsMagic));
+	output.write(reinterpret_cast<const char *>(&eventsVersion), sizeof(eventsVersion));
+	output.write(reinterpret_cast<const char *>(&count), sizeof(count));
+	for(std::size_t i = 0; i < events.size(); ++i) {
+		const Event & event = getEvent(i);
+		output.write(reinterpret_cast<const char *>(&event.type), sizeof(event.type));
+		output.write(reinterpret_cast<const char *>(&event.time), sizeof(event.time));
+		output.write(reinterpret_cast<const char *>(&event.value), sizeof(event.value));
+	}
+}
+
+//! (static)
+std::vector<Statistics::Event> Statistics::readEvents(std::istream & input) {
+	char magic[4];
+	uint32_t version = 0;
+	uint64_t count = 0;
+	input.read(magic, sizeof(magic));
+	input.read(reinterpret_cast<char *>(&version), sizeof(version));
+	input.read(reinterpret_cast<char *>(&count), sizeof(count));
+	if(!input || !std::equal(magic, magic + sizeof(magic), eventsMagic) || version != eventsVersion)
+		throw std::runtime_error("Statistics::readEvents: Invalid header.");
+	std::vector<Event> result;
+	for(uint64_t i = 0; i < count; ++i) {
+		eventType_t type;
+		double time;
+		double value;
+		input.read(reinterpret_cast<char *>(&type), sizeof(type));
+		input.read(reinterpret_cast<char *>(&time), sizeof(time));
+		input.read(reinterpret_cast<char *>(&value), sizeof(value));
+		if(!input)
+			throw std::runtime_error("Statistics::readEvents: Unexpected end of input.");
+		result.emplace_back(type, time, value);
 	}
+	return result;
 }
 
 }
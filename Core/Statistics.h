@@ -12,6 +12,9 @@
 #define MINSG_STATISTICS_H
 
 #include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <Util/Timer.h>
@@ -25,6 +28,10 @@ class Node;
 
 /**
  *  [Statistics]
+ *
+ * The counters and events are updated by the thread that renders the frames.
+ * Other threads add to the counters with addValueFromThread(); their values are
+ * collected in per-thread shards and merged into the counters by endFrame().
  */
 class Statistics {
 
@@ -32,6 +39,9 @@ class Statistics {
 	//	@{
 	public:
 		Statistics();
+		~Statistics();
+		Statistics(const Statistics &) = delete;
+		Statistics & operator=(const Statistics &) = delete;
 
 		void beginFrame(int32_t framNumber=-1);
 		void endFrame();
@@ -146,6 +156,11 @@ class Statistics {
 
 		void countNode(const Node * node);
 
+		/*! Add a value to a counter from any thread. The value is stored in a shard of
+			the calling thread and is added to the counter by the next endFrame().
+			\note The counter has to be created before.	*/
+		void addValueFromThread(uint32_t key, double value);
+
 	private:
 		struct Counter {
 			std::string description;
@@ -159,6 +174,55 @@ class Statistics {
 		std::vector<Counter> counters;
 
 		Util::Timer frameTimer;
+
+		//! Counter values of one thread that have not been merged yet.
+		struct ThreadShard {
+			std::mutex mutex;
+			std::vector<double> values;
+			bool modified = false;
+		};
+		//! Unique id of this object; identifies the cached shard of a thread.
+		const uint64_t instanceId;
+		std::mutex shardsMutex;
+		std::vector<std::unique_ptr<ThreadShard>> shards;
+
+		ThreadShard & getThreadShard();
+		void mergeThreadShards();
+	//	@}
+
+	// ------------------------------------------------------------
+
+	//!	@name Histories (rolling percentiles)
+	//	@{
+	public:
+		/*! Record the values of the counter at the end of each frame for the last @p frameCount
+			frames. The frame duration is recorded for 256 frames by default.	*/
+		void enableHistory(uint32_t key, uint32_t frameCount = 256);
+		void disableHistory(uint32_t key);
+		bool isHistoryEnabled(uint32_t key) const;
+
+		//! Number of recorded values of the counter.
+		std::size_t getHistorySize(uint32_t key) const;
+
+		/*! Return the percentile (0 to 100; e.g. 50, 95 or 99) of the recorded values of the counter
+			(nearest rank). If there are no recorded values, 0 is returned.	*/
+		double getPercentile(uint32_t key, double percentile) const;
+
+	private:
+		struct History {
+			uint32_t key;
+			//! Size of the ring buffer (the capacity of values may be larger).
+			std::size_t frameCount;
+			std::vector<double> values;
+			std::size_t next;
+			History(uint32_t _key, uint32_t _frameCount) : key(_key), frameCount(_frameCount), next(0) {
+				values.reserve(frameCount);
+			}
+		};
+		std::vector<History> histories;
+
+		const History * findHistory(uint32_t key) const;
+		void recordHistories();
 	//	@}
 
 	// ------------------------------------------------------------
@@ -199,18 +263,38 @@ class Statistics {
 		void disableEvents()						{	eventsEnabled=false;	}
 
 		void pushEvent(eventType_t type,double value);
+		//! Return the event with the given index; the oldest stored event has the index 0.
 		const Event & getEvent(size_t index) const {
-			return events[index];
+			return events[(eventsBegin + index) % events.size()];
 		}
 		//! Return the number of events. This value can be used in a loop iterating over the events.
 		std::size_t getNumEvents() const {
 			return events.size();
 		}
 
+		/*! The events are stored in a ring buffer of fixed capacity. If it is full, the
+			oldest events are overwritten. The default capacity is 2^20 events.	*/
+		void setEventCapacity(std::size_t capacity);
+		std::size_t getEventCapacity() const				{	return eventCapacity;	}
+		//! Number of events overwritten since the events have been cleared last.
+		uint64_t getNumDroppedEvents() const				{	return droppedEvents;	}
+
+		/*! Write the stored events in a binary format: the magic number "MSGE", a version
+			number (uint32_t), the number of events (uint64_t) and for each event the type
+			(uint8_t), the time and the value (double each), in native byte order.	*/
+		void writeEvents(std::ostream & output) const;
+		//! Read events written by writeEvents(). Throws std::runtime_error on invalid input.
+		static std::vector<Event> readEvents(std::istream & input);
 
 	private:
 		bool eventsEnabled;
 		std::vector<Event> events;
+		std::size_t eventCapacity;
+		//! Index of the oldest event if the ring buffer is full.
+		std::size_t eventsBegin;
+		uint64_t droppedEvents;
+
+		void clearEvents();
 	//	@}
 
 };
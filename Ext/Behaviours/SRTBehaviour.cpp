@@ -11,6 +11,7 @@
 */
 #include "SRTBehaviour.h"
 #include "../../Core/Nodes/Node.h"
+#include "../../Core/SceneStateBuffer.h"
 #include <Util/IO/FileName.h>
 #include <Util/IO/FileUtils.h>
 #include <iostream>
@@ -50,7 +51,7 @@ AbstractBehaviour::behaviourResult_t SRTBehaviour::doExecute(){
 	if(!getNode()) return FINISHED;
 
 	int frame = static_cast<int>(floor(getCurrentTime())) % srts.size();
-	getNode()->setRelTransformation(srts[frame]);
+	SceneStateBuffer::writeRelTransformation(getNode(), srts[frame]);
 	return CONTINUE;
 }
 
@@ -0,0 +1,308 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_COMPILEDSCENE
+
+#include "CompiledScene.h"
+#include "../../Core/Nodes/AbstractCameraNode.h"
+#include "../../Core/Nodes/GeometryNode.h"
+#include "../../Core/States/State.h"
+#include "../../Core/FrameContext.h"
+#include "../../Core/RenderParam.h"
+#include <Geometry/Frustum.h>
+#include <Rendering/RenderingContext/RenderingContext.h>
+#include <algorithm>
+
+namespace MinSG {
+
+CompiledScene::CompiledScene(GroupNode * rootNode) : root(rootNode), structureChanged(true) {
+	transformationObserverId = root->addTransformationObserver([this](Node * node) {
+		if(!structureChanged)
+			transformedNodes.push_back(node);
+	});
+	nodesAddedObserverId = root->addNodesAddedObserver([this](const std::vector<Node *> &) {
+		structureChanged = true;
+	});
+	nodesRemovedObserverId = root->addNodesRemovedObserver([this](GroupNode *, const std::vector<Node *> &) {
+		structureChanged = true;
+	});
+	rebuild();
+}
+
+CompiledScene::~CompiledScene() {
+	root->removeTransformationObserver(transformationObserverId);
+	root->removeNodeAddedObserver(nodesAddedObserverId);
+	root->removeNodeRemovedObserver(nodesRemovedObserverId);
+}
+
+bool CompiledScene::isStructureValid() const {
+	return !structureChanged;
+}
+
+CompiledScene::index_t CompiledScene::getIndex(Node * node) const {
+	const auto it = nodeIndices.find(node);
+	return it == nodeIndices.end() ? INVALID_INDEX : it->second;
+}
+
+void CompiledScene::markDirty(Node * node) {
+	if(!structureChanged)
+		changedNodes.push_back(node);
+}
+
+void CompiledScene::rebuild() {
+	nodes.clear();
+	parentIndices.clear();
+	subtreeEnds.clear();
+	worldMatrices.clear();
+	worldBBs.clear();
+	stateListIndices.clear();
+	meshes.clear();
+	renderingLayers.clear();
+	stateLists.clear();
+	nodeIndices.clear();
+
+	// list 0 is the empty state list
+	stateLists.emplace_back();
+
+	struct Visitor : public NodeVisitor {
+		CompiledScene & scene;
+		std::vector<index_t> path;
+		Visitor(CompiledScene & _scene) : scene(_scene) {}
+		virtual ~Visitor() = default;
+
+		NodeVisitor::status enter(Node * node) override {
+			if(!node->isActive())
+				return BREAK_TRAVERSAL;
+			const index_t index = static_cast<index_t>(scene.nodes.size());
+			const index_t parentIndex = path.empty() ? INVALID_INDEX : path.back();
+			index_t stateListIndex = parentIndex == INVALID_INDEX ? 0 : scene.stateListIndices[parentIndex];
+			if(node->hasStates()) {
+				stateList_t stateList(scene.stateLists[stateListIndex]);
+				for(const auto & stateEntry : *node->getStateListPtr())
+					stateList.emplace_back(stateEntry.first.get(), node);
+				stateListIndex = static_cast<index_t>(scene.stateLists.size());
+				scene.stateLists.emplace_back(std::move(stateList));
+			}
+			const GeometryNode * geoNode = dynamic_cast<GeometryNode *>(node);
+
+			scene.nodes.push_back(node);
+			scene.parentIndices.push_back(parentIndex);
+			scene.subtreeEnds.push_back(index + 1);
+			scene.worldMatrices.push_back(node->getWorldTransformationMatrix());
+			scene.worldBBs.push_back(node->getWorldBB());
+			scene.stateListIndices.push_back(stateListIndex);
+			scene.meshes.emplace_back(geoNode == nullptr ? nullptr : geoNode->getMesh());
+			scene.renderingLayers.push_back(node->getRenderingLayers());
+			scene.nodeIndices[node] = index;
+			path.push_back(index);
+			return CONTINUE_TRAVERSAL;
+		}
+		NodeVisitor::status leave(Node * node) override {
+			// leave() is also called for inactive nodes that have not been added
+			if(!path.empty() && scene.nodes[path.back()] == node) {
+				scene.subtreeEnds[path.back()] = static_cast<index_t>(scene.nodes.size());
+				path.pop_back();
+			}
+			return CONTINUE_TRAVERSAL;
+		}
+	} visitor(*this);
+	root->traverse(visitor);
+
+	structureChanged = false;
+	transformedNodes.clear();
+	changedNodes.clear();
+}
+
+void CompiledScene::refreshSubtree(index_t first) {
+	const index_t end = subtreeEnds[first];
+	for(index_t i = first; i < end; ++i) {
+		worldMatrices[i] = nodes[i]->getWorldTransformationMatrix();
+		worldBBs.set(i, nodes[i]->getWorldBB());
+	}
+	// the boxes of the ancestors contain the moved subtree
+	for(index_t i = parentIndices[first]; i != INVALID_INDEX; i = parentIndices[i])
+		worldBBs.set(i, nodes[i]->getWorldBB());
+}
+
+bool CompiledScene::refreshEntries(index_t first) {
+	const index_t end = subtreeEnds[first];
+	for(index_t i = first; i < end; ++i) {
+		Node * node = nodes[i];
+		if(!node->isActive())
+			return false;
+		const index_t parentIndex = parentIndices[i];
+		index_t stateListIndex = parentIndex == INVALID_INDEX ? 0 : stateListIndices[parentIndex];
+		if(node->hasStates()) {
+			stateList_t stateList(stateLists[stateListIndex]);
+			for(const auto & stateEntry : *node->getStateListPtr())
+				stateList.emplace_back(stateEntry.first.get(), node);
+			if(stateList == stateLists[stateListIndices[i]]) {
+				stateListIndex = stateListIndices[i];
+			} else {
+				stateListIndex = static_cast<index_t>(stateLists.size());
+				stateLists.emplace_back(std::move(stateList));
+			}
+		}
+		stateListIndices[i] = stateListIndex;
+		const GeometryNode * geoNode = dynamic_cast<GeometryNode *>(node);
+		meshes[i] = geoNode == nullptr ? nullptr : geoNode->getMesh();
+		renderingLayers[i] = node->getRenderingLayers();
+	}
+	return true;
+}
+
+void CompiledScene::update() {
+	if(structureChanged) {
+		rebuild();
+		return;
+	}
+	if(transformedNodes.empty() && changedNodes.empty())
+		return;
+
+	std::vector<index_t> dirtyIndices;
+	dirtyIndices.reserve(transformedNodes.size() + changedNodes.size());
+	for(const auto & node : changedNodes) {
+		const index_t index = getIndex(node);
+		// An unknown node has been inactive when the snapshot was built.
+		if(index == INVALID_INDEX || !refreshEntries(index)) {
+			rebuild();
+			return;
+		}
+		dirtyIndices.push_back(index);
+	}
+	changedNodes.clear();
+	// A build creates at most one state list per node; replaced state lists are only released by a rebuild.
+	if(stateLists.size() > nodes.size() + 1) {
+		rebuild();
+		return;
+	}
+	for(const auto & node : transformedNodes) {
+		const index_t index = getIndex(node);
+		if(index != INVALID_INDEX)
+			dirtyIndices.push_back(index);
+	}
+	transformedNodes.clear();
+
+	// in pre-order, a subtree contained in an already refreshed subtree can be skipped
+	std::sort(dirtyIndices.begin(), dirtyIndices.end());
+	index_t refreshedEnd = 0;
+	for(const auto & index : dirtyIndices) {
+		if(index < refreshedEnd)
+			continue;
+		refreshSubtree(index);
+		refreshedEnd = subtreeEnds[index];
+	}
+}
+
+void CompiledScene::collectVisible(const Geometry::Frustum & frustum, renderingLayerMask_t layers, std::vector<index_t> & visible) const {
+	// Number of consecutive boxes that are classified at once; a batch may contain boxes of skipped subtrees.
+	static const index_t BATCH_SIZE = 8;
+	const FrustumPlanes planes = FrustumPlanes::fromFrustum(frustum);
+	const index_t count = static_cast<index_t>(nodes.size());
+	uint8_t classification[BATCH_SIZE];
+	index_t batchBegin = 0, batchEnd = 0; // range of the classified boxes
+	index_t insideEnd = 0; // all nodes before this index are completely inside of the frustum
+	for(index_t i = 0; i < count;) {
+		if((renderingLayers[i] & layers) == 0) {
+			i = subtreeEnds[i];
+			continue;
+		}
+		if(i >= insideEnd) {
+			if(i >= batchEnd) {
+				batchBegin = i;
+				batchEnd = std::min(count, i + BATCH_SIZE);
+				classifyBoxes(planes, worldBBs.getArrays(batchBegin), batchEnd - batchBegin, classification);
+			}
+			const uint8_t result = classification[i - batchBegin];
+			if(result == BOX_OUTSIDE) {
+				i = subtreeEnds[i];
+				continue;
+			} else if(result == BOX_INSIDE) {
+				insideEnd = subtreeEnds[i];
+			}
+		}
+		if(meshes[i].isNotNull())
+			visible.push_back(i);
+		++i;
+	}
+}
+
+//! (internal) Disable the states of the list in reverse order.
+static void disableStates(FrameContext & context, const CompiledScene::stateList_t & stateList, const std::vector<bool> & enabled, const RenderParam & rp) {
+	for(size_t i = stateList.size(); i > 0; --i) {
+		if(enabled[i - 1])
+			stateList[i - 1].first->disableState(context, stateList[i - 1].second, rp);
+	}
+}
+
+void CompiledScene::display(FrameContext & context, const RenderParam & rp) {
+	update();
+
+	std::vector<index_t> visible;
+	if(rp.getFlag(FRUSTUM_CULLING) && context.hasCamera()) {
+		collectVisible(context.getCamera()->getFrustum(), rp.getRenderingLayers(), visible);
+	} else {
+		for(index_t i = 0; i < static_cast<index_t>(nodes.size());) {
+			if((renderingLayers[i] & rp.getRenderingLayers()) == 0) {
+				i = subtreeEnds[i];
+				continue;
+			}
+			if(meshes[i].isNotNull())
+				visible.push_back(i);
+			++i;
+		}
+	}
+	if(visible.empty() || rp.getFlag(NO_GEOMETRY))
+		return;
+
+	auto & renderingContext = context.getRenderingContext();
+	const Geometry::Matrix4x4 worldToCamera = renderingContext.getMatrix_worldToCamera();
+	renderingContext.pushMatrix_modelToCamera();
+
+	const bool applyStates = !rp.getFlag(NO_STATES);
+	index_t activeList = 0; // the empty list is active at the beginning
+	std::vector<bool> enabled;
+	bool skipRendering = false;
+	try {
+		for(const auto & i : visible) {
+			if(applyStates && stateListIndices[i] != activeList) {
+				disableStates(context, stateLists[activeList], enabled, rp);
+				activeList = stateListIndices[i];
+				const auto & stateList = stateLists[activeList];
+				enabled.assign(stateList.size(), false);
+				skipRendering = false;
+				for(size_t s = 0; s < stateList.size(); ++s) {
+					const State::stateResult_t result = stateList[s].first->enableState(context, stateList[s].second, rp);
+					if(result == State::STATE_OK) {
+						enabled[s] = true;
+					} else if(result == State::STATE_SKIP_OTHER_STATES) {
+						enabled[s] = true;
+						break;
+					} else if(result == State::STATE_SKIP_RENDERING) {
+						skipRendering = true;
+						break;
+					}
+				}
+			}
+			if(skipRendering)
+				continue;
+			renderingContext.setMatrix_modelToCamera(worldToCamera * worldMatrices[i]);
+			context.displayMesh(meshes[i].get());
+		}
+		disableStates(context, stateLists[activeList], enabled, rp);
+	} catch(...) {
+		disableStates(context, stateLists[activeList], enabled, rp);
+		renderingContext.popMatrix_modelToCamera();
+		throw;
+	}
+	renderingContext.popMatrix_modelToCamera();
+}
+
+}
+
+#endif // MINSG_EXT_COMPILEDSCENE
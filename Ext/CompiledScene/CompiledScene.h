@@ -0,0 +1,150 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_COMPILEDSCENE
+
+#ifndef MINSG_COMPILEDSCENE_H
+#define MINSG_COMPILEDSCENE_H
+
+#include "../../Core/Nodes/GroupNode.h"
+#include "../../Helper/FrustumBatchTest.h"
+#include <Geometry/Box.h>
+#include <Geometry/Matrix4x4.h>
+#include <Util/References.h>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Geometry {
+class Frustum;
+}
+namespace Rendering {
+class Mesh;
+}
+namespace MinSG {
+class FrameContext;
+class RenderParam;
+class State;
+
+/**
+ * Flattened snapshot of a subtree of the scene graph.
+ *
+ * The nodes of the subtree are stored in depth-first pre-order in several
+ * parallel arrays (parent index, end of the node's subtree, world matrix,
+ * world bounding box, accumulated state list and mesh). Culling and
+ * rendering walk these arrays instead of calling Node::traverse() and
+ * Node::display() recursively.
+ *
+ * The snapshot observes the subtree: transformations are collected on a
+ * dirty list and structural changes (added or removed nodes) trigger a
+ * rebuild. Both are resolved by update(), which is also called by display().
+ * Changes that are not observable (meshes, states, activation, rendering
+ * layers) have to be announced by markDirty() or rebuild(). The meshes are
+ * referenced by the snapshot, so a replaced mesh stays valid until then.
+ *
+ * \note Only states are applied that are attached to a node on the path to
+ *  a GeometryNode; the states are enabled once for a run of consecutive
+ *  nodes sharing the same state list. NodeRendererStates are therefore not
+ *  suited for a compiled scene.
+ * @ingroup ext
+ */
+class CompiledScene {
+	public:
+		typedef uint32_t index_t;
+		static const index_t INVALID_INDEX = 0xffffffffu;
+
+		//! A state and the node it is attached to.
+		typedef std::vector<std::pair<State *, Node *>> stateList_t;
+
+		explicit CompiledScene(GroupNode * rootNode);
+		~CompiledScene();
+		CompiledScene(const CompiledScene &) = delete;
+		CompiledScene & operator=(const CompiledScene &) = delete;
+
+		GroupNode * getRootNode() const						{	return root.get();	}
+
+		//! Rebuild all arrays from the current subtree.
+		void rebuild();
+
+		/*! Bring the arrays up to date: rebuild after structural changes,
+			otherwise refresh the matrices and boxes of the dirty subtrees.	*/
+		void update();
+
+		/*! Announce a change of @p node that can not be observed (e.g. Node::addState,
+			GeometryNode::setMesh, Node::setRenderingLayers or Node::activate). The next
+			update() reads the states, meshes, rendering layers, matrices and boxes of the
+			node's subtree again; if a node has been (de-)activated, the snapshot is rebuilt.	*/
+		void markDirty(Node * node);
+
+		bool isStructureValid() const;
+
+		//! @name Array access
+		//	@{
+		size_t getNodeCount() const							{	return nodes.size();	}
+		Node * getNode(index_t i) const						{	return nodes[i];	}
+		index_t getParentIndex(index_t i) const				{	return parentIndices[i];	}
+		//! First index after the subtree of node @p i.
+		index_t getSubtreeEnd(index_t i) const				{	return subtreeEnds[i];	}
+		const Geometry::Matrix4x4 & getWorldMatrix(index_t i) const	{	return worldMatrices[i];	}
+		Geometry::Box getWorldBB(index_t i) const			{	return worldBBs.get(i);	}
+		index_t getStateListIndex(index_t i) const			{	return stateListIndices[i];	}
+		const stateList_t & getStateList(index_t listIndex) const	{	return stateLists[listIndex];	}
+		Rendering::Mesh * getMesh(index_t i) const			{	return meshes[i].get();	}
+		index_t getIndex(Node * node) const;
+		//	@}
+
+		/*! Collect the indices of all nodes with a mesh that intersect the frustum and
+			match the rendering layers (in pre-order). Subtrees outside of the frustum are
+			skipped; the boxes of the remaining nodes are classified in small batches with
+			classifyBoxes(), and not at all below a node that is completely inside.	*/
+		void collectVisible(const Geometry::Frustum & frustum, renderingLayerMask_t layers, std::vector<index_t> & visible) const;
+
+		/*! Render all visible meshes of the snapshot.
+			Frustum culling is performed if FRUSTUM_CULLING is set and the context has a camera.	*/
+		void display(FrameContext & context, const RenderParam & rp);
+
+	private:
+		Util::Reference<GroupNode> root;
+
+		std::vector<Node *> nodes;
+		std::vector<index_t> parentIndices;
+		std::vector<index_t> subtreeEnds;
+		std::vector<Geometry::Matrix4x4> worldMatrices;
+		BoxBatch worldBBs;
+		std::vector<index_t> stateListIndices;
+		std::vector<Util::Reference<Rendering::Mesh>> meshes;
+		std::vector<renderingLayerMask_t> renderingLayers;
+
+		std::vector<stateList_t> stateLists;
+		std::unordered_map<Node *, index_t> nodeIndices;
+
+		//! Set by the observers if nodes have been added to or removed from the subtree.
+		bool structureChanged;
+		//! Nodes whose transformation has changed (reported by the observer).
+		std::vector<Node *> transformedNodes;
+		//! Nodes announced by markDirty().
+		std::vector<Node *> changedNodes;
+
+		//! Observers registered at the root node; they are removed by the destructor.
+		Node::observerId_t transformationObserverId;
+		Node::observerId_t nodesAddedObserverId;
+		Node::observerId_t nodesRemovedObserverId;
+
+		//! Refresh the world matrices and boxes of the subtree and the boxes of its ancestors.
+		void refreshSubtree(index_t first);
+
+		//! Read the states, meshes and rendering layers of the subtree again. Return false if the subtree contains an inactive node.
+		bool refreshEntries(index_t first);
+};
+
+}
+
+#endif // MINSG_COMPILEDSCENE_H
+
+#endif // MINSG_EXT_COMPILEDSCENE
@@ -11,12 +11,14 @@
 #include "CacheContext.h"
 #include "CacheLevel.h"
 #include "CacheObject.h"
+#include "CacheObjectPriority.h"
 #include <Rendering/Mesh/Mesh.h>
-#include <functional>
+#include <algorithm>
 #include <mutex>
+#include <stdexcept>
+#include <utility>
 
 #ifdef MINSG_EXT_OUTOFCORE_DEBUG
-#include "CacheObjectPriority.h"
 #include <cassert>
 #include <ostream>
 #endif /* MINSG_EXT_OUTOFCORE_DEBUG */
@@ -35,13 +37,16 @@ static std::ostream & operator<<(std::ostream & stream, const CacheObjectPriorit
 
 CacheContext::CacheContext() :
 		cacheObjectsMutex(),
-		sortedCacheObjects(), sortedCacheObjectsBuffer(),
-		containersSameBegin(0), 
-		updatedCacheObjects(), additionalCacheObjects(0),
-		firstMissingCache(), lastContainedCache(),
-		contentMutex() {
-	firstMissingCache.fill(0);
-	lastContainedCache.fill(0);
+		mostImportantHeaps(), leastImportantHeaps(),
+		updatedCacheObjects(),
+		contentMutex(),
+		transferMutex() {
+	mostImportantHeaps.reserve(maxNumCacheLevels);
+	leastImportantHeaps.reserve(maxNumCacheLevels);
+	for(cacheLevelId_t levelId = 0; levelId < maxNumCacheLevels; ++levelId) {
+		mostImportantHeaps.emplace_back(CacheObjectHeap::order_t::MOST_IMPORTANT_FIRST);
+		leastImportantHeaps.emplace_back(CacheObjectHeap::order_t::LEAST_IMPORTANT_FIRST);
+	}
 }
 
 CacheContext::~CacheContext() = default;
@@ -51,178 +56,68 @@ void CacheContext::addObject(CacheObject * object) {
 #ifdef MINSG_EXT_OUTOFCORE_DEBUG
 	assert(object->updated);
 #endif /* MINSG_EXT_OUTOFCORE_DEBUG */
+	const auto levelId = object->getHighestLevelStored();
+	mostImportantHeaps[levelId].push(object, object->getPriority());
+	leastImportantHeaps[levelId].push(object, object->getPriority());
 	object->updated = true;
 	updatedCacheObjects.push_back(object);
-	++additionalCacheObjects;
-	containersSameBegin = 0;
 }
 
 void CacheContext::removeObject(CacheObject * object) {
 	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
+	if(object->removed) {
+		// The cache object is not contained in the heaps anymore.
+		return;
+	}
 	if(object->updated) {
+		// Only the cache objects updated in the current frame have to be searched.
 		updatedCacheObjects.erase(std::remove(updatedCacheObjects.begin(), updatedCacheObjects.end(), object),
 								  updatedCacheObjects.end());
 	}
-	sortedCacheObjects.erase(std::remove(sortedCacheObjects.begin(), sortedCacheObjects.end(), object),
-							 sortedCacheObjects.end());
-	sortedCacheObjectsBuffer.erase(std::remove(sortedCacheObjectsBuffer.begin(), sortedCacheObjectsBuffer.end(), object),
-								   sortedCacheObjectsBuffer.end());
-	containersSameBegin = 0;
+	const auto levelId = object->getHighestLevelStored();
+	mostImportantHeaps[levelId].erase(object);
+	leastImportantHeaps[levelId].erase(object);
+	object->removed = true;
 }
 
-void CacheContext::onEndFrame(const std::vector<CacheLevel *> & levels) {
-	for(const auto & level : levels) {
-		level->lockContainer();
-	}
+bool CacheContext::isObjectRemoved(const CacheObject * object) const {
 	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
-	if(updatedCacheObjects.empty()) {
-		for(const auto & level : levels) {
-			level->unlockContainer();
-		}
-		return;
-	}
-#ifdef MINSG_EXT_OUTOFCORE_DEBUG
-	for(const auto & element : updatedCacheObjects) {
-		assert(element->updated);
-	}
-#endif /* MINSG_EXT_OUTOFCORE_DEBUG */
-	std::sort(updatedCacheObjects.begin(), updatedCacheObjects.end(), CacheObjectCompare());
-
-	const bool numCacheObjectsChanged = (additionalCacheObjects != 0);
-	const auto oldContainersSameBegin = containersSameBegin;
-
-	if(sortedCacheObjects.empty()) {
-		// There are no cache objects yet. Simply replace both arrays.
-		sortedCacheObjects = updatedCacheObjects;
-		sortedCacheObjectsBuffer = updatedCacheObjects;
-		containersSameBegin = std::distance(sortedCacheObjects.cbegin(), sortedCacheObjects.cend());
-		additionalCacheObjects = 0;
-	} else if(numCacheObjectsChanged) {
-		// New cache objects were added. Update the first array in place.
-		sortedCacheObjects.reserve(sortedCacheObjects.size() + additionalCacheObjects);
-		sortedCacheObjects.erase(std::remove_if(sortedCacheObjects.begin(), 
-												sortedCacheObjects.end(), 
-												[](const CacheObject * object) { return object->updated; }),
-								 sortedCacheObjects.end());
-		const auto oldSortedSize = sortedCacheObjects.size();
-		sortedCacheObjects.insert(sortedCacheObjects.end(), updatedCacheObjects.begin(), updatedCacheObjects.end());
-		std::inplace_merge(sortedCacheObjects.begin(),
-						   std::next(sortedCacheObjects.begin(), static_cast<std::ptrdiff_t>(oldSortedSize)),
-						   sortedCacheObjects.end(),
-						   CacheObjectCompare());
-		// Copy the first array to the second array.
-		sortedCacheObjectsBuffer = sortedCacheObjects;
-		containersSameBegin = std::distance(sortedCacheObjects.cbegin(), sortedCacheObjects.cend());
-		additionalCacheObjects = 0;
-	} else {
-		auto oldIt = sortedCacheObjects.cbegin();
-		const auto oldEnd = sortedCacheObjects.cend();
-		auto newIt = updatedCacheObjects.cbegin();
-		const auto newEnd = updatedCacheObjects.cend();
-
-		auto outputIt = sortedCacheObjectsBuffer.begin();
-
-		auto numUpdatesToSearch = updatedCacheObjects.size();
-		containersSameBegin = 0;
-
-		CacheObjectCompare prioCompare;
-		while(oldIt != oldEnd && newIt != newEnd) {
-			if(numUpdatesToSearch > 0 && (*oldIt)->updated) {
-				// Skip cache object that has been updated
-				++oldIt;
-				--numUpdatesToSearch;
-				continue;
-			}
-			// No need to check for same cache objects here
-			if(prioCompare(*newIt, *oldIt)) {
-				*outputIt++ = *newIt++;
-			} else {
-				*outputIt++ = *oldIt++;
-			}
-		}
-		
-		if(oldIt != oldEnd) {
-			for(; oldIt != oldEnd; ++oldIt) {
-				if(numUpdatesToSearch == 0) {
-					// If the last changed cache object has been found,
-					// copy only the range up to the old marker position.
-					const auto changedEnd = std::prev(sortedCacheObjects.cend(), oldContainersSameBegin);
-					if(oldIt < changedEnd) {
-						std::copy(oldIt, changedEnd, outputIt);
-					}
-					containersSameBegin = std::distance(outputIt, sortedCacheObjectsBuffer.end());
-					break;
-				}
-				if((*oldIt)->updated) {
-					// Skip cache object that has been updated
-					--numUpdatesToSearch;
-					continue;
-				}
-				*outputIt++ = *oldIt;
-			}
-		} else {
-			std::copy(newIt, newEnd, outputIt);
-		}
-
-		using std::swap;
-		swap(sortedCacheObjects, sortedCacheObjectsBuffer);
-	}
-	for(const auto & cacheObject : updatedCacheObjects) {
-		cacheObject->updated = false;
-	}
-	updatedCacheObjects.clear();
-#ifdef MINSG_EXT_OUTOFCORE_DEBUG
-	for(const auto & element : sortedCacheObjects) {
-		assert(!element->updated);
-	}
-	assert(std::is_sorted(sortedCacheObjects.cbegin(), sortedCacheObjects.cend(), CacheObjectCompare()));
-	assert(std::equal(std::prev(sortedCacheObjectsBuffer.cend(), containersSameBegin), sortedCacheObjectsBuffer.cend(), std::prev(sortedCacheObjects.cend(), containersSameBegin)));
-#endif /* MINSG_EXT_OUTOFCORE_DEBUG */
+	return object->removed;
+}
 
-	if(numCacheObjectsChanged) {
-		// Fully reset pointers if the number of cache objects has been changed
-		firstMissingCache.fill(0);
-		lastContainedCache.fill(0);
-	} else {
-		// Always reset pointers for level zero (file system)
-		firstMissingCache[0] = 0;
-		lastContainedCache[0] = 0;
-
-		// Check if the pointers point into the area that has not been changed
-		const auto minSameBegin = std::min(oldContainersSameBegin, containersSameBegin);
-		const auto numCacheObjects = static_cast<std::ptrdiff_t>(sortedCacheObjects.size());
-		for(cacheLevelId_t levelId = 1; levelId < levels.size(); ++levelId) {
-			// Only reset the pointers if they point into the changed area
-			const auto firstMissingRev = numCacheObjects - firstMissingCache[levelId];
-			if(firstMissingRev > minSameBegin) {
-				firstMissingCache[levelId] = 0;
-			}
-			if(lastContainedCache[levelId] > minSameBegin) {
-				lastContainedCache[levelId] = 0;
-			}
-		}
+void CacheContext::moveObjectToHeaps(CacheObject * object, cacheLevelId_t oldLevelId, cacheLevelId_t newLevelId) {
+	if(object->removed) {
+		// Only the cache levels still store the cache object.
+		return;
 	}
+	// The heaps keep the priority from the last frame.
+	const CacheObjectPriority priority = mostImportantHeaps[oldLevelId].getPriority(object);
+	mostImportantHeaps[oldLevelId].erase(object);
+	leastImportantHeaps[oldLevelId].erase(object);
+	mostImportantHeaps[newLevelId].push(object, priority);
+	leastImportantHeaps[newLevelId].push(object, priority);
+}
 
+void CacheContext::onEndFrame() {
+	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
+	for(const auto & object : updatedCacheObjects) {
 #ifdef MINSG_EXT_OUTOFCORE_DEBUG
-	for(const auto & level : levels) {
-		const auto levelId = level->getLevelId();
-		const auto levelContains = std::bind(&CacheObject::isContainedIn, std::placeholders::_1, levelId);
-		assert(std::all_of(sortedCacheObjects.cbegin(), std::next(sortedCacheObjects.cbegin(), firstMissingCache[levelId]), levelContains));
-		assert(std::none_of(sortedCacheObjects.crbegin(), std::next(sortedCacheObjects.crbegin(), lastContainedCache[levelId]), levelContains));
-	}
+		assert(object->updated);
 #endif /* MINSG_EXT_OUTOFCORE_DEBUG */
-
-	for(const auto & level : levels) {
-		level->unlockContainer();
+		const auto levelId = object->getHighestLevelStored();
+		mostImportantHeaps[levelId].update(object, object->getPriority());
+		leastImportantHeaps[levelId].update(object, object->getPriority());
+		object->updated = false;
 	}
+	updatedCacheObjects.clear();
 }
 
 uint16_t CacheContext::updateUserPriority(CacheObject * object, uint16_t userPriority) {
 	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
 
 	const CacheObjectPriority oldPriority = object->getPriority();
-	if (oldPriority.getUserPriority() == userPriority) {
-		// Do nothing if the priority has not changed.
+	if (object->removed || oldPriority.getUserPriority() == userPriority) {
+		// Do nothing if the priority has not changed or the cache object has been removed.
 		return oldPriority.getUserPriority();
 	}
 	CacheObjectPriority newPriority(oldPriority);
@@ -239,6 +134,9 @@ uint16_t CacheContext::updateUserPriority(CacheObject * object, uint16_t userPri
 
 void CacheContext::updateFrameNumber(CacheObject * object, uint32_t frameNumber) {
 	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
+	if(object->removed) {
+		return;
+	}
 
 	CacheObjectPriority newPriority(object->getPriority());
 	if (newPriority.getUsageFrameNumber() == frameNumber) {
@@ -258,79 +156,95 @@ void CacheContext::updateFrameNumber(CacheObject * object, uint32_t frameNumber)
 	}
 }
 
-CacheContext::object_pos_t CacheContext::getFirstMissing(const CacheLevel & level) const {
-	const auto levelId = level.getLevelId();
-	const auto levelContains = std::bind(&CacheObject::isContainedIn, std::placeholders::_1, levelId);
-	const auto cachedBegin = std::next(sortedCacheObjects.cbegin(), firstMissingCache[levelId]);
-#ifdef MINSG_EXT_OUTOFCORE_DEBUG
-	// Verify that the cached value is valid
-	assert(std::all_of(sortedCacheObjects.cbegin(), cachedBegin, levelContains));
-#endif /* MINSG_EXT_OUTOFCORE_DEBUG */
-	// Use the cached value to start the search.
-	auto firstMissingObj = std::find_if_not(cachedBegin, sortedCacheObjects.cend(), levelContains);
-	// Update the cached value
-	firstMissingCache[levelId] = std::distance(sortedCacheObjects.cbegin(), firstMissingObj);
-	return firstMissingObj;
+bool CacheContext::updatePrefetchFrameNumber(CacheObject * object, uint32_t frameNumber) {
+	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
+
+	CacheObjectPriority newPriority(object->getPriority());
+	if (object->removed || newPriority.getUsageFrameNumber() >= frameNumber) {
+		return false;
+	}
+	newPriority.setUsageFrameNumber(frameNumber);
+	newPriority.setUsageCount(0);
+	object->setPriority(newPriority);
+
+	if(!object->updated) {
+		updatedCacheObjects.push_back(object);
+		object->updated = true;
+	}
+	return true;
 }
 
-CacheContext::rev_object_pos_t CacheContext::getLastContained(const CacheLevel & level) const {
-	const auto levelId = level.getLevelId();
-	const auto levelContains = std::bind(&CacheObject::isContainedIn, std::placeholders::_1, levelId);
-	const auto cachedBegin = std::next(sortedCacheObjects.crbegin(), lastContainedCache[levelId]);
-#ifdef MINSG_EXT_OUTOFCORE_DEBUG
-	// Verify that the cached value is valid
-// 	assert(std::none_of(sortedCacheObjects.crbegin(), cachedBegin, levelContains));
-#endif /* MINSG_EXT_OUTOFCORE_DEBUG */
-	// Use the cached value to start the search.
-	auto lastContainedObj = std::find_if(cachedBegin, sortedCacheObjects.crend(), levelContains);
-	// Update the cached value
-	lastContainedCache[levelId] = std::distance(sortedCacheObjects.crbegin(), lastContainedObj);
-	return lastContainedObj;
+const CacheObjectHeap * CacheContext::findMostImportantMissing(cacheLevelId_t levelId) const {
+	// The cache objects not contained in a cache level are the ones whose highest cache level is below it.
+	const CacheObjectHeap * result = nullptr;
+	for(cacheLevelId_t lowerId = 0; lowerId < levelId; ++lowerId) {
+		const auto & heap = mostImportantHeaps[lowerId];
+		if(!heap.empty() && (result == nullptr || 
+				CacheObjectHeap::isMoreImportant(heap.topPriority(), heap.top(), result->topPriority(), result->top()))) {
+			result = &heap;
+		}
+	}
+	return result;
+}
+
+const CacheObjectHeap * CacheContext::findLeastImportantContained(cacheLevelId_t levelId) const {
+	// The cache objects contained in a cache level are the ones whose highest cache level is that level or above.
+	const CacheObjectHeap * result = nullptr;
+	for(cacheLevelId_t upperId = levelId; upperId < maxNumCacheLevels; ++upperId) {
+		const auto & heap = leastImportantHeaps[upperId];
+		if(!heap.empty() && (result == nullptr || 
+				CacheObjectHeap::isMoreImportant(result->topPriority(), result->top(), heap.topPriority(), heap.top()))) {
+			result = &heap;
+		}
+	}
+	return result;
 }
 
 CacheObject * CacheContext::getMostImportantMissingObject(const CacheLevel & level) {
-	level.lockContainer();
 	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
-	const auto firstMissingObj = getFirstMissing(level);
-	level.unlockContainer();
-	if(firstMissingObj == sortedCacheObjects.cend()) {
-		return nullptr;
-	}
-	return *firstMissingObj;
+	const auto heap = findMostImportantMissing(level.getLevelId());
+	return heap == nullptr ? nullptr : heap->top();
 }
 
-CacheObject * CacheContext::getLeastImportantStoredObject(const CacheLevel & level) {
-	level.lockContainer();
-	std::lock_guard<std::mutex> contentLock(contentMutex);
-	std::lock_guard<std::mutex> cacheObjectsLock(cacheObjectsMutex);
+void CacheContext::getMostImportantMissingObjects(const CacheLevel & level, std::size_t count, bool onlyReplacing,
+												  std::vector<CacheObject *> & objects) const {
+	typedef std::pair<CacheObjectPriority, CacheObject *> candidate_t;
+	std::vector<candidate_t> candidates;
+	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
 	const auto levelId = level.getLevelId();
-	CacheObject * result = nullptr;
-	while(result == nullptr) {
-		const auto lastContainedObj = getLastContained(level);
-		if(lastContainedObj == sortedCacheObjects.crend()) {
-			break;
-		}
-		if((*lastContainedObj)->getHighestLevelStored() == levelId) {
-			result = *lastContainedObj;
+	for(cacheLevelId_t lowerId = 0; lowerId < levelId; ++lowerId) {
+		mostImportantHeaps[lowerId].collectTopObjects(count, candidates);
+	}
+	std::sort(candidates.begin(), candidates.end(), [](const candidate_t & a, const candidate_t & b) {
+		return CacheObjectHeap::isMoreImportant(a.first, a.second, b.first, b.second);
+	});
+	const auto containedHeap = onlyReplacing ? findLeastImportantContained(levelId) : nullptr;
+	for(std::size_t i = 0; i < candidates.size() && i < count; ++i) {
+		if(containedHeap != nullptr && !CacheObjectHeap::isMoreImportant(candidates[i].first, candidates[i].second,
+																		  containedHeap->topPriority(), containedHeap->top())) {
 			break;
 		}
-		// Do not return a cache object that is stored in a higher cache level.
-		// This makes sure that the requesting cache level is allowed to remove the cache object.
-		++lastContainedCache[levelId];
+		objects.push_back(candidates[i].second);
 	}
-	level.unlockContainer();
-	return result;
 }
 
-bool CacheContext::isTargetStateReached(const CacheLevel & level) const {
-	level.lockContainer();
+CacheObject * CacheContext::getLeastImportantStoredObject(const CacheLevel & level) {
 	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
+	// Only cache objects that are not stored in a higher cache level are considered.
+	// This makes sure that the requesting cache level is allowed to remove the cache object.
+	const auto & heap = leastImportantHeaps[level.getLevelId()];
+	return heap.empty() ? nullptr : heap.top();
+}
 
-	const auto firstMissingPos = std::distance(sortedCacheObjects.cbegin(), getFirstMissing(level));
-	const auto lastContainedPos = std::distance(sortedCacheObjects.cbegin(), getLastContained(level).base());
-
-	level.unlockContainer();
-	return lastContainedPos < firstMissingPos;
+bool CacheContext::isTargetStateReached(const CacheLevel & level) const {
+	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
+	const auto missingHeap = findMostImportantMissing(level.getLevelId());
+	const auto containedHeap = findLeastImportantContained(level.getLevelId());
+	if(missingHeap == nullptr || containedHeap == nullptr) {
+		return true;
+	}
+	return CacheObjectHeap::isMoreImportant(containedHeap->topPriority(), containedHeap->top(),
+											missingHeap->topPriority(), missingHeap->top());
 }
 
 Rendering::Mesh * CacheContext::getContent(CacheObject * object) {
@@ -364,95 +278,35 @@ void CacheContext::unlockContentMutex() {
 }
 
 void CacheContext::addObjectToLevel(CacheObject * object, const CacheLevel & level) {
-	{
-		std::lock_guard<std::mutex> lock(contentMutex);
-		const auto levelId = level.getLevelId();
-		if(levelId != 0 && object->getHighestLevelStored() == levelId) {
-			throw std::logic_error("Cache object is already stored in the given cache level.");
-		} else if(object->getHighestLevelStored() > levelId) {
-			throw std::logic_error("Cache object is already stored in an upper cache level.");
-		} else if(levelId != 0 && object->getHighestLevelStored() != levelId - 1) {
-			throw std::logic_error("Cache object is not stored in the previous cache level.");
-		}
-		object->setHighestLevelStored(levelId);
-	}
-	
-	
-	
-	
-// void afterRequestedObjectAdded(const CacheLevel & level, CacheObject * object) {
+	std::lock_guard<std::mutex> contentLock(contentMutex);
 	const auto levelId = level.getLevelId();
+	if(levelId != 0 && object->getHighestLevelStored() == levelId) {
+		throw std::logic_error("Cache object is already stored in the given cache level.");
+	} else if(object->getHighestLevelStored() > levelId) {
+		throw std::logic_error("Cache object is already stored in an upper cache level.");
+	} else if(levelId != 0 && object->getHighestLevelStored() != levelId - 1) {
+		throw std::logic_error("Cache object is not stored in the previous cache level.");
+	}
 	if(levelId != 0) {
-	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
-	auto firstMissingObj = std::next(sortedCacheObjects.cbegin(), firstMissingCache[levelId]);
-	// When pointing still to the same cache object, the cache can be used.
-	if(object == *firstMissingObj) {
-		// Invalidate the other pointer if necessary
-		const auto addedObjectRevPos = std::distance(firstMissingObj, sortedCacheObjects.cend());
-		if(addedObjectRevPos == lastContainedCache[levelId]) {
-			--lastContainedCache[levelId];
-		} /*else if(addedObjectRevPos < lastContainedCache[levelId]) {
-			lastContainedCache[levelId] = 0;
-		}*/
-
-		// The added cache object is skipped during the next search
-		getFirstMissing(level);
-	} /*else {
-		firstMissingCache[levelId] = 0;
-		lastContainedCache[levelId] = 0;
-	}*/
-
-#ifdef MINSG_EXT_OUTOFCORE_DEBUG
-	// Verify that the cached values are valid
-	const auto levelContains = std::bind(&CacheObject::isContainedIn, std::placeholders::_1, levelId);
-	assert(std::all_of(sortedCacheObjects.cbegin(), std::next(sortedCacheObjects.cbegin(), firstMissingCache[levelId]), levelContains));
-// 	assert(std::none_of(sortedCacheObjects.crbegin(), std::next(sortedCacheObjects.crbegin(), lastContainedCache[levelId]), levelContains));
-#endif /* MINSG_EXT_OUTOFCORE_DEBUG */
+		std::lock_guard<std::mutex> cacheObjectsLock(cacheObjectsMutex);
+		moveObjectToHeaps(object, object->getHighestLevelStored(), levelId);
+		object->setHighestLevelStored(levelId);
 	}
 }
 
 void CacheContext::removeObjectFromLevel(CacheObject * object, const CacheLevel & level) {
-	{
-		std::lock_guard<std::mutex> lock(contentMutex);
-		const auto levelId = level.getLevelId();
-		if(object->getHighestLevelStored() > levelId) {
-			throw std::logic_error("Cache object is still stored in an upper cache level.");
-		} else if(object->getHighestLevelStored() < levelId) {
-			throw std::logic_error("Cache object is not stored in the given cache level.");
-		}
-		if(levelId != 0) {
-			object->setHighestLevelStored(levelId - 1);
-		}
-	}
-	
-	
+	std::lock_guard<std::mutex> contentLock(contentMutex);
 	const auto levelId = level.getLevelId();
-	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
-
-	auto lastContainedObj = std::next(sortedCacheObjects.crbegin(), lastContainedCache[levelId]);
-	// When pointing still to the same cache object, the cache can be used.
-	if(object == *lastContainedObj) {
-		// Invalidate the other pointer if necessary
-		const auto removedObjectPos = std::distance(sortedCacheObjects.cbegin(), lastContainedObj.base());
-		if(removedObjectPos == firstMissingCache[levelId]) {
-			--firstMissingCache[levelId];
-		} /*else if(removedObjectPos < firstMissingCache[levelId]) {
-			firstMissingCache[levelId] = 0;
-		}*/
-
-		// The removed cache object is skipped during the next search
-		getLastContained(level);
-	} /*else {
-		firstMissingCache[levelId] = 0;
-		lastContainedCache[levelId] = 0;
-	}*/
-
-#ifdef MINSG_EXT_OUTOFCORE_DEBUG
-	// Verify that the cached values are valid
-	const auto levelContains = std::bind(&CacheObject::isContainedIn, std::placeholders::_1, levelId);
-	assert(std::all_of(sortedCacheObjects.cbegin(), std::next(sortedCacheObjects.cbegin(), firstMissingCache[levelId]), levelContains));
-// 	assert(std::none_of(sortedCacheObjects.crbegin(), std::next(sortedCacheObjects.crbegin(), lastContainedCache[levelId]), levelContains));
-#endif /* MINSG_EXT_OUTOFCORE_DEBUG */
+	if(object->getHighestLevelStored() > levelId) {
+		throw std::logic_error("Cache object is still stored in an upper cache level.");
+	} else if(object->getHighestLevelStored() < levelId) {
+		throw std::logic_error("Cache object is not stored in the given cache level.");
+	}
+	if(levelId != 0) {
+		std::lock_guard<std::mutex> cacheObjectsLock(cacheObjectsMutex);
+		moveObjectToHeaps(object, levelId, levelId - 1);
+		object->setHighestLevelStored(levelId - 1);
+	}
 }
 
 bool CacheContext::isObjectStoredInLevel(const CacheObject * object, const CacheLevel & level) const {
@@ -462,11 +316,11 @@ bool CacheContext::isObjectStoredInLevel(const CacheObject * object, const Cache
 
 #ifdef MINSG_EXT_OUTOFCORE_DEBUG
 std::vector<CacheObject *> CacheContext::getObjectsInLevel(const CacheLevel & level) const {
-	const auto levelId = level.getLevelId();
-	const auto levelContains = std::bind(&CacheObject::isContainedIn, std::placeholders::_1, levelId);
 	std::vector<CacheObject *> objectsInLevel;
 	std::lock_guard<std::mutex> lock(cacheObjectsMutex);
-	std::copy_if(sortedCacheObjects.cbegin(), sortedCacheObjects.cend(), std::back_inserter(objectsInLevel), levelContains);
+	for(cacheLevelId_t levelId = level.getLevelId(); levelId < maxNumCacheLevels; ++levelId) {
+		mostImportantHeaps[levelId].collectObjects(objectsInLevel);
+	}
 	return objectsInLevel;
 }
 #endif /* MINSG_EXT_OUTOFCORE_DEBUG */
@@ -11,8 +11,8 @@
 #ifndef OUTOFCORE_CACHECONTEXT_H_
 #define OUTOFCORE_CACHECONTEXT_H_
 
+#include "CacheObjectHeap.h"
 #include "Definitions.h"
-#include <array>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -24,7 +24,6 @@ namespace MinSG {
 namespace OutOfCore {
 class CacheLevel;
 class CacheObject;
-class CacheObjectPriority;
 
 /**
  * @brief Context for holding global cache information
@@ -39,40 +38,24 @@ class CacheObjectPriority;
  */
 class CacheContext {
 	private:
-		//! Guard for @a sortedCacheObjects and @a updatedCacheObjects
+		//! Guard for @a mostImportantHeaps, @a leastImportantHeaps and @a updatedCacheObjects
 		mutable std::mutex cacheObjectsMutex;
 
-		typedef std::vector<CacheObject *> container_t;
-		typedef std::vector<CacheObject *>::const_iterator object_pos_t;
-		typedef std::vector<CacheObject *>::const_reverse_iterator 
-															rev_object_pos_t;
-
-		/**
-		 * Container of cache objects sorted by priority. It is not updated
-		 * immediately when the priority of a cache object changes. The
-		 * container is updated only once after the frame for performance
-		 * reasons.
-		 */
-		container_t sortedCacheObjects;
-
 		/**
-		 * Buffer for @a sortedCacheObjects used for circumventing the need to
-		 * create a new array every frame.
+		 * For each cache level, the cache objects whose highest cache level
+		 * is that level, with the most important cache object on top. The
+		 * heaps are not updated immediately when the priority of a cache
+		 * object changes. The priority changes of a frame are incorporated
+		 * once after the frame.
 		 */
-		container_t sortedCacheObjectsBuffer;
+		std::vector<CacheObjectHeap> mostImportantHeaps;
 
 		/**
-		 * Position in @a sortedCacheObjects after the last cache object that
-		 * has been updated in the previous frame. From this position to the
-		 * end of the container there have been no updates. It is initialized
-		 * to the end of the container and moved gradually to the front. The
-		 * position is counted from the end of the container, meaning a value
-		 * of zero describing the end. If cache object are added or removed,
-		 * it is reset to the end. The @a sortedCacheObjects and
-		 * @a sortedCacheObjectsBuffer arrays are the same beginning from this
-		 * position to the end.
+		 * For each cache level, the same cache objects as in
+		 * @a mostImportantHeaps, but with the least important cache object on
+		 * top.
 		 */
-		std::ptrdiff_t containersSameBegin;
+		std::vector<CacheObjectHeap> leastImportantHeaps;
 
 		/**
 		 * Container that collects the cache objects that are updated during a
@@ -80,52 +63,37 @@ class CacheContext {
 		 */
 		std::vector<CacheObject *> updatedCacheObjects;
 
-		/**
-		 * Counter for the additional capacity needed to store cache objects.
-		 * Increased by one for every added cache object.
-		 */
-		std::size_t additionalCacheObjects;
+		//! Guard for the content of cache objects
+		mutable std::mutex contentMutex;
 
-		/**
-		 * For each cache level, the cached position of the @b first cache
-		 * object inside the array of sorted cache objects, which is <b>not
-		 * contained</b> in that cache level. The position is counted from
-		 * front to back in @a sortedCacheObjects (zero meaning @c begin).
-		 */
-		mutable std::array<std::ptrdiff_t, maxNumCacheLevels> firstMissingCache;
+		//! Guard for moving cache objects that have been loaded by worker threads into a cache level
+		std::mutex transferMutex;
 
 		/**
-		 * For each cache level, the cached position of the @b last cache
-		 * object inside the array of sorted cache objects, which is
-		 * @b contained in that cache level. The position is counted from back
-		 * to front in @a sortedCacheObjects (zero meaning @c rbegin).
+		 * Move a cache object into the heaps of a new highest cache level.
+		 * Removed cache objects are not contained in the heaps and are skipped.
+		 * 
+		 * @note @a cacheObjectsMutex has to be locked
 		 */
-		mutable std::array<std::ptrdiff_t, maxNumCacheLevels> lastContainedCache;
-
-		//! Guard for the content of cache objects
-		mutable std::mutex contentMutex;
+		void moveObjectToHeaps(CacheObject * object, cacheLevelId_t oldLevelId, cacheLevelId_t newLevelId);
 
 		/**
-		 * Get the first missing cache object for the given cache level.
+		 * Return the heap of @a mostImportantHeaps whose top is the most
+		 * important cache object not contained in the given cache level, or
+		 * @c nullptr if all cache objects are contained in that cache level.
 		 * 
-		 * @param level Cache level
-		 * @return Valid position inside @a sortedCacheObjects if a missing
-		 * cache object is found, or @codesortedCacheObjects.cend()@endcode
-		 * otherwise.
-		 * @note @a cacheObjectsMutex and the cache level have to be locked
+		 * @note @a cacheObjectsMutex has to be locked
 		 */
-		object_pos_t getFirstMissing(const CacheLevel & level) const;
+		const CacheObjectHeap * findMostImportantMissing(cacheLevelId_t levelId) const;
 
 		/**
-		 * Get the last contained cache object for the given cache level.
+		 * Return the heap of @a leastImportantHeaps whose top is the least
+		 * important cache object contained in the given cache level, or
+		 * @c nullptr if the cache level does not contain any cache object.
 		 * 
-		 * @param level Cache level
-		 * @return Valid position inside @a sortedCacheObjects if a contained
-		 * cache object is found, or @codesortedCacheObjects.crend()@endcode
-		 * otherwise.
-		 * @note @a cacheObjectsMutex and the cache level have to be locked
+		 * @note @a cacheObjectsMutex has to be locked
 		 */
-		rev_object_pos_t getLastContained(const CacheLevel & level) const;
+		const CacheObjectHeap * findLeastImportantContained(cacheLevelId_t levelId) const;
 	public:
 		CacheContext();
 
@@ -134,16 +102,23 @@ class CacheContext {
 		//! Inform the context about a new cache object.
 		void addObject(CacheObject * object);
 
-		//! Remove an existing cache object.
+		/**
+		 * Remove an existing cache object. Its priority is not updated
+		 * anymore, and it is not requested by the cache levels anymore.
+		 * Removing a cache object again has no effect.
+		 */
 		void removeObject(CacheObject * object);
 
+		//! Return @c true if the cache object has been removed from the context.
+		bool isObjectRemoved(const CacheObject * object) const;
+
 		/**
-		 * Inform the context that the frame has ended. It will perform
-		 * maintenance work to restore the correct sort order of
-		 * @a sortedCacheObjects incorporating the priority changes of the
-		 * last frame.
+		 * Inform the context that the frame has ended. It will incorporate
+		 * the priority changes of the last frame into the heaps. The cost is
+		 * logarithmic in the number of cache objects for each updated cache
+		 * object.
 		 */
-		void onEndFrame(const std::vector<CacheLevel *> & levels);
+		void onEndFrame();
 
 		/**
 		 * Update the user priority of a cache object. If the new user
@@ -166,6 +141,19 @@ class CacheContext {
 		 */
 		void updateFrameNumber(CacheObject * object, uint32_t frameNumber);
 
+		/**
+		 * Raise the priority of a cache object that is expected to be used
+		 * soon. The usage frame number of the cache object is set to the given
+		 * frame number with a usage count of zero. Therefore, the cache object
+		 * is ranked behind all cache objects that have been used in this frame,
+		 * but before all cache objects used in earlier frames.
+		 * 
+		 * @param object Cache object to update
+		 * @param frameNumber Current frame number
+		 * @return @c false if the cache object has been used or raised in this frame already
+		 */
+		bool updatePrefetchFrameNumber(CacheObject * object, uint32_t frameNumber);
+
 		/**
 		 * Return the cache object with the highest priority that is not
 		 * stored in the given cache level. If the cache level does store all
@@ -176,6 +164,22 @@ class CacheContext {
 		 */
 		CacheObject * getMostImportantMissingObject(const CacheLevel & level);
 
+		/**
+		 * Return up to @p count cache objects with the highest priorities
+		 * that are not stored in the given cache level, starting with the
+		 * most important one. If @p onlyReplacing is @c true, only cache
+		 * objects are returned that are more important than the least
+		 * important cache object stored in the cache level (see
+		 * isTargetStateReached()).
+		 * 
+		 * @param level Cache level
+		 * @param count Maximum number of cache objects to return
+		 * @param onlyReplacing Restrict the result to cache objects that may replace stored ones
+		 * @param objects Container that the cache objects are appended to
+		 */
+		void getMostImportantMissingObjects(const CacheLevel & level, std::size_t count, bool onlyReplacing,
+											std::vector<CacheObject *> & objects) const;
+
 		/**
 		 * Return the cache object with the smallest priority that is stored
 		 * in the given cache level. If the cache level does not store any
@@ -211,6 +215,17 @@ class CacheContext {
 		//! Unlock @a contentMutex
 		void unlockContentMutex();
 
+		/**
+		 * Return the guard that has to be locked by a worker thread while it
+		 * adds a cache object that it has loaded to a cache level. Between
+		 * loading and adding, a cache object might have been removed from the
+		 * lower cache level by another worker thread. While the guard is
+		 * locked, no other worker thread changes the cache levels.
+		 */
+		std::mutex & getTransferMutex() {
+			return transferMutex;
+		}
+
 		/**
 		 * Inform the cache context that a cache object is to be added to a
 		 * cache level.
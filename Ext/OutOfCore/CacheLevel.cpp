@@ -46,6 +46,21 @@ void CacheLevel::removeUnimportantCacheObjects(uint64_t maximumMemory) {
 	}
 }
 
+bool CacheLevel::canAddLoadedCacheObject(CacheObject * object) const {
+	return lower != nullptr && !context.isObjectRemoved(object) &&
+			context.isObjectStoredInLevel(object, *lower) && !context.isObjectStoredInLevel(object, *this);
+}
+
+bool CacheLevel::addLoadedCacheObject(CacheObject * object, uint64_t maximumMemory) {
+	std::lock_guard<std::mutex> transferLock(context.getTransferMutex());
+	if(!canAddLoadedCacheObject(object)) {
+		return false;
+	}
+	removeUnimportantCacheObjects(maximumMemory);
+	addCacheObject(object);
+	return true;
+}
+
 uint64_t CacheLevel::getUsedMemory() const {
 	std::lock_guard<std::mutex> containerLock(containerMutex);
 	return memoryUsed;
@@ -76,14 +91,6 @@ std::size_t CacheLevel::getNumObjects() const {
 	return numCacheObjects;
 }
 
-void CacheLevel::lockContainer() const {
-	containerMutex.lock();
-}
-
-void CacheLevel::unlockContainer() const {
-	containerMutex.unlock();
-}
-
 #ifdef MINSG_EXT_OUTOFCORE_DEBUG
 void CacheLevel::verify() const {
 	if(getUsedMemory() > getOverallMemory()) {
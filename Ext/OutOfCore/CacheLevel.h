@@ -154,6 +154,30 @@ class CacheLevel {
 		 */
 		void removeUnimportantCacheObjects(uint64_t maximumMemory);
 
+		/**
+		 * Check if a cache object that has been loaded from the lower cache
+		 * level can be added to this cache level. This is not the case if
+		 * another thread has removed it from the lower cache level, or has
+		 * added it to this cache level, in the meantime. It is also not the
+		 * case if the cache object has been removed from the context.
+		 * 
+		 * @note The transfer mutex of the context has to be locked
+		 */
+		bool canAddLoadedCacheObject(CacheObject * object) const;
+
+		/**
+		 * Add a cache object that has been loaded from the lower cache level
+		 * after removing unimportant cache objects until the given maximum
+		 * memory usage is reached. Nothing is done if the cache object cannot
+		 * be added anymore (see canAddLoadedCacheObject()).
+		 * 
+		 * @param object Cache object to add
+		 * @param maximumMemory Maximum amount of memory in bytes that is to
+		 * be used before adding the cache object
+		 * @return @c true if the cache object has been added
+		 */
+		bool addLoadedCacheObject(CacheObject * object, uint64_t maximumMemory);
+
 	public:
 		virtual ~CacheLevel();
 
@@ -200,12 +224,6 @@ class CacheLevel {
 		//! Return the number of cache objects that are stored inside this cache level.
 		std::size_t getNumObjects() const;
 
-		//! Lock @a containerMutex. Must be used only by CacheContext.
-		void lockContainer() const;
-
-		//! Unlock @a containerMutex. Must be used only by CacheContext.
-		void unlockContainer() const;
-
 		//! Return the duration in milliseconds of the last call to @a work.
 		double getLastWorkDuration() const {
 			return lastWorkDuration;
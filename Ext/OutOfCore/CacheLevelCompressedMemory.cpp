@@ -0,0 +1,197 @@
+/*
+	This file is part of the MinSG library extension OutOfCore.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_OUTOFCORE
+
+#include "CacheLevelCompressedMemory.h"
+#include "CacheContext.h"
+#include "../../SceneManagement/MeshEncoding.h"
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshDataStrategy.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace MinSG {
+namespace OutOfCore {
+
+const uint32_t CacheLevelCompressedMemory::DEFAULT_POSITION_BITS;
+
+CacheLevelCompressedMemory::CacheLevelCompressedMemory(uint64_t cacheSize, CacheContext & cacheContext, uint32_t bitsPerPosition) :
+	CacheLevel(cacheSize, cacheContext),
+	positionBits(bitsPerPosition),
+	internalMutex(),
+	encodedObjects(), pendingObjects(),
+	uncompressedBytes(0), compressedBytes(0),
+	decompressedObjects(0), decompressionTime(0.0) {
+}
+
+CacheLevelCompressedMemory::~CacheLevelCompressedMemory() = default;
+
+double CacheLevelCompressedMemory::getCompressionRatio() const {
+	std::lock_guard<std::mutex> lock(internalMutex);
+	return compressedBytes == 0 ? 1.0 : static_cast<double>(uncompressedBytes) / static_cast<double>(compressedBytes);
+}
+
+uint32_t CacheLevelCompressedMemory::getDecompressedObjects() const {
+	std::lock_guard<std::mutex> lock(internalMutex);
+	return decompressedObjects;
+}
+
+double CacheLevelCompressedMemory::getDecompressionTime() const {
+	std::lock_guard<std::mutex> lock(internalMutex);
+	return decompressionTime;
+}
+
+void CacheLevelCompressedMemory::resetDecompressionStatistics() {
+	std::lock_guard<std::mutex> lock(internalMutex);
+	decompressedObjects = 0;
+	decompressionTime = 0.0;
+}
+
+CacheLevelCompressedMemory::EncodedObject CacheLevelCompressedMemory::encodeCacheObject(CacheObject * object) {
+	// Use the local data of the mesh directly; otherwise, download it into a local copy.
+	// The content is not referenced, because its reference counter is not guarded.
+	Rendering::Mesh * mesh = getContext().getContent(object);
+	Util::Reference<Rendering::Mesh> localCopy;
+	if(!mesh->_getVertexData().hasLocalData() || (mesh->isUsingIndexData() && !mesh->_getIndexData().hasLocalData())) {
+		localCopy = mesh->clone();
+		localCopy->setDataStrategy(Rendering::SimpleMeshDataStrategy::getPureLocalStrategy());
+		localCopy->openVertexData();
+		localCopy->openIndexData();
+		mesh = localCopy.get();
+	}
+	const Rendering::MeshVertexData & vertexData = mesh->_getVertexData();
+	const Rendering::MeshIndexData & indexData = mesh->_getIndexData();
+	const uint64_t meshBytes = static_cast<uint64_t>(vertexData.getVertexCount()) * vertexData.getVertexDescription().getVertexSize()
+								+ static_cast<uint64_t>(indexData.getIndexCount()) * sizeof(uint32_t);
+	std::shared_ptr<const std::vector<uint8_t>> encoded = std::make_shared<const std::vector<uint8_t>>(SceneManagement::MeshEncoding::encodeMesh(mesh, positionBits));
+	if(encoded->empty()) {
+		throw std::logic_error("Unable to encode the cache object.");
+	}
+	return EncodedObject{encoded, meshBytes};
+}
+
+void CacheLevelCompressedMemory::doAddCacheObject(CacheObject * object) {
+	EncodedObject encodedObject;
+	{
+		std::lock_guard<std::mutex> lock(internalMutex);
+		const auto pendingObject = pendingObjects.find(object);
+		if(pendingObject != pendingObjects.cend()) {
+			encodedObject = std::move(pendingObject->second);
+			pendingObjects.erase(pendingObject);
+		}
+	}
+	if(!encodedObject.data) {
+		// The cache object has not been encoded by doLoadCacheObject().
+		encodedObject = encodeCacheObject(object);
+	}
+
+	std::lock_guard<std::mutex> lock(internalMutex);
+	const uint64_t meshBytes = encodedObject.meshSize;
+	const uint64_t encodedBytes = encodedObject.data->size();
+	if(!encodedObjects.emplace(object, std::move(encodedObject)).second) {
+		throw std::logic_error("Cache object is already stored.");
+	}
+	uncompressedBytes += meshBytes;
+	compressedBytes += encodedBytes;
+}
+
+void CacheLevelCompressedMemory::doRemoveCacheObject(CacheObject * object) {
+	std::lock_guard<std::mutex> lock(internalMutex);
+	const auto encodedObject = encodedObjects.find(object);
+	if(encodedObject != encodedObjects.cend()) {
+		uncompressedBytes -= encodedObject->second.meshSize;
+		compressedBytes -= encodedObject->second.data->size();
+		encodedObjects.erase(encodedObject);
+	}
+}
+
+bool CacheLevelCompressedMemory::doLoadCacheObject(CacheObject * object) {
+	std::shared_ptr<const std::vector<uint8_t>> encoded;
+	{
+		std::lock_guard<std::mutex> lock(internalMutex);
+		const auto encodedObject = encodedObjects.find(object);
+		if(encodedObject != encodedObjects.cend()) {
+			encoded = encodedObject->second.data;
+		}
+	}
+	if(encoded) {
+		// Decode without holding the lock, so that several threads can decode concurrently.
+		Util::Timer timer;
+		timer.reset();
+		Util::Reference<Rendering::Mesh> mesh = SceneManagement::MeshEncoding::decodeMesh(encoded->data(), encoded->size());
+		if(mesh.isNull()) {
+			throw std::logic_error("Cache object could not be loaded.");
+		}
+		timer.stop();
+		getContext().setContent(object, mesh.get());
+
+		std::lock_guard<std::mutex> lock(internalMutex);
+		++decompressedObjects;
+		decompressionTime += timer.getMilliseconds();
+		return true;
+	}
+	// Load the missing object directly from the lower level cache level.
+	if(getLower() == nullptr) {
+		throw std::logic_error("No lower cache level.");
+	}
+	if(!getLower()->loadCacheObject(object)) {
+		return false;
+	}
+
+	// Encode the mesh before the cache object is added, so that the transfer mutex and the container mutex are not held while encoding.
+	EncodedObject encodedObject = encodeCacheObject(object);
+	const uint64_t encodedBytes = encodedObject.data->size();
+	{
+		std::lock_guard<std::mutex> lock(internalMutex);
+		pendingObjects[object] = std::move(encodedObject);
+	}
+
+	// The cache object has been loaded, even if another thread has changed the cache levels in the meantime.
+	const auto maxMemory = 0.95 * getOverallMemory();
+	if(!addLoadedCacheObject(object, maxMemory > encodedBytes ? maxMemory - encodedBytes : 0)) {
+		std::lock_guard<std::mutex> lock(internalMutex);
+		pendingObjects.erase(object);
+	}
+	return true;
+}
+
+uint64_t CacheLevelCompressedMemory::getCacheObjectSize(CacheObject * object) const {
+	std::lock_guard<std::mutex> lock(internalMutex);
+	const auto encodedObject = encodedObjects.find(object);
+	return encodedObject != encodedObjects.cend() ? encodedObject->second.data->size() : 0;
+}
+
+#ifdef MINSG_EXT_OUTOFCORE_DEBUG
+void CacheLevelCompressedMemory::doVerify() const {
+	std::lock_guard<std::mutex> lock(internalMutex);
+	uint64_t meshSizes = 0;
+	uint64_t encodedSizes = 0;
+	for(const auto & encodedObject : encodedObjects) {
+		if(!getContext().isObjectStoredInLevel(encodedObject.first, *this)) {
+			throw std::logic_error("Encoded cache object is not stored in this cache level.");
+		}
+		meshSizes += encodedObject.second.meshSize;
+		encodedSizes += encodedObject.second.data->size();
+	}
+	if(meshSizes != uncompressedBytes || encodedSizes != compressedBytes) {
+		throw std::logic_error("Wrong compression statistics.");
+	}
+}
+#endif /* MINSG_EXT_OUTOFCORE_DEBUG */
+
+}
+}
+
+#endif /* MINSG_EXT_OUTOFCORE */
@@ -0,0 +1,118 @@
+/*
+	This file is part of the MinSG library extension OutOfCore.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_OUTOFCORE
+
+#ifndef OUTOFCORE_CACHELEVELCOMPRESSEDMEMORY_H_
+#define OUTOFCORE_CACHELEVELCOMPRESSEDMEMORY_H_
+
+#include "CacheLevel.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace MinSG {
+namespace OutOfCore {
+
+/**
+ * Specialized cache level for storing cache objects compressed in main memory.
+ * It is meant to be placed between a file cache level and the main memory
+ * cache level, so that more meshes can be kept in main memory than with the
+ * uncompressed data alone. The meshes are encoded with
+ * SceneManagement::MeshEncoding: the vertex attributes are quantized (unless
+ * #positionBits is zero) and the result is compressed with a fast LZ77 variant.
+ * The size of the cache level is the budget for the encoded data.
+ *
+ * A cache object is decoded when it is loaded by the upper cache level. The
+ * worker threads of CacheLevelMainMemory load the cache objects, so the
+ * decoding does not block the rendering thread and several cache objects are
+ * decoded concurrently.
+ */
+class CacheLevelCompressedMemory : public CacheLevel {
+	private:
+		//! Number of bits per position component used for encoding the meshes; zero means lossless.
+		const uint32_t positionBits;
+
+		//! Encoded mesh of a stored cache object.
+		struct EncodedObject {
+			//! Encoded data; shared with the threads that are decoding it.
+			std::shared_ptr<const std::vector<uint8_t>> data;
+			//! Size of the vertex and index data of the mesh before encoding.
+			uint64_t meshSize;
+		};
+
+		//! Guard for all following members
+		mutable std::mutex internalMutex;
+
+		std::unordered_map<CacheObject *, EncodedObject> encodedObjects;
+
+		//! Cache objects encoded by doLoadCacheObject() that are about to be added by doAddCacheObject().
+		std::unordered_map<CacheObject *, EncodedObject> pendingObjects;
+
+		//! Size of the stored cache objects before and after encoding.
+		uint64_t uncompressedBytes;
+		uint64_t compressedBytes;
+
+		//! Number of decoded cache objects and time spent on decoding them since the last call of resetDecompressionStatistics().
+		uint32_t decompressedObjects;
+		double decompressionTime;
+
+		//! Encode the mesh of the cache object without holding any lock.
+		EncodedObject encodeCacheObject(CacheObject * object);
+
+		//! Store the encoded mesh of the cache object. Encode it only if it has not been encoded before.
+		void doAddCacheObject(CacheObject * object) override;
+
+		//! Release the encoded mesh.
+		void doRemoveCacheObject(CacheObject * object) override;
+
+		//! Decode the mesh of the cache object.
+		bool doLoadCacheObject(CacheObject * object) override;
+
+		//! Do nothing
+		void doWork() override {
+		}
+
+		//! Return the size of the encoded mesh.
+		uint64_t getCacheObjectSize(CacheObject * object) const override;
+
+#ifdef MINSG_EXT_OUTOFCORE_DEBUG
+		//! Check all cache objects stored in this cache level for inconsistencies.
+		void doVerify() const override;
+#endif /* MINSG_EXT_OUTOFCORE_DEBUG */
+	public:
+		//! Default number of bits per position component.
+		static const uint32_t DEFAULT_POSITION_BITS = 16;
+
+		CacheLevelCompressedMemory(uint64_t cacheSize, CacheContext & cacheContext, uint32_t bitsPerPosition = DEFAULT_POSITION_BITS);
+		virtual ~CacheLevelCompressedMemory();
+
+		uint32_t getPositionBits() const {
+			return positionBits;
+		}
+
+		//! Return the ratio of the uncompressed to the compressed size of the stored cache objects.
+		double getCompressionRatio() const;
+
+		//! Return the number of cache objects decoded since the last reset.
+		uint32_t getDecompressedObjects() const;
+
+		//! Return the time in milliseconds spent on decoding cache objects since the last reset.
+		double getDecompressionTime() const;
+
+		void resetDecompressionStatistics();
+};
+
+}
+}
+
+#endif /* OUTOFCORE_CACHELEVELCOMPRESSEDMEMORY_H_ */
+
+#endif /* MINSG_EXT_OUTOFCORE */
@@ -24,7 +24,9 @@
 #include <Util/References.h>
 #include <Util/StringUtils.h>
 #include <Util/Utils.h>
+#include <algorithm>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
 #include <stdexcept>
 #include <string>
@@ -33,66 +35,86 @@
 namespace MinSG {
 namespace OutOfCore {
 
-CacheLevelFiles::CacheLevelFiles(uint64_t cacheSize, CacheContext & cacheContext) :
+const uint32_t CacheLevelFiles::DEFAULT_NUM_WORKERS;
+
+CacheLevelFiles::CacheLevelFiles(uint64_t cacheSize, CacheContext & cacheContext, uint32_t workerCount) :
 	CacheLevel(cacheSize, cacheContext),
-	threadMutex(), threadSemaphore(),
-	thread(), active(false),
+	threadSemaphore(), threads(),
+	numWorkers(std::max(workerCount, static_cast<uint32_t>(1))), active(false),
 	cacheDir("MinSG_OutOfCore"),
 	internalMutex(),
-	locations(), cacheObjectsToSave() {
+	locations(), cacheObjectsToSave(), saveQueue(), fileCounter(0), objectSizes() {
 }
 
 CacheLevelFiles::~CacheLevelFiles() {
 	{
-		std::lock_guard<std::mutex> lock(threadMutex);
+		std::lock_guard<std::mutex> lock(internalMutex);
 		active = false;
 	}
 	threadSemaphore.notify_all();
-	thread.join();
+	for(auto & thread : threads) {
+		thread.join();
+	}
 }
 
 void * CacheLevelFiles::threadRun(void * data) {
 	CacheLevelFiles * level = static_cast<CacheLevelFiles *>(data);
+	std::unique_lock<std::mutex> lock(level->internalMutex);
 	while(true) {
-		{
-			std::unique_lock<std::mutex> lock(level->threadMutex);
-			level->threadSemaphore.wait(lock);
+		level->threadSemaphore.wait(lock, [level] {
+			return !level->active || !level->saveQueue.empty();
+		});
+		if(!level->active) {
+			break;
 		}
-		{
-			std::lock_guard<std::mutex> lock(level->threadMutex);
-			if(!level->active) {
-				break;
-			}
+		CacheObject * objectToSave = level->saveQueue.front();
+		level->saveQueue.pop_front();
+		const auto waitingObject = level->cacheObjectsToSave.find(objectToSave);
+		if(waitingObject == level->cacheObjectsToSave.end() || waitingObject->second.saving) {
+			// The cache object has been removed, or it is being saved by another thread already.
+			continue;
 		}
+		waitingObject->second.saving = true;
+		const Util::Reference<Rendering::Mesh> mesh = waitingObject->second.mesh;
+		const Util::FileName path(level->cacheDir.getPath().toString() + '/' + 
+									Util::StringUtils::toString(reinterpret_cast<uintptr_t>(objectToSave)) + '_' + 
+									Util::StringUtils::toString(level->fileCounter++) + ".mmf");
 
-		{
-			std::lock_guard<std::mutex> lock(level->internalMutex);
-			if(level->cacheObjectsToSave.empty()) {
-				throw std::logic_error("Semaphore value does not reflect internal data structure's size.");
-			}
-			CacheObject * objectToSave = level->cacheObjectsToSave.cbegin()->first;
-			Rendering::Mesh * mesh = level->cacheObjectsToSave.cbegin()->second.get();
-			const Util::FileName path(level->cacheDir.getPath().toString() + '/' + Util::StringUtils::toString(reinterpret_cast<uintptr_t>(objectToSave)) + ".mmf");
-			if (!Rendering::Serialization::saveMesh(mesh, path)) {
-				throw std::logic_error("Unable to store the cache object.");
-			}
-			const uint32_t fileSize = Util::FileUtils::fileSize(path);
+		// Do not block the other threads while writing the file.
+		lock.unlock();
+		if (!Rendering::Serialization::saveMesh(mesh.get(), path)) {
+			throw std::logic_error("Unable to store the cache object.");
+		}
+		const uint32_t fileSize = Util::FileUtils::fileSize(path);
+		lock.lock();
+
+		const auto savedObject = level->cacheObjectsToSave.find(objectToSave);
+		if(savedObject != level->cacheObjectsToSave.end() && savedObject->second.mesh.get() == mesh.get()) {
 			level->locations.insert(std::make_pair(objectToSave, std::make_pair(path, fileSize)));
-			level->cacheObjectsToSave.erase(level->cacheObjectsToSave.begin());
+			level->cacheObjectsToSave.erase(savedObject);
+		} else if(!Util::FileUtils::remove(path)) {
+			// The cache object has been removed while the file was written.
+			throw std::logic_error("Unable to delete the cache object.");
 		}
 	}
 	return nullptr;
 }
 
 void CacheLevelFiles::doAddCacheObject(CacheObject * object) {
+	// The references to the pending meshes are only changed while the lock is held.
 	std::lock_guard<std::mutex> lock(internalMutex);
 	Util::Reference<Rendering::Mesh> meshClone = getContext().getContent(object)->clone();
 	meshClone->setDataStrategy(Rendering::SimpleMeshDataStrategy::getPureLocalStrategy());
-	const bool inserted = cacheObjectsToSave.insert(std::make_pair(object, std::move(meshClone))).second;
+	const PendingObject pendingObject = {meshClone, false};
+	const bool inserted = cacheObjectsToSave.insert(std::make_pair(object, pendingObject)).second;
 	if(!inserted) {
 		throw std::logic_error("Cache object is already being saved.");
 	}
-	threadSemaphore.notify_all();
+	objectSizes[object] = sizeof(Rendering::Mesh)
+							+ meshClone->_getVertexData().getVertexCount() * meshClone->_getVertexData().getVertexDescription().getVertexSize()
+							+ meshClone->_getIndexData().getIndexCount() * sizeof(uint32_t);
+	saveQueue.push_back(object);
+	threadSemaphore.notify_one();
 }
 
 void CacheLevelFiles::doRemoveCacheObject(CacheObject * object) {
@@ -107,31 +129,44 @@ void CacheLevelFiles::doRemoveCacheObject(CacheObject * object) {
 		locations.erase(savedObject);
 	}
 	// Check if the cache object is waiting for being saved.
+	// If it is being saved at the moment, the worker thread deletes the file afterwards.
 	cacheObjectsToSave.erase(object);
+	objectSizes.erase(object);
 }
 
 bool CacheLevelFiles::doLoadCacheObject(CacheObject * object) {
-	{
-		std::lock_guard<std::mutex> lock(internalMutex);
-		// Check if the cache object is already saved.
-		const auto savedObject = locations.find(object);
-		if(savedObject != locations.cend()) {
-			const Util::FileName & path = savedObject->second.first;
-			Util::Reference<Rendering::Mesh> mesh = Rendering::Serialization::loadMesh(path);
-			if (mesh.isNull()) {
-				throw std::logic_error("Cache object could not be loaded.");
+	while(true) {
+		Util::FileName path;
+		{
+			std::lock_guard<std::mutex> lock(internalMutex);
+			// Check if the cache object is already saved.
+			const auto savedObject = locations.find(object);
+			if(savedObject == locations.cend()) {
+				// Check if the cache object is waiting for being saved.
+				const auto waitingObject = cacheObjectsToSave.find(object);
+				if(waitingObject != cacheObjectsToSave.cend()) {
+					Util::Reference<Rendering::Mesh> meshClone = waitingObject->second.mesh->clone();
+					meshClone->setDataStrategy(&getDataStrategy());
+					getContext().setContent(object, meshClone.get());
+					return true;
+				}
+				break;
 			}
-			getContext().setContent(object, mesh.get());
-			return true;
+			path = savedObject->second.first;
 		}
-		// Check if the cache object is waiting for being saved.
-		const auto waitingObject = cacheObjectsToSave.find(object);
-		if(waitingObject != cacheObjectsToSave.cend()) {
-			Util::Reference<Rendering::Mesh> meshClone = waitingObject->second.get()->clone();
-			meshClone->setDataStrategy(&getDataStrategy());
-			getContext().setContent(object, meshClone.get());
-			return true;
+		// Do not block the other threads while reading the file.
+		Util::Reference<Rendering::Mesh> mesh = Rendering::Serialization::loadMesh(path);
+		if (mesh.isNull()) {
+			std::lock_guard<std::mutex> lock(internalMutex);
+			const auto savedObject = locations.find(object);
+			if(savedObject != locations.cend() && savedObject->second.first == path) {
+				throw std::logic_error("Cache object could not be loaded.");
+			}
+			// The cache object has been removed in the meantime. Look it up again.
+			continue;
 		}
+		getContext().setContent(object, mesh.get());
+		return true;
 	}
 	// Load the missing object directly from the lower level cache level.
 	if(getLower() == nullptr) {
@@ -141,26 +176,17 @@ bool CacheLevelFiles::doLoadCacheObject(CacheObject * object) {
 		return false;
 	}
 
+	// The cache object has been loaded, even if another thread has changed the cache levels in the meantime.
 	const auto maxMemory = 0.95 * getOverallMemory();
-	removeUnimportantCacheObjects(maxMemory);
-	addCacheObject(object);
+	addLoadedCacheObject(object, maxMemory);
 	return true;
 }
 
 uint64_t CacheLevelFiles::getCacheObjectSize(CacheObject * object) const {
 	std::lock_guard<std::mutex> lock(internalMutex);
-	// Check if the cache object is already saved.
-	const auto savedObject = locations.find(object);
-	if(savedObject != locations.cend()) {
-		return savedObject->second.second;
-	}
-	// Check if the cache object is waiting for being saved.
-	const auto waitingObject = cacheObjectsToSave.find(object);
-	if(waitingObject != cacheObjectsToSave.cend()) {
-		const Rendering::Mesh * mesh = waitingObject->second.get();
-		return	sizeof(Rendering::Mesh)
-				+ mesh->_getVertexData().getVertexCount() * mesh->_getVertexData().getVertexDescription().getVertexSize()
-				+ mesh->_getIndexData().getIndexCount() * sizeof(uint32_t);
+	const auto objectSize = objectSizes.find(object);
+	if(objectSize != objectSizes.cend()) {
+		return objectSize->second;
 	}
 	return 0;
 }
@@ -192,10 +218,12 @@ void CacheLevelFiles::doVerify() const {
 #endif /* MINSG_EXT_OUTOFCORE_DEBUG */
 
 void CacheLevelFiles::init() {
-	std::lock_guard<std::mutex> lock(threadMutex);
+	std::lock_guard<std::mutex> lock(internalMutex);
 	if(!active) {
 		active = true;
-		thread = std::thread(std::bind(&CacheLevelFiles::threadRun, this));
+		for(uint_fast32_t i = 0; i < numWorkers; ++i) {
+			threads.emplace_back(std::bind(&CacheLevelFiles::threadRun, this));
+		}
 	}
 }
 
@@ -14,8 +14,10 @@
 
 #include "CacheLevel.h"
 #include <Util/IO/TemporaryDirectory.h>
+#include <Util/References.h>
 #include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -31,38 +33,63 @@ namespace OutOfCore {
 
 /**
  * Specialized cache level for storing cache objects in and retrieving cache objects from files.
+ * The files are written by several worker threads in the background, and the
+ * files are read without blocking the worker threads.
  *
  * @author Benjamin Eikel
  * @date 2011-02-23
  */
 class CacheLevelFiles : public CacheLevel {
 	private:
-		//! Guard for @a thread and @a active
-		std::mutex threadMutex;
-
-		//! Semaphore used to put the worker thread to sleep when there is no work to do.
+		//! Semaphore used to put the worker threads to sleep when there is no work to do.
 		std::condition_variable threadSemaphore;
 
-		//! Parallel thread of execution that is for writing cache objects to disk.
-		std::thread thread;
+		//! Parallel threads of execution that are used for writing cache objects to disk.
+		std::vector<std::thread> threads;
+
+		//! Number of worker threads that are started by init().
+		const uint32_t numWorkers;
 
-		//! Status of the cache level's thread.
+		//! Status of the cache level's threads.
 		bool active;
 
-		//! Helper function that is executed by the thread.
+		//! Helper function that is executed by the threads.
 		static void * threadRun(void * data);
 
 		//! Directory for storing the cache objects.
 		const Util::TemporaryDirectory cacheDir;
 
-		//! Guard for @a locations and @a cacheObjectsToSave
+		//! Guard for all following members and @a active
 		mutable std::mutex internalMutex;
 
 		//! Mapping from cache objects to their locations.
 		std::unordered_map<CacheObject *, std::pair<Util::FileName, uint32_t>> locations;
 
+		//! Copy of a cache object that has to be written to disk.
+		struct PendingObject {
+			Util::Reference<Rendering::Mesh> mesh;
+			//! @c true if a worker thread is currently writing the cache object.
+			bool saving;
+		};
+
 		//! Pending cache objects that have to be written to disk.
-		mutable std::unordered_map<CacheObject *, Util::Reference<Rendering::Mesh>> cacheObjectsToSave;
+		mutable std::unordered_map<CacheObject *, PendingObject> cacheObjectsToSave;
+
+		//! Order in which the pending cache objects are written. It may contain cache objects that have been removed in the meantime.
+		std::deque<CacheObject *> saveQueue;
+
+		/**
+		 * Counter that makes the file names unique. A cache object may be
+		 * removed and added again while its old file is still being written.
+		 */
+		uint64_t fileCounter;
+
+		/**
+		 * Size of the cache objects at the time they were added. It is used
+		 * for the memory accounting of this cache level, because it does not
+		 * change when the cache object has been written to disk.
+		 */
+		std::unordered_map<CacheObject *, uint64_t> objectSizes;
 
 		//! Create a file storing the cache object.
 		void doAddCacheObject(CacheObject * object) override;
@@ -77,7 +104,7 @@ class CacheLevelFiles : public CacheLevel {
 		void doWork() override {
 		}
 
-		//! Return the file size of the cache object.
+		//! Return the size of the cache object at the time it was added.
 		uint64_t getCacheObjectSize(CacheObject * object) const override;
 
 #ifdef MINSG_EXT_OUTOFCORE_DEBUG
@@ -85,10 +112,13 @@ class CacheLevelFiles : public CacheLevel {
 		void doVerify() const override;
 #endif /* MINSG_EXT_OUTOFCORE_DEBUG */
 	public:
-		CacheLevelFiles(uint64_t cacheSize, CacheContext & cacheContext);
+		//! Default number of worker threads that write cache objects to disk.
+		static const uint32_t DEFAULT_NUM_WORKERS = 2;
+
+		CacheLevelFiles(uint64_t cacheSize, CacheContext & cacheContext, uint32_t workerCount = DEFAULT_NUM_WORKERS);
 		virtual ~CacheLevelFiles();
 
-		//! Start the worker thread
+		//! Start the worker threads
 		void init() override;
 };
 
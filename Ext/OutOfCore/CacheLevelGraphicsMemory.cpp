@@ -20,6 +20,7 @@
 #include <Rendering/Mesh/VertexDescription.h>
 #include <Util/Timer.h>
 #include <cstddef>
+#include <mutex>
 #include <stdexcept>
 #include <utility>
 
@@ -98,6 +99,11 @@ void CacheLevelGraphicsMemory::doWork() {
 			// Prefetch
 			CacheObject * request = getContext().getMostImportantMissingObject(*this);
 			if(request != nullptr && getLower()->loadCacheObject(request)) {
+				std::lock_guard<std::mutex> transferLock(getContext().getTransferMutex());
+				if(!canAddLoadedCacheObject(request)) {
+					// A worker thread has removed the cache object from the lower cache level in the meantime.
+					continue;
+				}
 				const auto objectSize = getCacheObjectSize(request);
 				if(objectSize > 0.5 * getOverallMemory()) {
 					getCacheManager().removeLargeCacheObject(request, levelId, objectSize);
@@ -121,8 +127,7 @@ void CacheLevelGraphicsMemory::doWork() {
 				 * ==> 2 -> out, 4 -> out, 3 -> in
 				 * ==> next frame: reverse action 3 -> out, 2 -> in
 				 * add priority as parameter to removeUnimportantCacheObjects? */
-				removeUnimportantCacheObjects(maxMemory - getCacheObjectSize(request));
-				addCacheObject(request);
+				addLoadedCacheObject(request, maxMemory - getCacheObjectSize(request));
 			}
 			// No else: Cache object might have been removed from main memory in between.
 		} else {
@@ -17,6 +17,7 @@
 #include <Rendering/Mesh/MeshIndexData.h>
 #include <Rendering/Mesh/MeshVertexData.h>
 #include <Rendering/Mesh/VertexDescription.h>
+#include <algorithm>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
@@ -27,10 +28,13 @@
 namespace MinSG {
 namespace OutOfCore {
 
-CacheLevelMainMemory::CacheLevelMainMemory(uint64_t cacheSize, CacheContext & cacheContext) :
+const uint32_t CacheLevelMainMemory::DEFAULT_NUM_WORKERS;
+
+CacheLevelMainMemory::CacheLevelMainMemory(uint64_t cacheSize, CacheContext & cacheContext, uint32_t workerCount) :
 	CacheLevel(cacheSize, cacheContext), 
 	threadMutex(), threadSemaphore(),
-	thread(), active(false) {
+	threads(), numWorkers(std::max(workerCount, static_cast<uint32_t>(1))), active(false),
+	objectsInFlight() {
 }
 
 CacheLevelMainMemory::~CacheLevelMainMemory() {
@@ -39,55 +43,71 @@ CacheLevelMainMemory::~CacheLevelMainMemory() {
 		active = false;
 	}
 	threadSemaphore.notify_all();
-	thread.join();
+	for(auto & thread : threads) {
+		thread.join();
+	}
 }
 
 void * CacheLevelMainMemory::threadRun(void * data) {
 	CacheLevelMainMemory * level = static_cast<CacheLevelMainMemory *>(data);
-	const auto maxMemory = 0.95 * level->getOverallMemory();
-	while(true) {
-		if(level->getLower() == nullptr) {
-			continue;
-		}
-		bool workDone = false;
-		{
-			std::lock_guard<std::mutex> lock(level->threadMutex);
-			if(!level->active) {
-				break;
-			}
-
-			// Keep lock here to make sure that the thread is not stopped while working with an object.
-			if(level->getUsedMemory() < 0.8 * level->getOverallMemory()) {
-				// Prefetch
-				CacheObject * request = level->getContext().getMostImportantMissingObject(*level);
-				if(request != nullptr && level->getLower()->loadCacheObject(request)) {
-					const auto objectSize = level->getCacheObjectSize(request);
-					if(objectSize > 0.5 * level->getOverallMemory()) {
-						getCacheManager().removeLargeCacheObject(request, level->levelId, objectSize);
-					} else if(level->getUsedMemory() + objectSize < maxMemory) {
-						level->addCacheObject(request);
-					}
-					workDone = true;
-				}
-			} else if(!level->getContext().isTargetStateReached(*level)) {
-				CacheObject * request = level->getContext().getMostImportantMissingObject(*level);
-				if(request != nullptr && level->getLower()->loadCacheObject(request)) {
-					level->removeUnimportantCacheObjects(maxMemory - level->getCacheObjectSize(request));
-					level->addCacheObject(request);
-					workDone = true;
-				} else {
-					throw std::logic_error("Error loading cache object.");
+	std::vector<CacheObject *> candidates;
+	std::unique_lock<std::mutex> lock(level->threadMutex);
+	while(level->active) {
+		// Request the most important missing cache object that is not being loaded by another thread.
+		CacheObject * request = nullptr;
+		bool prefetch = false;
+		if(level->getLower() != nullptr) {
+			prefetch = level->getUsedMemory() < 0.8 * level->getOverallMemory();
+			candidates.clear();
+			// If the cache level is full, only cache objects that are more important than the stored ones are requested.
+			level->getContext().getMostImportantMissingObjects(*level, level->objectsInFlight.size() + 1, !prefetch, candidates);
+			for(const auto & candidate : candidates) {
+				if(std::find(level->objectsInFlight.cbegin(), level->objectsInFlight.cend(), candidate) == level->objectsInFlight.cend()) {
+					request = candidate;
+					break;
 				}
 			}
 		}
-		if(!workDone) {
-			std::unique_lock<std::mutex> lock(level->threadMutex);
+		if(request == nullptr) {
 			level->threadSemaphore.wait(lock);
+			continue;
 		}
+		level->objectsInFlight.push_back(request);
+
+		// Do not block the other threads while loading.
+		lock.unlock();
+		level->loadFromLower(request, prefetch);
+		lock.lock();
+
+		level->objectsInFlight.erase(std::find(level->objectsInFlight.begin(), level->objectsInFlight.end(), request));
 	}
 	return nullptr;
 }
 
+void CacheLevelMainMemory::loadFromLower(CacheObject * object, bool prefetch) {
+	if(!getLower()->loadCacheObject(object)) {
+		// Another thread has removed the cache object from the lower cache level before it could be loaded.
+		return;
+	}
+	const auto maxMemory = 0.95 * getOverallMemory();
+	std::lock_guard<std::mutex> transferLock(getContext().getTransferMutex());
+	if(!canAddLoadedCacheObject(object)) {
+		// Another thread has removed the cache object from the lower cache level in the meantime.
+		return;
+	}
+	const auto objectSize = getCacheObjectSize(object);
+	if(prefetch) {
+		if(objectSize > 0.5 * getOverallMemory()) {
+			getCacheManager().removeLargeCacheObject(object, levelId, objectSize);
+		} else if(getUsedMemory() + objectSize < maxMemory) {
+			addCacheObject(object);
+		}
+	} else {
+		removeUnimportantCacheObjects(maxMemory - objectSize);
+		addCacheObject(object);
+	}
+}
+
 void CacheLevelMainMemory::doAddCacheObject(CacheObject * object) {
 	Rendering::Mesh * mesh = getContext().getContent(object);
 	if (mesh->isUsingIndexData() && !mesh->_getIndexData().hasLocalData()) {
@@ -150,7 +170,9 @@ void CacheLevelMainMemory::init() {
 	std::lock_guard<std::mutex> lock(threadMutex);
 	if(!active) {
 		active = true;
-		thread = std::thread(std::bind(&CacheLevelMainMemory::threadRun, this));
+		for(uint_fast32_t i = 0; i < numWorkers; ++i) {
+			threads.emplace_back(std::bind(&CacheLevelMainMemory::threadRun, this));
+		}
 	}
 }
 
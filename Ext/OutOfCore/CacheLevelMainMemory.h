@@ -25,27 +25,43 @@ namespace OutOfCore {
 
 /**
  * Specialized cache level for storing cache objects in and retrieving cache objects from main memory (CPU memory).
+ * Several worker threads load the most important missing cache objects from
+ * the lower cache levels concurrently, so that multiple read requests are
+ * pending at the same time.
  *
  * @author Benjamin Eikel
  * @date 2011-02-23
  */
 class CacheLevelMainMemory : public CacheLevel {
 	private:
-		//! Guard for @a thread and @a active
+		//! Guard for @a threads, @a active, and @a objectsInFlight
 		std::mutex threadMutex;
 
-		//! Semaphore used to put the worker thread to sleep when there is no work to do.
+		//! Semaphore used to put the worker threads to sleep when there is no work to do.
 		std::condition_variable threadSemaphore;
 
-		//! Parallel thread of execution that is used to load cache objects from lower cache levels.
-		std::thread thread;
+		//! Parallel threads of execution that are used to load cache objects from lower cache levels.
+		std::vector<std::thread> threads;
 
-		//! Status of the cache level's thread.
+		//! Number of worker threads that are started by init().
+		const uint32_t numWorkers;
+
+		//! Status of the cache level's threads.
 		bool active;
 
-		//! Helper function that is executed by the thread.
+		//! Cache objects that are currently being loaded by the worker threads.
+		std::vector<CacheObject *> objectsInFlight;
+
+		//! Helper function that is executed by the threads.
 		static void * threadRun(void * data);
 
+		/**
+		 * Load a cache object from the lower cache level and add it to this
+		 * cache level. When prefetching, no cache objects are removed to make
+		 * room for it.
+		 */
+		void loadFromLower(CacheObject * object, bool prefetch);
+
 		//! Store the cache object in main memory.
 		void doAddCacheObject(CacheObject * object) override;
 
@@ -66,10 +82,13 @@ class CacheLevelMainMemory : public CacheLevel {
 		void doVerify() const override;
 #endif /* MINSG_EXT_OUTOFCORE_DEBUG */
 	public:
-		CacheLevelMainMemory(uint64_t cacheSize, CacheContext & cacheContext);
+		//! Default number of worker threads that load cache objects concurrently.
+		static const uint32_t DEFAULT_NUM_WORKERS = 4;
+
+		CacheLevelMainMemory(uint64_t cacheSize, CacheContext & cacheContext, uint32_t workerCount = DEFAULT_NUM_WORKERS);
 		virtual ~CacheLevelMainMemory();
 
-		//! Start the worker thread
+		//! Start the worker threads
 		void init() override;
 };
 
@@ -0,0 +1,333 @@
+/*
+	This file is part of the MinSG library extension OutOfCore.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_OUTOFCORE
+
+#include "CacheLevelPackedFiles.h"
+#include "CacheContext.h"
+#include "OutOfCore.h"
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshDataStrategy.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/FileUtils.h>
+#include <Util/References.h>
+#include <Util/StringUtils.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define MINSG_CACHELEVELPACKEDFILES_MMAP
+#endif
+
+namespace MinSG {
+namespace OutOfCore {
+
+//! Alignment of the extents inside the slabs in bytes.
+static const uint64_t extentAlignment = 64;
+
+const uint64_t CacheLevelPackedFiles::DEFAULT_SLAB_SIZE;
+
+/**
+ * File of fixed size that stores the data of cache objects. The file is mapped
+ * into memory if possible; otherwise, it is accessed with a file stream, which
+ * is guarded by a mutex. Reading and writing disjoint extents is thread-safe.
+ */
+class CacheLevelPackedFiles::Slab {
+	private:
+		const Util::FileName fileName;
+		const uint64_t size;
+		uint8_t * mapping;
+		std::fstream stream;
+		std::mutex streamMutex;
+
+	public:
+		Slab(Util::FileName _fileName, uint64_t _size) : fileName(std::move(_fileName)), size(_size), mapping(nullptr), stream(), streamMutex() {
+#ifdef MINSG_CACHELEVELPACKEDFILES_MMAP
+			const int fd = ::open(fileName.getPath().c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+			if(fd >= 0) {
+				if(::ftruncate(fd, static_cast<off_t>(size)) == 0) {
+					void * address = ::mmap(nullptr, static_cast<std::size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+					if(address != MAP_FAILED)
+						mapping = static_cast<uint8_t *>(address);
+				}
+				::close(fd);
+			}
+			if(mapping != nullptr)
+				return;
+#endif
+			stream.open(fileName.getPath(), std::ios_base::in | std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+			if(!stream.is_open() || !stream.seekp(static_cast<std::streamoff>(size - 1)) || !stream.put('\0')) {
+				throw std::logic_error("Unable to create the slab file \"" + fileName.toString() + "\".");
+			}
+		}
+
+		~Slab() {
+#ifdef MINSG_CACHELEVELPACKEDFILES_MMAP
+			if(mapping != nullptr)
+				::munmap(mapping, static_cast<std::size_t>(size));
+#endif
+			if(stream.is_open())
+				stream.close();
+			Util::FileUtils::remove(fileName);
+		}
+
+		Slab(const Slab &) = delete;
+		Slab & operator=(const Slab &) = delete;
+
+		const Util::FileName & getFileName() const {
+			return fileName;
+		}
+
+		void write(uint64_t offset, const uint8_t * data, std::size_t length) {
+			if(mapping != nullptr) {
+				std::copy(data, data + length, mapping + offset);
+				return;
+			}
+			std::lock_guard<std::mutex> lock(streamMutex);
+			if(!stream.seekp(static_cast<std::streamoff>(offset)) || !stream.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(length))) {
+				throw std::logic_error("Unable to store the cache object.");
+			}
+		}
+
+		void read(uint64_t offset, uint8_t * data, std::size_t length) {
+			if(mapping != nullptr) {
+				std::copy(mapping + offset, mapping + offset + length, data);
+				return;
+			}
+			std::lock_guard<std::mutex> lock(streamMutex);
+			if(!stream.seekg(static_cast<std::streamoff>(offset)) || !stream.read(reinterpret_cast<char *>(data), static_cast<std::streamsize>(length))) {
+				throw std::logic_error("Cache object could not be loaded.");
+			}
+		}
+};
+
+CacheLevelPackedFiles::CacheLevelPackedFiles(uint64_t cacheSize, CacheContext & cacheContext) :
+	CacheLevel(cacheSize, cacheContext),
+	cacheDir("MinSG_OutOfCore"),
+	slabSize(std::max<uint64_t>(std::min(cacheSize, DEFAULT_SLAB_SIZE), 1024 * 1024)),
+	internalMutex(),
+	slabs(), nextSlabFileNumber(0), nextGeneration(0),
+	allocator(slabSize),
+	vertexDescriptions(), storedObjects(), pendingObjects() {
+}
+
+CacheLevelPackedFiles::~CacheLevelPackedFiles() = default;
+
+std::size_t CacheLevelPackedFiles::getNumSlabs() const {
+	std::lock_guard<std::mutex> lock(internalMutex);
+	return allocator.getNumSlabs();
+}
+
+ExtentAllocator::Extent CacheLevelPackedFiles::allocate(uint64_t size) {
+	const ExtentAllocator::Extent extent = allocator.allocate(size);
+	if(extent.slab >= slabs.size() || slabs[extent.slab] == nullptr) {
+		const Util::FileName fileName(cacheDir.getPath().toString() + "/slab_" + Util::StringUtils::toString(nextSlabFileNumber++) + ".bin");
+		std::shared_ptr<Slab> slab;
+		try {
+			slab = std::make_shared<Slab>(fileName, allocator.getSlabSize(extent.slab));
+		} catch(...) {
+			allocator.free(extent, size);
+			throw;
+		}
+		if(extent.slab >= slabs.size()) {
+			slabs.resize(extent.slab + 1);
+		}
+		slabs[extent.slab] = std::move(slab);
+	}
+	return extent;
+}
+
+void CacheLevelPackedFiles::free(const ExtentAllocator::Extent & extent, uint64_t size) {
+	if(allocator.free(extent, size)) {
+		// A thread that is still reading from the slab keeps it alive.
+		slabs[extent.slab].reset();
+	}
+}
+
+void CacheLevelPackedFiles::doAddCacheObject(CacheObject * object) {
+	// Use the local data of the mesh directly; otherwise, download it into a local copy.
+	Util::Reference<Rendering::Mesh> mesh = getContext().getContent(object);
+	if(!mesh->_getVertexData().hasLocalData() || (mesh->isUsingIndexData() && !mesh->_getIndexData().hasLocalData())) {
+		mesh = mesh->clone();
+		mesh->setDataStrategy(Rendering::SimpleMeshDataStrategy::getPureLocalStrategy());
+		mesh->openVertexData();
+		mesh->openIndexData();
+	}
+	const Rendering::MeshVertexData & vertexData = mesh->_getVertexData();
+	const Rendering::MeshIndexData & indexData = mesh->_getIndexData();
+	const uint64_t vertexBytes = static_cast<uint64_t>(vertexData.getVertexCount()) * vertexData.getVertexDescription().getVertexSize();
+	const uint64_t indexBytes = static_cast<uint64_t>(indexData.getIndexCount()) * sizeof(uint32_t);
+
+	StoredObject stored;
+	std::shared_ptr<Slab> slab;
+	{
+		std::lock_guard<std::mutex> lock(internalMutex);
+		if(storedObjects.count(object) != 0 || pendingObjects.count(object) != 0) {
+			throw std::logic_error("Cache object is already stored.");
+		}
+		stored.size = std::max<uint64_t>((vertexBytes + indexBytes + extentAlignment - 1) / extentAlignment * extentAlignment, extentAlignment);
+		stored.vertexCount = vertexData.getVertexCount();
+		stored.indexCount = indexData.getIndexCount();
+		stored.drawMode = static_cast<uint32_t>(mesh->getDrawMode());
+		stored.useIndexData = mesh->isUsingIndexData();
+		const auto descriptionIt = std::find(vertexDescriptions.begin(), vertexDescriptions.end(), vertexData.getVertexDescription());
+		const std::size_t descriptionIndex = static_cast<std::size_t>(descriptionIt - vertexDescriptions.begin());
+		if(descriptionIndex > std::numeric_limits<uint16_t>::max()) {
+			throw std::overflow_error("Too many different vertex descriptions.");
+		}
+		stored.vertexDescription = static_cast<uint16_t>(descriptionIndex);
+		if(descriptionIt == vertexDescriptions.end()) {
+			vertexDescriptions.push_back(vertexData.getVertexDescription());
+		}
+		stored.extent = allocate(stored.size);
+		stored.generation = nextGeneration++;
+		slab = slabs[stored.extent.slab];
+		pendingObjects.emplace(object, stored);
+	}
+
+	// Do not block the other threads while copying the data. The extent is reserved, but the cache object is not stored yet.
+	try {
+		slab->write(stored.extent.offset, vertexData.data(), static_cast<std::size_t>(vertexBytes));
+		if(indexBytes > 0) {
+			slab->write(stored.extent.offset + vertexBytes, reinterpret_cast<const uint8_t *>(indexData.data()), static_cast<std::size_t>(indexBytes));
+		}
+	} catch(...) {
+		std::lock_guard<std::mutex> lock(internalMutex);
+		pendingObjects.erase(object);
+		free(stored.extent, stored.size);
+		throw;
+	}
+
+	std::lock_guard<std::mutex> lock(internalMutex);
+	pendingObjects.erase(object);
+	storedObjects.emplace(object, stored);
+}
+
+void CacheLevelPackedFiles::doRemoveCacheObject(CacheObject * object) {
+	std::lock_guard<std::mutex> lock(internalMutex);
+	const auto storedObject = storedObjects.find(object);
+	if(storedObject != storedObjects.cend()) {
+		free(storedObject->second.extent, storedObject->second.size);
+		storedObjects.erase(storedObject);
+	}
+}
+
+bool CacheLevelPackedFiles::doLoadCacheObject(CacheObject * object) {
+	while(true) {
+		StoredObject stored;
+		std::shared_ptr<Slab> slab;
+		Rendering::VertexDescription vertexDescription;
+		{
+			std::lock_guard<std::mutex> lock(internalMutex);
+			const auto storedObject = storedObjects.find(object);
+			if(storedObject == storedObjects.cend()) {
+				break;
+			}
+			stored = storedObject->second;
+			slab = slabs[stored.extent.slab];
+			vertexDescription = vertexDescriptions[stored.vertexDescription];
+		}
+		// Do not block the other threads while copying the data.
+		Util::Reference<Rendering::Mesh> mesh = new Rendering::Mesh(vertexDescription, stored.vertexCount, stored.indexCount);
+		mesh->setDrawMode(static_cast<Rendering::Mesh::draw_mode_t>(stored.drawMode));
+		mesh->setUseIndexData(stored.useIndexData);
+
+		const uint64_t vertexBytes = static_cast<uint64_t>(stored.vertexCount) * vertexDescription.getVertexSize();
+		Rendering::MeshVertexData & vertexData = mesh->_getVertexData();
+		slab->read(stored.extent.offset, vertexData.data(), static_cast<std::size_t>(vertexBytes));
+		if(stored.indexCount > 0) {
+			Rendering::MeshIndexData & indexData = mesh->_getIndexData();
+			slab->read(stored.extent.offset + vertexBytes, reinterpret_cast<uint8_t *>(indexData.data()), stored.indexCount * sizeof(uint32_t));
+		}
+		{
+			std::lock_guard<std::mutex> lock(internalMutex);
+			const auto storedObject = storedObjects.find(object);
+			if(storedObject == storedObjects.cend() || storedObject->second.generation != stored.generation) {
+				// The extent has been released in the meantime and the data may have been overwritten. Look it up again.
+				continue;
+			}
+		}
+		vertexData.updateBoundingBox();
+		vertexData.markAsChanged();
+		if(stored.indexCount > 0) {
+			Rendering::MeshIndexData & indexData = mesh->_getIndexData();
+			indexData.updateIndexRange();
+			indexData.markAsChanged();
+		}
+		getContext().setContent(object, mesh.get());
+		return true;
+	}
+	// Load the missing object directly from the lower level cache level.
+	if(getLower() == nullptr) {
+		throw std::logic_error("No lower cache level.");
+	}
+	if(!getLower()->loadCacheObject(object)) {
+		return false;
+	}
+
+	// The cache object has been loaded, even if another thread has changed the cache levels in the meantime.
+	const auto maxMemory = 0.95 * getOverallMemory();
+	addLoadedCacheObject(object, maxMemory);
+	return true;
+}
+
+uint64_t CacheLevelPackedFiles::getCacheObjectSize(CacheObject * object) const {
+	std::lock_guard<std::mutex> lock(internalMutex);
+	const auto storedObject = storedObjects.find(object);
+	return storedObject != storedObjects.cend() ? storedObject->second.size : 0;
+}
+
+#ifdef MINSG_EXT_OUTOFCORE_DEBUG
+void CacheLevelPackedFiles::doVerify() const {
+	std::lock_guard<std::mutex> lock(internalMutex);
+	std::vector<uint64_t> usage(slabs.size(), 0);
+	for(const auto & storedObject : storedObjects) {
+		const StoredObject & stored = storedObject.second;
+		if(stored.extent.slab >= slabs.size() || slabs[stored.extent.slab] == nullptr) {
+			throw std::logic_error("Cache object is stored in a removed slab.");
+		}
+		if(allocator.overlapsFreeExtent(stored.extent, stored.size)) {
+			throw std::logic_error("Cache object overlaps a free extent.");
+		}
+		usage[stored.extent.slab] += stored.size;
+	}
+	for(const auto & pendingObject : pendingObjects) {
+		usage[pendingObject.second.extent.slab] += pendingObject.second.size;
+	}
+	for(uint32_t slab = 0; slab < usage.size(); ++slab) {
+		if(usage[slab] != allocator.getSlabUsage(slab)) {
+			throw std::logic_error("Wrong slab usage.");
+		}
+	}
+	for(const auto & slab : slabs) {
+		if(slab != nullptr && !Util::FileUtils::isFile(slab->getFileName())) {
+			throw std::logic_error("Slab file does not exist.");
+		}
+	}
+	if(!allocator.isConsistent()) {
+		throw std::logic_error("Inconsistent free extents.");
+	}
+}
+#endif /* MINSG_EXT_OUTOFCORE_DEBUG */
+
+}
+}
+
+#endif /* MINSG_EXT_OUTOFCORE */
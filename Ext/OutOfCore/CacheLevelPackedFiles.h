@@ -0,0 +1,134 @@
+/*
+	This file is part of the MinSG library extension OutOfCore.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_OUTOFCORE
+
+#ifndef OUTOFCORE_CACHELEVELPACKEDFILES_H_
+#define OUTOFCORE_CACHELEVELPACKEDFILES_H_
+
+#include "CacheLevel.h"
+#include "ExtentAllocator.h"
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Util/IO/TemporaryDirectory.h>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace MinSG {
+namespace OutOfCore {
+
+/**
+ * Specialized cache level for storing cache objects in a few large slab files.
+ * In contrast to CacheLevelFiles, there is no file per cache object: the raw
+ * vertex and index data of all cache objects is packed into slab files of
+ * #slabSize bytes, which are mapped into memory if the platform supports it.
+ * Storing a cache object copies its data into a free extent of a slab, and
+ * loading it copies the data directly into the vertex and index data of the
+ * mesh, without parsing a mesh file. The vertex description, the counts, and
+ * the location of each cache object are kept in an index in main memory.
+ *
+ * Free extents are managed with a best-fit allocator that merges adjacent free
+ * extents (\see ExtentAllocator). If no free extent is large enough, a new slab
+ * file is created; slab files that become empty are removed again (except for
+ * the first one). The data is copied without holding the lock of the index: an
+ * extent is reserved under the lock, filled, and published under the lock again.
+ * A slab that is removed in the meantime stays mapped until the copy is finished.
+ */
+class CacheLevelPackedFiles : public CacheLevel {
+	private:
+		class Slab;
+
+		//! Location and layout of a cache object stored in a slab.
+		struct StoredObject {
+			ExtentAllocator::Extent extent;
+			uint64_t size;
+			//! Unique number of the store operation; used to detect a changed extent after copying the data.
+			uint64_t generation;
+			uint32_t vertexCount;
+			uint32_t indexCount;
+			uint32_t drawMode;
+			//! Index into @a vertexDescriptions
+			uint16_t vertexDescription;
+			bool useIndexData;
+		};
+
+		//! Directory for storing the slab files.
+		const Util::TemporaryDirectory cacheDir;
+
+		//! Size of a slab file in bytes; larger cache objects get a slab of their own.
+		const uint64_t slabSize;
+
+		//! Guard for all following members
+		mutable std::mutex internalMutex;
+
+		//! Slab files; entries of removed slabs are empty.
+		std::vector<std::shared_ptr<Slab>> slabs;
+
+		//! Number of the next slab file; the names are not reused while a removed slab may still be read.
+		uint32_t nextSlabFileNumber;
+
+		//! Number of the next store operation.
+		uint64_t nextGeneration;
+
+		//! Free extents of the slabs.
+		ExtentAllocator allocator;
+
+		//! Vertex descriptions of the stored cache objects; a mesh layout is usually shared by many cache objects.
+		std::vector<Rendering::VertexDescription> vertexDescriptions;
+
+		//! Index of the stored cache objects.
+		std::unordered_map<CacheObject *, StoredObject> storedObjects;
+
+		//! Cache objects whose data is being copied into their reserved extents; they are moved to @a storedObjects afterwards.
+		std::unordered_map<CacheObject *, StoredObject> pendingObjects;
+
+		//! Allocate an extent of the given size; a new slab file is created if necessary.
+		ExtentAllocator::Extent allocate(uint64_t size);
+
+		//! Return an extent to the allocator; the slab file is released if the slab has been removed.
+		void free(const ExtentAllocator::Extent & extent, uint64_t size);
+
+		//! Copy the data of the cache object into a slab.
+		void doAddCacheObject(CacheObject * object) override;
+
+		//! Release the extent of the cache object.
+		void doRemoveCacheObject(CacheObject * object) override;
+
+		//! Copy the data of a cache object from its slab into the mesh.
+		bool doLoadCacheObject(CacheObject * object) override;
+
+		//! Do nothing
+		void doWork() override {
+		}
+
+		//! Return the size of the extent of the cache object.
+		uint64_t getCacheObjectSize(CacheObject * object) const override;
+
+#ifdef MINSG_EXT_OUTOFCORE_DEBUG
+		//! Check all cache objects stored in this cache level for inconsistencies.
+		void doVerify() const override;
+#endif /* MINSG_EXT_OUTOFCORE_DEBUG */
+	public:
+		//! Default size of a slab file in bytes.
+		static const uint64_t DEFAULT_SLAB_SIZE = 256 * 1024 * 1024;
+
+		CacheLevelPackedFiles(uint64_t cacheSize, CacheContext & cacheContext);
+		virtual ~CacheLevelPackedFiles();
+
+		//! Return the number of slab files.
+		std::size_t getNumSlabs() const;
+};
+
+}
+}
+
+#endif /* OUTOFCORE_CACHELEVELPACKEDFILES_H_ */
+
+#endif /* MINSG_EXT_OUTOFCORE */
@@ -10,22 +10,32 @@
 
 #include "CacheManager.h"
 #include "CacheLevel.h"
+#include "CacheLevelCompressedMemory.h"
 #include "CacheLevelFiles.h"
 #include "CacheLevelFileSystem.h"
 #include "CacheLevelGraphicsMemory.h"
 #include "CacheLevelMainMemory.h"
+#include "CacheLevelPackedFiles.h"
 #include "CacheObject.h"
 #include "Definitions.h"
 #include "OutOfCore.h"
+#include "../../Core/Nodes/GeometryNode.h"
 #include "../../Core/Statistics.h"
+#include "../../Helper/StdNodeVisitors.h"
 #include <Util/Macros.h>
 #include <Util/StringUtils.h>
 #include <Rendering/Mesh/MeshDataStrategy.h>
 #include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Geometry/Box.h>
 #include <Rendering/Serialization/Serialization.h>
+#include <algorithm>
 #include <cstdint>
+#include <iostream>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -36,8 +46,9 @@ namespace MinSG {
 namespace OutOfCore {
 
 CacheManager::CacheManager() :
-		objects(), context(),
-		meshToObject(), levels(), frameNumber(0) {
+		objects(), removedObjects(), largeObjects(), largeObjectsMutex(), context(),
+		meshToObject(), levels(), frameNumber(0), prefetcher(context),
+		displayedMeshes(0), missingMeshes(0), prefetchedObjects(0) {
 	levels.reserve(maxNumCacheLevels);
 }
 
@@ -68,9 +79,15 @@ void CacheManager::meshDisplay(Rendering::Mesh * mesh) {
 	}
 	CacheObject * object = it->second;
 	context.updateFrameNumber(object, frameNumber);
+
+	++displayedMeshes;
+	const Rendering::MeshVertexData & vertexData = mesh->_getVertexData();
+	if(vertexData.empty() || (!vertexData.isUploaded() && !vertexData.hasLocalData())) {
+		++missingMeshes;
+	}
 }
 
-cacheLevelId_t CacheManager::addCacheLevel(CacheLevelType type, uint64_t size) {
+cacheLevelId_t CacheManager::addCacheLevel(CacheLevelType type, uint64_t size, uint32_t numWorkers, uint32_t positionBits) {
 	if (levels.size() == maxNumCacheLevels) {
 		throw std::logic_error("Adding cache level failed. The maximum number of cache levels has been exceeded.");
 	}
@@ -83,14 +100,20 @@ cacheLevelId_t CacheManager::addCacheLevel(CacheLevelType type, uint64_t size) {
 			levels.emplace_back(new CacheLevelFileSystem(context));
 			break;
 		case CacheLevelType::FILES:
-			levels.emplace_back(new CacheLevelFiles(size, context));
+			levels.emplace_back(new CacheLevelFiles(size, context, numWorkers == 0 ? CacheLevelFiles::DEFAULT_NUM_WORKERS : numWorkers));
 			break;
 		case CacheLevelType::MAIN_MEMORY:
-			levels.emplace_back(new CacheLevelMainMemory(size, context));
+			levels.emplace_back(new CacheLevelMainMemory(size, context, numWorkers == 0 ? CacheLevelMainMemory::DEFAULT_NUM_WORKERS : numWorkers));
 			break;
 		case CacheLevelType::GRAPHICS_MEMORY:
 			levels.emplace_back(new CacheLevelGraphicsMemory(size, context));
 			break;
+		case CacheLevelType::PACKED_FILES:
+			levels.emplace_back(new CacheLevelPackedFiles(size, context));
+			break;
+		case CacheLevelType::COMPRESSED_MEMORY:
+			levels.emplace_back(new CacheLevelCompressedMemory(size, context, positionBits));
+			break;
 		default:
 			throw std::invalid_argument("Adding cache level failed. Invalid cache level type.");
 	}
@@ -110,7 +133,11 @@ void CacheManager::clear() {
 		rIt->reset();
 	}
 	levels.clear();
+	prefetcher.clear();
 	objects.clear();
+	// The worker threads have been stopped with the cache levels.
+	removedObjects.clear();
+	largeObjects.clear();
 }
 
 void CacheManager::addFileSystemObject(Rendering::Mesh * mesh) {
@@ -128,45 +155,86 @@ void CacheManager::addFileSystemObject(Rendering::Mesh * mesh) {
 	}
 	auto object = new CacheObject(mesh);
 	objects.emplace_back(object);
-	context.addObject(object);
 	meshToObject.insert(std::make_pair(mesh, object));
+	prefetcher.addObject(object, mesh->getBoundingBox());
 	level->addCacheObject(object);
+	// The worker threads of the cache levels may request the cache object as soon as the context knows it.
+	context.addObject(object);
 }
 
-void CacheManager::removeLargeCacheObject(CacheObject * object, cacheLevelId_t levelId, uint64_t size) {
-	Rendering::Mesh * mesh = context.getContent(object);
-
-	Util::Reference<Rendering::Mesh> newMesh = Rendering::Serialization::loadMesh(mesh->getFileName());
-	if (newMesh.isNull()) {
-		throw std::logic_error("Mesh could not be loaded.");
+void CacheManager::updatePrefetchBoundingBoxes(Node * root) {
+	std::unordered_map<CacheObject *, Geometry::Box> worldBoxes;
+	for(const auto & geoNode : collectNodes<GeometryNode>(root)) {
+		const auto it = meshToObject.find(geoNode->getMesh());
+		if(it == meshToObject.end()) {
+			continue;
+		}
+		const auto result = worldBoxes.emplace(it->second, geoNode->getWorldBB());
+		if(!result.second) {
+			result.first->second.include(geoNode->getWorldBB());
+		}
 	}
-	newMesh->setDataStrategy(Rendering::SimpleMeshDataStrategy::getPureLocalStrategy());
+	for(const auto & worldBox : worldBoxes) {
+		prefetcher.setBoundingBox(worldBox.first, worldBox.second);
+	}
+}
 
-	mesh->setDataStrategy(Rendering::SimpleMeshDataStrategy::getPureLocalStrategy());
-	meshToObject.erase(mesh);
-	for(const auto & level : levels) {
-		level->removeCacheObject(object);
+void CacheManager::removeLargeCacheObject(CacheObject * object, cacheLevelId_t levelId, uint64_t size) {
+	// Remove the cache object from top to bottom. Afterwards, it is not requested anymore.
+	for(auto rIt = levels.rbegin(); rIt != levels.rend(); ++rIt) {
+		if(context.isObjectStoredInLevel(object, **rIt)) {
+			(*rIt)->removeCacheObject(object);
+		}
 	}
 	context.removeObject(object);
-	objects.erase(std::remove_if(objects.begin(), 
-								 objects.end(), 
-								 [&object](const std::unique_ptr<CacheObject> & candidate) { return candidate.get() == object; }),
-				  objects.end());
 
-	mesh->swap(*newMesh.get());
+	std::lock_guard<std::mutex> lock(largeObjectsMutex);
+	largeObjects.push_back({object, levelId, size});
+}
+
+void CacheManager::replaceLargeCacheObjectMeshes() {
+	std::vector<LargeCacheObject> removals;
+	{
+		std::lock_guard<std::mutex> lock(largeObjectsMutex);
+		removals.swap(largeObjects);
+	}
+	for(const auto & removal : removals) {
+		CacheObject * object = removal.object;
+		Rendering::Mesh * mesh = context.getContent(object);
+		meshToObject.erase(mesh);
+		prefetcher.removeObject(object);
+		const auto objectIt = std::find_if(objects.begin(), objects.end(),
+										   [object](const std::unique_ptr<CacheObject> & candidate) { return candidate.get() == object; });
+		removedObjects.emplace_back(std::move(*objectIt));
+		objects.erase(objectIt);
+
+		mesh->setDataStrategy(Rendering::SimpleMeshDataStrategy::getPureLocalStrategy());
+		Util::Reference<Rendering::Mesh> newMesh = Rendering::Serialization::loadMesh(mesh->getFileName());
+		if(newMesh.isNull()) {
+			WARN("Mesh could not be loaded: " + mesh->getFileName().toString());
+			continue;
+		}
+		newMesh->setDataStrategy(Rendering::SimpleMeshDataStrategy::getPureLocalStrategy());
+		// A worker thread may still be loading the removed cache object.
+		context.lockContentMutex();
+		mesh->swap(*newMesh.get());
+		context.unlockContentMutex();
 
-	std::cout	<< "Warning: Cache object is too large for cache level " << static_cast<int>(levelId) << ".\n"
-				<< "         Size: " << size << " Bytes, File: " << mesh->getFileName() << '\n'
-				<< "         The cache object has been removed from the out-of-core system." << std::endl;
+		std::cout	<< "Warning: Cache object is too large for cache level " << static_cast<int>(removal.levelId) << ".\n"
+					<< "         Size: " << removal.size << " Bytes, File: " << mesh->getFileName() << '\n'
+					<< "         The cache object has been removed from the out-of-core system." << std::endl;
+	}
 }
 
-void CacheManager::trigger() {
-	std::vector<CacheLevel *> levelsCopy;
-	levelsCopy.reserve(levels.size());
-	for(const auto & level : levels) {
-		levelsCopy.push_back(level.get());
+void CacheManager::prefetch(const Geometry::Frustum & frustum) {
+	if(levels.empty()) {
+		return;
 	}
-	context.onEndFrame(levelsCopy);
+	prefetchedObjects += prefetcher.prefetch(frustum, frameNumber);
+}
+
+void CacheManager::trigger() {
+	context.onEndFrame();
 
 	for(const auto & level : levels) {
 		try {
@@ -175,6 +243,7 @@ void CacheManager::trigger() {
 			WARN("Failure in cache level " + Util::StringUtils::toString<uint32_t>(level->getLevelId()) + ":\n" + e.what());
 		}
 	}
+	replaceLargeCacheObjectMeshes();
 	++frameNumber;
 }
 
@@ -190,6 +259,31 @@ void CacheManager::updateStatistics(Statistics & statistics) {
 	for(cacheLevelId_t level = 0; level < levels.size(); ++level) {
 		statistics.setValue(counterKeys[level], static_cast<double>(levels[level]->getUsedMemory()) / mebibyte);
 	}
+
+	static const uint32_t displayedMeshesKey = statistics.addCounter("Cache: Meshes displayed", "1");
+	static const uint32_t missingMeshesKey = statistics.addCounter("Cache: Meshes missing when displayed", "1");
+	static const uint32_t hitRateKey = statistics.addCounter("Cache: Hit rate", "%");
+	static const uint32_t prefetchedObjectsKey = statistics.addCounter("Cache: Objects prefetched", "1");
+	statistics.setValue(displayedMeshesKey, displayedMeshes);
+	statistics.setValue(missingMeshesKey, missingMeshes);
+	statistics.setValue(hitRateKey, displayedMeshes == 0 ? 100.0 : 100.0 * static_cast<double>(displayedMeshes - missingMeshes) / static_cast<double>(displayedMeshes));
+	statistics.setValue(prefetchedObjectsKey, prefetchedObjects);
+
+	for(auto & level : levels) {
+		CacheLevelCompressedMemory * compressedLevel = dynamic_cast<CacheLevelCompressedMemory *>(level.get());
+		if(compressedLevel != nullptr) {
+			static const uint32_t compressionRatioKey = statistics.addCounter("Cache: Compression ratio", "1");
+			static const uint32_t decompressedObjectsKey = statistics.addCounter("Cache: Meshes decompressed", "1");
+			static const uint32_t decompressionTimeKey = statistics.addCounter("Cache: Decompression time", "ms");
+			statistics.setValue(compressionRatioKey, compressedLevel->getCompressionRatio());
+			statistics.setValue(decompressedObjectsKey, compressedLevel->getDecompressedObjects());
+			statistics.setValue(decompressionTimeKey, compressedLevel->getDecompressionTime());
+			compressedLevel->resetDecompressionStatistics();
+		}
+	}
+	displayedMeshes = 0;
+	missingMeshes = 0;
+	prefetchedObjects = 0;
 }
 
 }
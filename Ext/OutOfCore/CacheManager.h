@@ -12,10 +12,13 @@
 #define OUTOFCORE_CACHEMANAGER_H_
 
 #include "CacheContext.h"
+#include "CacheLevelCompressedMemory.h"
 #include "Definitions.h"
+#include "Prefetcher.h"
 #include <cstdint>
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -23,6 +26,7 @@ namespace Rendering {
 class Mesh;
 }
 namespace MinSG {
+class Node;
 class Statistics;
 namespace OutOfCore {
 class CacheLevel;
@@ -40,6 +44,22 @@ class CacheManager {
 		//! Container for cache objects.
 		std::deque<std::unique_ptr<CacheObject>> objects;
 
+		//! Cache objects removed by @a removeLargeCacheObject(). They are kept until @a clear(), because worker threads may still access them.
+		std::vector<std::unique_ptr<CacheObject>> removedObjects;
+
+		//! Cache object reported by @a removeLargeCacheObject() whose mesh has not been replaced yet.
+		struct LargeCacheObject {
+			CacheObject * object;
+			cacheLevelId_t levelId;
+			uint64_t size;
+		};
+
+		//! Large cache objects whose meshes are replaced in the next call of @a trigger().
+		std::vector<LargeCacheObject> largeObjects;
+
+		//! Mutex protecting @a largeObjects, which is filled by worker threads.
+		std::mutex largeObjectsMutex;
+
 		//! Structure holding shared global information.
 		CacheContext context;
 
@@ -52,6 +72,26 @@ class CacheManager {
 		//! Frame counter that is incremented by one for each call of @a trigger().
 		uint32_t frameNumber;
 
+		//! Prediction of the cache objects that are needed in the next frames.
+		Prefetcher prefetcher;
+
+		//! Number of calls of @a meshDisplay() since the last call of @a updateStatistics().
+		uint32_t displayedMeshes;
+
+		//! Number of calls of @a meshDisplay() for meshes whose data was not available, since the last call of @a updateStatistics().
+		uint32_t missingMeshes;
+
+		//! Number of cache objects raised by @a prefetcher since the last call of @a updateStatistics().
+		uint32_t prefetchedObjects;
+
+		/**
+		 * Unregister the meshes of the cache objects in @a largeObjects and
+		 * replace their data by the data loaded from their files. This is
+		 * done in the thread calling @a trigger(), because the meshes and the
+		 * data structures of the manager are used for rendering.
+		 */
+		void replaceLargeCacheObjectMeshes();
+
 	public:
 		CacheManager();
 
@@ -87,10 +127,18 @@ class CacheManager {
 		 *
 		 * @param type Type of the cache level to add
 		 * @param size Size of the cache level in bytes
+		 * @param numWorkers Number of worker threads of the cache level, or
+		 * zero for the default of its type. Only the cache levels of type
+		 * CacheLevelType::FILES and CacheLevelType::MAIN_MEMORY have worker
+		 * threads.
+		 * @param positionBits Number of bits per position component used by a
+		 * cache level of type CacheLevelType::COMPRESSED_MEMORY for encoding the
+		 * meshes, or zero for lossless encoding. It is ignored for other types.
 		 * @return Identifier of the new cache level
 		 * @throw std::exception if an error occurred
 		 */
-		cacheLevelId_t addCacheLevel(CacheLevelType type, uint64_t size);
+		cacheLevelId_t addCacheLevel(CacheLevelType type, uint64_t size, uint32_t numWorkers = 0,
+									 uint32_t positionBits = CacheLevelCompressedMemory::DEFAULT_POSITION_BITS);
 
 		//! Remove all cache levels and cache objects.
 		void clear();
@@ -116,11 +164,28 @@ class CacheManager {
 		 */
 		void addFileSystemObject(Rendering::Mesh * mesh);
 
+		/**
+		 * Use the world-space bounding boxes of the geometry nodes in the
+		 * given subtree for prefetching. A cache object is registered with
+		 * the bounding box of its mesh, because the transformations of its
+		 * geometry nodes are unknown at that time. Therefore, this function
+		 * has to be called after a scene has been loaded, and after geometry
+		 * nodes have been moved. If a mesh is used by several geometry nodes,
+		 * the union of their bounding boxes is used.
+		 *
+		 * @param root Root node of the scene
+		 */
+		void updatePrefetchBoundingBoxes(Node * root);
+
 		/**
 		 * Remove a cache object that is too large for the cache system. A
 		 * warning message is generated for it and output on stdout. The cache
-		 * object is remove from all entities in the out-of-core system and
-		 * its data strategy is changed
+		 * object is removed from all cache levels and the context immediately.
+		 * Its mesh is unregistered, and its data strategy is changed, in the
+		 * next call of @a trigger().
+		 *
+		 * @note This function may be called by the worker threads of the
+		 * cache levels while the transfer mutex of the context is locked.
 		 * 
 		 * @param object Cache object that is too large
 		 * @param levelId Cache level that reports the large cache object
@@ -130,6 +195,16 @@ class CacheManager {
 									cacheLevelId_t levelId,
 									uint64_t size);
 
+		/**
+		 * Raise the priority of the cache objects that are expected to become
+		 * visible in the next frames, based on the movement of the camera.
+		 * This function is called by a frame listener before @a trigger().
+		 *
+		 * @param frustum Current frustum of the camera in world coordinates
+		 * @see Prefetcher
+		 */
+		void prefetch(const Geometry::Frustum & frustum);
+
 		/**
 		 * Do the real work here: Swap cache objects in and out.
 		 * This function is called by a frame listener before each frame.
@@ -137,7 +212,10 @@ class CacheManager {
 		void trigger();
 
 		/**
-		 * Tell the statistics object the fill levels of the cache levels.
+		 * Tell the statistics object the fill levels of the cache levels, the
+		 * number of displayed and missing meshes, the hit rate, and the number
+		 * of prefetched cache objects. The counts refer to the time since the
+		 * previous call.
 		 *
 		 * @param statistics Statistics object.
 		 */
@@ -147,6 +225,11 @@ class CacheManager {
 		CacheContext & getCacheContext() {
 			return context;
 		}
+
+		//! Access the prefetcher to configure it.
+		Prefetcher & getPrefetcher() {
+			return prefetcher;
+		}
 };
 
 }
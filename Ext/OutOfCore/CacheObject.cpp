@@ -15,7 +15,7 @@ namespace MinSG {
 namespace OutOfCore {
 
 CacheObject::CacheObject(Rendering::Mesh * mesh) :
-	content(mesh), priority(), highestLevelStored(0), updated(true) {
+	content(mesh), priority(), highestLevelStored(0), updated(true), removed(false), heapPositions() {
 }
 
 CacheObject::~CacheObject() = default;
@@ -34,6 +34,7 @@ namespace OutOfCore {
 class CacheObject {
 	private:
 		friend class CacheContext;
+		friend class CacheObjectHeap;
 		friend struct CacheObjectCompare;
 
 		//! Content of the capsule that is the real data stored in memory.
@@ -48,6 +49,12 @@ class CacheObject {
 		//! Flag storing if the cache object was changed in the current frame.
 		bool updated;
 
+		//! Flag storing if the cache object has been removed from the context. Its priority is not changed anymore.
+		bool removed;
+
+		//! Positions inside of the CacheObjectHeap of each order that contains this cache object.
+		uint32_t heapPositions[2];
+
 		CacheObject(const CacheObject &) = delete;
 		CacheObject(CacheObject &&) = delete;
 		CacheObject & operator=(const CacheObject &) = delete;
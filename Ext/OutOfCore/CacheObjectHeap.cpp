@@ -0,0 +1,125 @@
+/*
+	This file is part of the MinSG library extension OutOfCore.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_OUTOFCORE
+
+#include "CacheObjectHeap.h"
+#include "CacheObject.h"
+#include <algorithm>
+
+namespace MinSG {
+namespace OutOfCore {
+
+CacheObjectHeap::CacheObjectHeap(order_t heapOrder) :
+	entries(), order(heapOrder) {
+}
+
+uint32_t & CacheObjectHeap::positionOf(CacheObject * object) const {
+	return object->heapPositions[static_cast<uint8_t>(order)];
+}
+
+void CacheObjectHeap::place(std::size_t index, const Entry & entry) {
+	entries[index] = entry;
+	positionOf(entry.object) = static_cast<uint32_t>(index);
+}
+
+void CacheObjectHeap::siftUp(std::size_t index, const Entry & entry) {
+	while(index > 0) {
+		const std::size_t parent = (index - 1) / 2;
+		if(!isBefore(entry, entries[parent])) {
+			break;
+		}
+		place(index, entries[parent]);
+		index = parent;
+	}
+	place(index, entry);
+}
+
+void CacheObjectHeap::siftDown(std::size_t index, const Entry & entry) {
+	const std::size_t count = entries.size();
+	while(true) {
+		std::size_t child = 2 * index + 1;
+		if(child >= count) {
+			break;
+		}
+		if(child + 1 < count && isBefore(entries[child + 1], entries[child])) {
+			++child;
+		}
+		if(!isBefore(entries[child], entry)) {
+			break;
+		}
+		place(index, entries[child]);
+		index = child;
+	}
+	place(index, entry);
+}
+
+void CacheObjectHeap::push(CacheObject * object, const CacheObjectPriority & priority) {
+	const Entry entry = {priority, object};
+	entries.push_back(entry);
+	siftUp(entries.size() - 1, entry);
+}
+
+void CacheObjectHeap::update(CacheObject * object, const CacheObjectPriority & priority) {
+	const std::size_t index = positionOf(object);
+	const Entry entry = {priority, object};
+	if(index > 0 && isBefore(entry, entries[(index - 1) / 2])) {
+		siftUp(index, entry);
+	} else {
+		siftDown(index, entry);
+	}
+}
+
+void CacheObjectHeap::erase(CacheObject * object) {
+	const std::size_t index = positionOf(object);
+	const Entry last = entries.back();
+	entries.pop_back();
+	if(index == entries.size()) {
+		// The last entry has been removed.
+		return;
+	}
+	if(index > 0 && isBefore(last, entries[(index - 1) / 2])) {
+		siftUp(index, last);
+	} else {
+		siftDown(index, last);
+	}
+}
+
+void CacheObjectHeap::collectObjects(std::vector<CacheObject *> & objects) const {
+	objects.reserve(objects.size() + entries.size());
+	for(const auto & entry : entries) {
+		objects.push_back(entry.object);
+	}
+}
+
+void CacheObjectHeap::collectTopObjects(std::size_t count, std::vector<std::pair<CacheObjectPriority, CacheObject *>> & objects) const {
+	// The candidates form the frontier of the already collected subtree. Only
+	// the indices are stored and ordered as a heap with the first entry on top.
+	std::vector<std::size_t> candidates;
+	const auto compare = [this](std::size_t a, std::size_t b) {
+		return isBefore(entries[b], entries[a]);
+	};
+	if(!entries.empty()) {
+		candidates.push_back(0);
+	}
+	for(std::size_t collected = 0; collected < count && !candidates.empty(); ++collected) {
+		std::pop_heap(candidates.begin(), candidates.end(), compare);
+		const std::size_t index = candidates.back();
+		candidates.pop_back();
+		objects.emplace_back(entries[index].priority, entries[index].object);
+		for(std::size_t child = 2 * index + 1; child <= 2 * index + 2 && child < entries.size(); ++child) {
+			candidates.push_back(child);
+			std::push_heap(candidates.begin(), candidates.end(), compare);
+		}
+	}
+}
+
+}
+}
+
+#endif /* MINSG_EXT_OUTOFCORE */
@@ -0,0 +1,123 @@
+/*
+	This file is part of the MinSG library extension OutOfCore.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_OUTOFCORE
+
+#ifndef OUTOFCORE_CACHEOBJECTHEAP_H_
+#define OUTOFCORE_CACHEOBJECTHEAP_H_
+
+#include "CacheObjectPriority.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace MinSG {
+namespace OutOfCore {
+class CacheObject;
+
+/**
+ * Addressable binary heap of cache objects ordered by their priority.
+ * The position of a cache object inside of the heap is stored in the cache
+ * object itself. Therefore, the priority of an arbitrary cache object can be
+ * changed and a cache object can be removed in O(log n).
+ *
+ * The heap stores a copy of the priority of each cache object. The priority
+ * stored in the cache object may change without affecting the heap until
+ * update() is called. Equal priorities are ordered by the address of the cache
+ * objects, which results in the same order as CacheObjectCompare.
+ *
+ * A cache object can be contained in at most one heap of each order.
+ * The class is not thread-safe.
+ */
+class CacheObjectHeap {
+	public:
+		enum class order_t : uint8_t {
+			MOST_IMPORTANT_FIRST = 0,
+			LEAST_IMPORTANT_FIRST = 1
+		};
+
+		explicit CacheObjectHeap(order_t heapOrder);
+
+		bool empty() const {
+			return entries.empty();
+		}
+		std::size_t size() const {
+			return entries.size();
+		}
+
+		//! Return the first cache object. The heap must not be empty.
+		CacheObject * top() const {
+			return entries.front().object;
+		}
+		//! Return the priority of the first cache object. The heap must not be empty.
+		const CacheObjectPriority & topPriority() const {
+			return entries.front().priority;
+		}
+
+		//! Return the priority stored for a cache object contained in this heap.
+		const CacheObjectPriority & getPriority(CacheObject * object) const {
+			return entries[positionOf(object)].priority;
+		}
+
+		//! Insert a cache object that is not contained in a heap of this order.
+		void push(CacheObject * object, const CacheObjectPriority & priority);
+
+		//! Change the priority of a cache object contained in this heap.
+		void update(CacheObject * object, const CacheObjectPriority & priority);
+
+		//! Remove a cache object contained in this heap.
+		void erase(CacheObject * object);
+
+		//! Append all cache objects in heap order (not sorted) to @p objects.
+		void collectObjects(std::vector<CacheObject *> & objects) const;
+
+		/**
+		 * Append the first @p count cache objects together with their
+		 * priorities in sorted order to @p objects. The cost is
+		 * O(count log count), independent of the size of the heap.
+		 */
+		void collectTopObjects(std::size_t count, std::vector<std::pair<CacheObjectPriority, CacheObject *>> & objects) const;
+
+		//! Return @c true if cache object @p a with priority @p prioA is ranked before cache object @p b with priority @p prioB.
+		static bool isMoreImportant(const CacheObjectPriority & prioA, const CacheObject * a,
+									const CacheObjectPriority & prioB, const CacheObject * b) {
+			return prioB < prioA || (!(prioA < prioB) && b < a);
+		}
+
+	private:
+		struct Entry {
+			CacheObjectPriority priority;
+			CacheObject * object;
+		};
+
+		std::vector<Entry> entries;
+		const order_t order;
+
+		//! Return @c true if @p a has to be closer to the top than @p b.
+		bool isBefore(const Entry & a, const Entry & b) const {
+			return order == order_t::MOST_IMPORTANT_FIRST ?
+					isMoreImportant(a.priority, a.object, b.priority, b.object) :
+					isMoreImportant(b.priority, b.object, a.priority, a.object);
+		}
+
+		uint32_t & positionOf(CacheObject * object) const;
+
+		//! Store @p entry at @p index and update the position stored in the cache object.
+		void place(std::size_t index, const Entry & entry);
+
+		void siftUp(std::size_t index, const Entry & entry);
+		void siftDown(std::size_t index, const Entry & entry);
+};
+
+}
+}
+
+#endif /* OUTOFCORE_CACHEOBJECTHEAP_H_ */
+
+#endif /* MINSG_EXT_OUTOFCORE */
@@ -29,7 +29,9 @@ enum class CacheLevelType : uint32_t {
 	FILE_SYSTEM = 1,		//!< @see CacheLevelFileSystem
 	FILES = 2,				//!< @see CacheLevelFiles
 	MAIN_MEMORY = 3,		//!< @see CacheLevelMainMemory
-	GRAPHICS_MEMORY = 4		//!< @see CacheLevelGraphicsMemory
+	GRAPHICS_MEMORY = 4,	//!< @see CacheLevelGraphicsMemory
+	PACKED_FILES = 5,		//!< @see CacheLevelPackedFiles
+	COMPRESSED_MEMORY = 6	//!< @see CacheLevelCompressedMemory
 };
 
 }
@@ -0,0 +1,142 @@
+/*
+	This file is part of the MinSG library extension OutOfCore.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_OUTOFCORE
+
+#include "ExtentAllocator.h"
+#include <algorithm>
+#include <iterator>
+
+namespace MinSG {
+namespace OutOfCore {
+
+ExtentAllocator::ExtentAllocator(uint64_t defaultSlabSize) :
+	slabSize(defaultSlabSize), slabSizes(), slabUsage(), freeExtentsByLocation(), freeExtentsBySize() {
+}
+
+std::size_t ExtentAllocator::getNumSlabs() const {
+	return static_cast<std::size_t>(std::count_if(slabSizes.begin(), slabSizes.end(), [](uint64_t size) {
+		return size != 0;
+	}));
+}
+
+void ExtentAllocator::insertFreeExtent(uint32_t slab, uint64_t offset, uint64_t size) {
+	freeExtentsByLocation.emplace(std::make_pair(slab, offset), size);
+	freeExtentsBySize.emplace(size, slab, offset);
+}
+
+void ExtentAllocator::eraseFreeExtent(uint32_t slab, uint64_t offset, uint64_t size) {
+	freeExtentsByLocation.erase(std::make_pair(slab, offset));
+	freeExtentsBySize.erase(std::make_tuple(size, slab, offset));
+}
+
+ExtentAllocator::Extent ExtentAllocator::allocate(uint64_t size) {
+	auto bestFit = freeExtentsBySize.lower_bound(std::make_tuple(size, static_cast<uint32_t>(0), static_cast<uint64_t>(0)));
+	if(bestFit == freeExtentsBySize.end()) {
+		// reuse the entry of a removed slab
+		const auto emptyEntry = std::find(slabSizes.begin(), slabSizes.end(), 0);
+		const uint32_t slab = static_cast<uint32_t>(emptyEntry - slabSizes.begin());
+		const uint64_t newSlabSize = std::max(slabSize, size);
+		if(emptyEntry == slabSizes.end()) {
+			slabSizes.push_back(newSlabSize);
+			slabUsage.push_back(0);
+		} else {
+			*emptyEntry = newSlabSize;
+		}
+		insertFreeExtent(slab, 0, newSlabSize);
+		bestFit = freeExtentsBySize.lower_bound(std::make_tuple(size, static_cast<uint32_t>(0), static_cast<uint64_t>(0)));
+	}
+	const uint64_t extentSize = std::get<0>(*bestFit);
+	const Extent extent{std::get<1>(*bestFit), std::get<2>(*bestFit)};
+	eraseFreeExtent(extent.slab, extent.offset, extentSize);
+	if(extentSize > size) {
+		insertFreeExtent(extent.slab, extent.offset + size, extentSize - size);
+	}
+	slabUsage[extent.slab] += size;
+	return extent;
+}
+
+bool ExtentAllocator::free(const Extent & extent, uint64_t size) {
+	const uint32_t slab = extent.slab;
+	uint64_t offset = extent.offset;
+	slabUsage[slab] -= size;
+	if(slabUsage[slab] == 0 && slab != 0) {
+		// remove the whole slab; its only free extent covers the remaining space
+		auto it = freeExtentsByLocation.lower_bound(std::make_pair(slab, static_cast<uint64_t>(0)));
+		while(it != freeExtentsByLocation.end() && it->first.first == slab) {
+			freeExtentsBySize.erase(std::make_tuple(it->second, slab, it->first.second));
+			it = freeExtentsByLocation.erase(it);
+		}
+		slabSizes[slab] = 0;
+		return true;
+	}
+
+	// merge with the following and the preceding free extent
+	const auto next = freeExtentsByLocation.find(std::make_pair(slab, offset + size));
+	if(next != freeExtentsByLocation.end()) {
+		const uint64_t nextSize = next->second;
+		eraseFreeExtent(slab, offset + size, nextSize);
+		size += nextSize;
+	}
+	auto previous = freeExtentsByLocation.lower_bound(std::make_pair(slab, offset));
+	if(previous != freeExtentsByLocation.begin()) {
+		--previous;
+		if(previous->first.first == slab && previous->first.second + previous->second == offset) {
+			const uint64_t previousOffset = previous->first.second;
+			const uint64_t previousSize = previous->second;
+			eraseFreeExtent(slab, previousOffset, previousSize);
+			offset = previousOffset;
+			size += previousSize;
+		}
+	}
+	insertFreeExtent(slab, offset, size);
+	return false;
+}
+
+bool ExtentAllocator::overlapsFreeExtent(const Extent & extent, uint64_t size) const {
+	auto following = freeExtentsByLocation.lower_bound(std::make_pair(extent.slab, extent.offset));
+	if(following != freeExtentsByLocation.end() && following->first.first == extent.slab && following->first.second < extent.offset + size) {
+		return true;
+	}
+	if(following == freeExtentsByLocation.begin()) {
+		return false;
+	}
+	const auto & preceding = *std::prev(following);
+	return preceding.first.first == extent.slab && preceding.first.second + preceding.second > extent.offset;
+}
+
+bool ExtentAllocator::isConsistent() const {
+	if(freeExtentsByLocation.size() != freeExtentsBySize.size()) {
+		return false;
+	}
+	std::vector<uint64_t> freeBytes(slabSizes.size(), 0);
+	auto previous = freeExtentsByLocation.end();
+	for(auto it = freeExtentsByLocation.begin(); it != freeExtentsByLocation.end(); previous = it++) {
+		const uint32_t slab = it->first.first;
+		if(slab >= slabSizes.size() || it->first.second + it->second > slabSizes[slab] ||
+				freeExtentsBySize.count(std::make_tuple(it->second, slab, it->first.second)) == 0) {
+			return false;
+		}
+		// adjacent or overlapping free extents
+		if(previous != freeExtentsByLocation.end() && previous->first.first == slab && previous->first.second + previous->second >= it->first.second) {
+			return false;
+		}
+		freeBytes[slab] += it->second;
+	}
+	for(std::size_t slab = 0; slab < slabSizes.size(); ++slab) {
+		if(freeBytes[slab] + slabUsage[slab] != slabSizes[slab]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+}
+}
+
+#endif /* MINSG_EXT_OUTOFCORE */
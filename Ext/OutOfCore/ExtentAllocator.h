@@ -0,0 +1,105 @@
+/*
+	This file is part of the MinSG library extension OutOfCore.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_OUTOFCORE
+
+#ifndef OUTOFCORE_EXTENTALLOCATOR_H_
+#define OUTOFCORE_EXTENTALLOCATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace MinSG {
+namespace OutOfCore {
+
+/**
+ * Best-fit allocator of extents inside of slabs (\see CacheLevelPackedFiles).
+ * The allocator only manages the bookkeeping; the owner creates the storage of
+ * a slab when an extent in a new slab is returned, and releases it when free()
+ * reports that the slab has been removed.
+ *
+ * An allocation takes the smallest free extent that is large enough. If there
+ * is none, a new slab of #slabSize bytes (or of the requested size, if it is
+ * larger) is added; the entries of removed slabs are reused. Freed extents are
+ * merged with adjacent free extents. A slab that becomes empty is removed,
+ * except for the first one.
+ * The class is not thread-safe.
+ */
+class ExtentAllocator {
+	public:
+		struct Extent {
+			uint32_t slab;
+			uint64_t offset;
+		};
+
+		explicit ExtentAllocator(uint64_t defaultSlabSize);
+
+		/*! Allocate an extent of the given size. If the slab of the returned extent
+			has not existed before, the caller has to create its storage.	*/
+		Extent allocate(uint64_t size);
+
+		/*! Return an allocated extent of the given size. Return true if its slab has
+			become empty and has been removed.	*/
+		bool free(const Extent & extent, uint64_t size);
+
+		//! Return the size of the slab in bytes, or zero if the slab does not exist.
+		uint64_t getSlabSize(uint32_t slab) const {
+			return slab < slabSizes.size() ? slabSizes[slab] : 0;
+		}
+
+		//! Return the number of allocated bytes of the slab.
+		uint64_t getSlabUsage(uint32_t slab) const {
+			return slab < slabUsage.size() ? slabUsage[slab] : 0;
+		}
+
+		//! Return the number of existing slabs.
+		std::size_t getNumSlabs() const;
+
+		//! Return the number of free extents of all slabs.
+		std::size_t getNumFreeExtents() const {
+			return freeExtentsByLocation.size();
+		}
+
+		//! Return true if the given range overlaps a free extent.
+		bool overlapsFreeExtent(const Extent & extent, uint64_t size) const;
+
+		/*! Return true if the free extents are consistent: both indices are equal, adjacent
+			free extents are merged, and the free and allocated bytes sum up to the slab size.	*/
+		bool isConsistent() const;
+
+	private:
+		//! Size of a new slab in bytes.
+		const uint64_t slabSize;
+
+		//! Size of each slab in bytes; entries of removed slabs are zero.
+		std::vector<uint64_t> slabSizes;
+
+		//! Number of bytes allocated in each slab.
+		std::vector<uint64_t> slabUsage;
+
+		//! Free extents ordered by their location (slab, offset) with their size.
+		std::map<std::pair<uint32_t, uint64_t>, uint64_t> freeExtentsByLocation;
+
+		//! Free extents ordered by their size (size, slab, offset) for best-fit allocation.
+		std::set<std::tuple<uint64_t, uint32_t, uint64_t>> freeExtentsBySize;
+
+		void insertFreeExtent(uint32_t slab, uint64_t offset, uint64_t size);
+		void eraseFreeExtent(uint32_t slab, uint64_t offset, uint64_t size);
+};
+
+}
+}
+
+#endif /* OUTOFCORE_EXTENTALLOCATOR_H_ */
+
+#endif /* MINSG_EXT_OUTOFCORE */
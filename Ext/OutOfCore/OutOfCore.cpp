@@ -18,6 +18,7 @@
 #include "MeshAttributeSerialization.h"
 #include "CacheLevel.h"
 #include "../../Core/FrameContext.h"
+#include "../../Core/Nodes/AbstractCameraNode.h"
 #include "../../Core/Statistics.h"
 #include "../../SceneManagement/Importer/ImporterTools.h"
 #include <Rendering/Mesh/Mesh.h>
@@ -42,7 +43,7 @@ DataStrategy & getDataStrategy() {
 	return strategy;
 }
 
-// Trigger the CacheManager in each frame and update the OutOfCore statistics.
+// Trigger the CacheManager in each frame, prefetch based on the camera, and update the OutOfCore statistics.
 class TriggerCallback {
 	private:
 		CacheManager & cacheManager;
@@ -59,6 +60,10 @@ class TriggerCallback {
 			Statistics & statistics = frameContext.getStatistics();
 
 			statistics.pushEvent(EVENT_TYPE_OUTOFCORE_BEGIN, 1.0);
+			const AbstractCameraNode * camera = frameContext.getCamera();
+			if(camera != nullptr) {
+				cacheManager.prefetch(camera->getFrustum());
+			}
 			cacheManager.trigger();
 			statistics.pushEvent(EVENT_TYPE_OUTOFCORE_END, 1.0);
 
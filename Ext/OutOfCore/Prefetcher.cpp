@@ -0,0 +1,280 @@
+/*
+	This file is part of the MinSG library extension OutOfCore.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_OUTOFCORE
+
+#include "Prefetcher.h"
+#include "CacheContext.h"
+#include <Geometry/Box.h>
+#include <Geometry/Frustum.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace MinSG {
+namespace OutOfCore {
+
+//! Weight of the movement of the last frame when smoothing the velocities.
+static const float MOTION_SMOOTHING = 0.5f;
+//! Translation (in world units) and rotation (in radians) over the lookahead below which the camera is regarded as stationary.
+static const float MIN_TRANSLATION = 1.0e-3f;
+static const float MIN_ROTATION = 1.0e-3f;
+//! Average number of cache objects per grid cell.
+static const std::size_t OBJECTS_PER_CELL = 64;
+//! Maximum number of grid cells along one axis.
+static const uint32_t MAX_CELLS_PER_AXIS = 1024;
+
+//! Rotate @p v around the normalized @p axis (Rodrigues' rotation formula).
+static Geometry::Vec3 rotate(const Geometry::Vec3 & v, const Geometry::Vec3 & axis, float angle) {
+	const float cosAngle = std::cos(angle);
+	const float sinAngle = std::sin(angle);
+	return v * cosAngle + axis.cross(v) * sinAngle + axis * (axis.dot(v) * (1.0f - cosAngle));
+}
+
+Prefetcher::Prefetcher(CacheContext & cacheContext) :
+		context(cacheContext), objects(), boxes(), objectIndices(),
+		gridValid(false), cellObjects(), cellObjectBoxes(), cellRanges(), cellBoxes(),
+		enabled(true), lookaheadFrames(10), lookaheadSteps(3), maxObjectsPerFrame(64),
+		hasPreviousCamera(false), previousPosition(0.0f, 0.0f, 0.0f), previousDirection(0.0f, 0.0f, -1.0f),
+		velocity(0.0f, 0.0f, 0.0f), angularVelocity(0.0f, 0.0f, 0.0f),
+		currentCellResults(), predictedCellResults(), currentResults(), predictedResults(), candidates() {
+}
+
+void Prefetcher::addObject(CacheObject * object, const Geometry::Box & boundingBox) {
+	if(!objectIndices.emplace(object, objects.size()).second) {
+		throw std::logic_error("Cache object has been registered before.");
+	}
+	objects.push_back(object);
+	boxes.push_back(boundingBox);
+	gridValid = false;
+}
+
+void Prefetcher::setBoundingBox(CacheObject * object, const Geometry::Box & boundingBox) {
+	const auto it = objectIndices.find(object);
+	if(it != objectIndices.end()) {
+		boxes.set(it->second, boundingBox);
+		gridValid = false;
+	}
+}
+
+void Prefetcher::removeObject(CacheObject * object) {
+	const auto it = objectIndices.find(object);
+	if(it == objectIndices.end()) {
+		return;
+	}
+	// Removing cache objects is rare. Therefore, the entry is only invalidated and skipped in the grid.
+	objects[it->second] = nullptr;
+	objectIndices.erase(it);
+}
+
+void Prefetcher::clear() {
+	objects.clear();
+	boxes.clear();
+	objectIndices.clear();
+	gridValid = false;
+	hasPreviousCamera = false;
+	velocity = Geometry::Vec3(0.0f, 0.0f, 0.0f);
+	angularVelocity = Geometry::Vec3(0.0f, 0.0f, 0.0f);
+}
+
+void Prefetcher::updateMotion(const Geometry::Vec3 & position, const Geometry::Vec3 & direction) {
+	const Geometry::Vec3 translation = position - previousPosition;
+	Geometry::Vec3 rotation(0.0f, 0.0f, 0.0f);
+	const Geometry::Vec3 axis = previousDirection.cross(direction);
+	const float sinAngle = axis.length();
+	if(sinAngle > 1.0e-6f) {
+		rotation = axis * (std::atan2(sinAngle, previousDirection.dot(direction)) / sinAngle);
+	}
+	velocity = velocity * (1.0f - MOTION_SMOOTHING) + translation * MOTION_SMOOTHING;
+	angularVelocity = angularVelocity * (1.0f - MOTION_SMOOTHING) + rotation * MOTION_SMOOTHING;
+}
+
+void Prefetcher::buildGrid() {
+	gridValid = true;
+	cellObjects.clear();
+	cellObjectBoxes.clear();
+	cellRanges.clear();
+	cellBoxes.clear();
+
+	Geometry::Box sceneBox;
+	sceneBox.invalidate();
+	std::size_t count = 0;
+	for(std::size_t i = 0; i < objects.size(); ++i) {
+		if(objects[i] != nullptr) {
+			sceneBox.include(boxes.get(i));
+			++count;
+		}
+	}
+	if(count == 0) {
+		return;
+	}
+
+	// Choose cubic cells for the number of cells; flat extents get a single cell.
+	const float numCells = static_cast<float>(std::max<std::size_t>(count / OBJECTS_PER_CELL, 1));
+	const float extents[3] = {sceneBox.getExtentX(), sceneBox.getExtentY(), sceneBox.getExtentZ()};
+	bool flat[3] = {false, false, false};
+	float cellSize = 0.0f;
+	for(uint_fast8_t dimensions = 3; dimensions > 0; --dimensions) {
+		float volume = 1.0f;
+		uint_fast8_t smallest = 3;
+		for(uint_fast8_t axis = 0; axis < 3; ++axis) {
+			if(!flat[axis]) {
+				volume *= extents[axis];
+				if(smallest == 3 || extents[axis] < extents[smallest]) {
+					smallest = axis;
+				}
+			}
+		}
+		cellSize = std::pow(volume / numCells, 1.0f / static_cast<float>(dimensions));
+		if(extents[smallest] >= cellSize) {
+			break;
+		}
+		flat[smallest] = true;
+	}
+	uint32_t resolution[3];
+	for(uint_fast8_t axis = 0; axis < 3; ++axis) {
+		const float cells = (flat[axis] || !(cellSize > 0.0f)) ? 1.0f : std::ceil(extents[axis] / cellSize);
+		resolution[axis] = static_cast<uint32_t>(std::max(1.0f, std::min(cells, static_cast<float>(MAX_CELLS_PER_AXIS))));
+	}
+	const auto cellCoordinate = [&](float value, uint_fast8_t axis) {
+		if(resolution[axis] == 1) {
+			return static_cast<uint32_t>(0);
+		}
+		const float cell = (value - sceneBox.getMin(static_cast<Geometry::dimension_t>(axis))) / extents[axis] * static_cast<float>(resolution[axis]);
+		return std::min(static_cast<uint32_t>(std::max(cell, 0.0f)), resolution[axis] - 1);
+	};
+
+	// Counting sort of the cache objects by the cell containing the center of their box.
+	const BoxArrays arrays = boxes.getArrays();
+	std::vector<std::size_t> cellOfObject(objects.size(), 0);
+	std::vector<std::size_t> cellStarts(static_cast<std::size_t>(resolution[0]) * resolution[1] * resolution[2] + 1, 0);
+	for(std::size_t i = 0; i < objects.size(); ++i) {
+		if(objects[i] == nullptr) {
+			continue;
+		}
+		const uint32_t x = cellCoordinate(0.5f * (arrays.minX[i] + arrays.maxX[i]), 0);
+		const uint32_t y = cellCoordinate(0.5f * (arrays.minY[i] + arrays.maxY[i]), 1);
+		const uint32_t z = cellCoordinate(0.5f * (arrays.minZ[i] + arrays.maxZ[i]), 2);
+		cellOfObject[i] = (static_cast<std::size_t>(z) * resolution[1] + y) * resolution[0] + x;
+		++cellStarts[cellOfObject[i] + 1];
+	}
+	for(std::size_t cell = 1; cell < cellStarts.size(); ++cell) {
+		cellStarts[cell] += cellStarts[cell - 1];
+	}
+	cellObjects.resize(count);
+	std::vector<std::size_t> cellEnds(cellStarts.begin(), cellStarts.end() - 1);
+	for(std::size_t i = 0; i < objects.size(); ++i) {
+		if(objects[i] != nullptr) {
+			cellObjects[cellEnds[cellOfObject[i]]++] = i;
+		}
+	}
+
+	cellObjectBoxes.reserve(count);
+	for(const auto & index : cellObjects) {
+		cellObjectBoxes.push_back(boxes.get(index));
+	}
+	for(std::size_t cell = 0; cell + 1 < cellStarts.size(); ++cell) {
+		if(cellStarts[cell] == cellStarts[cell + 1]) {
+			continue;
+		}
+		Geometry::Box cellBox;
+		cellBox.invalidate();
+		for(std::size_t i = cellStarts[cell]; i < cellStarts[cell + 1]; ++i) {
+			cellBox.include(cellObjectBoxes.get(i));
+		}
+		cellRanges.emplace_back(cellStarts[cell], cellStarts[cell + 1]);
+		cellBoxes.push_back(cellBox);
+	}
+}
+
+uint32_t Prefetcher::prefetch(const Geometry::Frustum & frustum, uint32_t frameNumber) {
+	const Geometry::Vec3 position = frustum.getPos();
+	const Geometry::Vec3 direction = frustum.getDir().getNormalized();
+	if(hasPreviousCamera) {
+		updateMotion(position, direction);
+	}
+	hasPreviousCamera = true;
+	previousPosition = position;
+	previousDirection = direction;
+
+	if(!enabled || objects.empty() || lookaheadFrames == 0 || lookaheadSteps == 0 || maxObjectsPerFrame == 0) {
+		return 0;
+	}
+	const float angularSpeed = angularVelocity.length();
+	if(velocity.length() * lookaheadFrames < MIN_TRANSLATION && angularSpeed * lookaheadFrames < MIN_ROTATION) {
+		return 0;
+	}
+	const Geometry::Vec3 rotationAxis = angularSpeed > 0.0f ? angularVelocity / angularSpeed : Geometry::Vec3(0.0f, 1.0f, 0.0f);
+	const Geometry::Vec3 up = frustum.getUp().getNormalized();
+
+	if(!gridValid) {
+		buildGrid();
+	}
+	// Objects in the current frustum are raised by displaying them.
+	const FrustumPlanes currentPlanes = FrustumPlanes::fromFrustum(frustum);
+	classifyBoxes(currentPlanes, cellBoxes, currentCellResults);
+
+	const BoxArrays arrays = cellObjectBoxes.getArrays();
+	Geometry::Frustum predictedFrustum(frustum);
+	uint32_t prefetched = 0;
+	for(uint_fast32_t step = 1; step <= lookaheadSteps && prefetched < maxObjectsPerFrame; ++step) {
+		const float frames = static_cast<float>(lookaheadFrames) * static_cast<float>(step) / static_cast<float>(lookaheadSteps);
+		const float angle = std::min(angularSpeed * frames, static_cast<float>(M_PI));
+		const Geometry::Vec3 predictedPosition = position + velocity * frames;
+		predictedFrustum.setPosition(predictedPosition,
+									 rotate(direction, rotationAxis, angle),
+									 rotate(up, rotationAxis, angle));
+		const FrustumPlanes predictedPlanes = FrustumPlanes::fromFrustum(predictedFrustum);
+		classifyBoxes(predictedPlanes, cellBoxes, predictedCellResults);
+
+		candidates.clear();
+		for(std::size_t cell = 0; cell < cellRanges.size(); ++cell) {
+			// Skip the cells that will not be visible, or whose objects are all displayed already.
+			if(predictedCellResults[cell] == BOX_OUTSIDE || currentCellResults[cell] == BOX_INSIDE) {
+				continue;
+			}
+			const std::size_t first = cellRanges[cell].first;
+			const std::size_t count = cellRanges[cell].second - first;
+			if(currentCellResults[cell] == BOX_OUTSIDE) {
+				currentResults.assign(count, BOX_OUTSIDE);
+			} else {
+				currentResults.resize(count);
+				classifyBoxes(currentPlanes, cellObjectBoxes.getArrays(first), count, currentResults.data());
+			}
+			if(predictedCellResults[cell] == BOX_INSIDE) {
+				predictedResults.assign(count, BOX_INSIDE);
+			} else {
+				predictedResults.resize(count);
+				classifyBoxes(predictedPlanes, cellObjectBoxes.getArrays(first), count, predictedResults.data());
+			}
+			for(std::size_t j = 0; j < count; ++j) {
+				const std::size_t i = first + j;
+				if(objects[cellObjects[i]] == nullptr || currentResults[j] != BOX_OUTSIDE || predictedResults[j] == BOX_OUTSIDE) {
+					continue;
+				}
+				const Geometry::Vec3 center(0.5f * (arrays.minX[i] + arrays.maxX[i]),
+											0.5f * (arrays.minY[i] + arrays.maxY[i]),
+											0.5f * (arrays.minZ[i] + arrays.maxZ[i]));
+				candidates.emplace_back(center.distanceSquared(predictedPosition), i);
+			}
+		}
+		std::sort(candidates.begin(), candidates.end());
+		for(auto it = candidates.cbegin(); it != candidates.cend() && prefetched < maxObjectsPerFrame; ++it) {
+			// Objects that have been displayed or raised in this frame already do not count.
+			if(context.updatePrefetchFrameNumber(objects[cellObjects[it->second]], frameNumber)) {
+				++prefetched;
+			}
+		}
+	}
+	return prefetched;
+}
+
+}
+}
+
+#endif /* MINSG_EXT_OUTOFCORE */
@@ -0,0 +1,170 @@
+/*
+	This file is part of the MinSG library extension OutOfCore.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifdef MINSG_EXT_OUTOFCORE
+
+#ifndef OUTOFCORE_PREFETCHER_H_
+#define OUTOFCORE_PREFETCHER_H_
+
+#include "../../Helper/FrustumBatchTest.h"
+#include <Geometry/Vec3.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Geometry {
+template<typename _T> class _Box;
+typedef _Box<float> Box;
+}
+namespace MinSG {
+namespace OutOfCore {
+class CacheContext;
+class CacheObject;
+
+/**
+ * Prefetching of cache objects based on the motion of the camera.
+ * The position and the viewing direction of the camera are tracked from frame
+ * to frame, and their velocities are smoothed exponentially. From these, the
+ * frusta of the next frames are extrapolated. Cache objects whose bounding box
+ * is outside of the current frustum but inside of an extrapolated frustum get
+ * their priority raised, so that they are loaded before they are displayed.
+ * The extrapolated frusta are tested from the nearest to the farthest future,
+ * and inside of a frustum the cache objects are raised by their distance to
+ * the extrapolated camera position, until the budget for the frame is used up.
+ *
+ * The bounding boxes are sorted into a uniform grid, which is rebuilt after
+ * the cache objects have changed. Only the cache objects of the grid cells
+ * that intersect an extrapolated frustum, and that are not completely inside
+ * of the current frustum, are tested individually.
+ *
+ * @note The bounding boxes have to be given in world coordinates (see
+ * CacheManager::updatePrefetchBoundingBoxes()).
+ */
+class Prefetcher {
+	private:
+		CacheContext & context;
+
+		//! Cache objects known to the prefetcher; entries of removed cache objects are @c nullptr.
+		std::vector<CacheObject *> objects;
+
+		//! Bounding boxes of the cache objects, stored at the same index as in @a objects.
+		BoxBatch boxes;
+
+		//! Mapping from cache object to its index in @a objects.
+		std::unordered_map<CacheObject *, std::size_t> objectIndices;
+
+		//! @c false if the grid has to be rebuilt before the next prediction.
+		bool gridValid;
+
+		//! Indices of the cache objects in @a objects, sorted by their grid cell.
+		std::vector<std::size_t> cellObjects;
+
+		//! Bounding boxes of the cache objects, stored at the same index as in @a cellObjects.
+		BoxBatch cellObjectBoxes;
+
+		//! Range of each non-empty grid cell in @a cellObjects.
+		std::vector<std::pair<std::size_t, std::size_t>> cellRanges;
+
+		//! Union of the bounding boxes of each non-empty grid cell.
+		BoxBatch cellBoxes;
+
+		bool enabled;
+		uint32_t lookaheadFrames;
+		uint32_t lookaheadSteps;
+		uint32_t maxObjectsPerFrame;
+
+		//! @c true if @a previousPosition and @a previousDirection are valid.
+		bool hasPreviousCamera;
+		Geometry::Vec3 previousPosition;
+		Geometry::Vec3 previousDirection;
+
+		//! Smoothed translation of the camera per frame.
+		Geometry::Vec3 velocity;
+
+		//! Smoothed rotation of the viewing direction per frame (rotation axis scaled by the angle in radians).
+		Geometry::Vec3 angularVelocity;
+
+		// Buffers reused between the frames
+		std::vector<uint8_t> currentCellResults;
+		std::vector<uint8_t> predictedCellResults;
+		std::vector<uint8_t> currentResults;
+		std::vector<uint8_t> predictedResults;
+		std::vector<std::pair<float, std::size_t>> candidates;
+
+		//! Update @a velocity and @a angularVelocity with the movement since the previous frame.
+		void updateMotion(const Geometry::Vec3 & position, const Geometry::Vec3 & direction);
+
+		//! Sort the bounding boxes of the cache objects into a uniform grid.
+		void buildGrid();
+
+	public:
+		explicit Prefetcher(CacheContext & cacheContext);
+
+		//! Make a cache object available for prefetching. The bounding box is given in world coordinates.
+		void addObject(CacheObject * object, const Geometry::Box & boundingBox);
+
+		//! Change the bounding box of a cache object. Nothing is done if the cache object is unknown.
+		void setBoundingBox(CacheObject * object, const Geometry::Box & boundingBox);
+
+		//! Remove a cache object. Nothing is done if the cache object is unknown.
+		void removeObject(CacheObject * object);
+
+		//! Remove all cache objects and forget the camera motion.
+		void clear();
+
+		/**
+		 * Track the camera and raise the priority of the cache objects that
+		 * are expected to become visible. The raised cache objects are ranked
+		 * directly behind the cache objects displayed in frame @p frameNumber.
+		 *
+		 * @param frustum Current frustum of the camera in world coordinates
+		 * @param frameNumber Number of the current frame of the CacheManager
+		 * @return Number of cache objects whose priority has been raised
+		 */
+		uint32_t prefetch(const Geometry::Frustum & frustum, uint32_t frameNumber);
+
+		bool isEnabled() const {
+			return enabled;
+		}
+		void setEnabled(bool newEnabled) {
+			enabled = newEnabled;
+		}
+
+		//! Number of frames that the camera motion is extrapolated into the future.
+		uint32_t getLookaheadFrames() const {
+			return lookaheadFrames;
+		}
+		void setLookaheadFrames(uint32_t frames) {
+			lookaheadFrames = frames;
+		}
+
+		//! Number of extrapolated frusta that are tested, distributed evenly over the lookahead.
+		uint32_t getLookaheadSteps() const {
+			return lookaheadSteps;
+		}
+		void setLookaheadSteps(uint32_t steps) {
+			lookaheadSteps = steps;
+		}
+
+		//! Maximum number of cache objects whose priority is raised per frame.
+		uint32_t getMaxObjectsPerFrame() const {
+			return maxObjectsPerFrame;
+		}
+		void setMaxObjectsPerFrame(uint32_t count) {
+			maxObjectsPerFrame = count;
+		}
+};
+
+}
+}
+
+#endif /* OUTOFCORE_PREFETCHER_H_ */
+
+#endif /* MINSG_EXT_OUTOFCORE */
@@ -16,7 +16,11 @@
 #include "../../Helper/Helper.h"
 #include <Util/Graphics/ColorLibrary.h>
 #include <Util/Macros.h>
+#include <algorithm>
+#include <cmath>
 #include <set>
+#include <utility>
+#include <vector>
 
 namespace MinSG {
 
@@ -68,6 +72,76 @@ void RTree::doAddChild(Util::Reference<Node> child) {
 	}
 }
 
+typedef std::pair<Util::Reference<Node>, Geometry::Box> entry_t;
+
+/**
+ * Order the entries such that consecutive runs of @a maxEntries entries are
+ * spatially close: sort by x into slabs, each slab by y into runs, and each
+ * run by z.
+ */
+static void sortTileRecursive(std::vector<entry_t> & entries, size_t maxEntries) {
+	const size_t groupCount = (entries.size() + maxEntries - 1) / maxEntries;
+	const size_t sliceCount = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::cbrt(static_cast<double>(groupCount)))));
+	const auto sortByAxis = [](std::vector<entry_t>::iterator begin, std::vector<entry_t>::iterator end, uint_fast8_t axis) {
+		std::sort(begin, end, [axis](const entry_t & a, const entry_t & b) {
+			return a.second.getCenter().get(axis) < b.second.getCenter().get(axis);
+		});
+	};
+	sortByAxis(entries.begin(), entries.end(), 0);
+	const size_t slabSize = sliceCount * sliceCount * maxEntries;
+	const size_t runSize = sliceCount * maxEntries;
+	for(size_t slab = 0; slab < entries.size(); slab += slabSize) {
+		const size_t slabEnd = std::min(slab + slabSize, entries.size());
+		sortByAxis(entries.begin() + slab, entries.begin() + slabEnd, 1);
+		for(size_t run = slab; run < slabEnd; run += runSize) {
+			sortByAxis(entries.begin() + run, entries.begin() + std::min(run + runSize, slabEnd), 2);
+		}
+	}
+}
+
+void RTree::doAddChildren(const std::vector<Util::Reference<Node>> & newChildren) {
+	if (!isRoot || countChildren() != 0 || newChildren.size() <= M) {
+		ListNode::doAddChildren(newChildren);
+		return;
+	}
+	std::vector<entry_t> entries;
+	entries.reserve(newChildren.size());
+	for (const auto & child : newChildren) {
+		entries.emplace_back(child, child->getWorldBB());
+	}
+	// Build the levels bottom-up. The entries are distributed evenly, so that
+	// every node contains at least M/2 >= m entries.
+	bool leafLevel = true;
+	while (entries.size() > M) {
+		sortTileRecursive(entries, M);
+		const size_t groupCount = (entries.size() + M - 1) / M;
+		std::vector<entry_t> parents;
+		parents.reserve(groupCount);
+		size_t begin = 0;
+		for (size_t group = 0; group < groupCount; ++group) {
+			const size_t end = (entries.size() * (group + 1)) / groupCount;
+			auto node = new RTree(*this);
+			node->isLeaf = leafLevel;
+			Geometry::Box box;
+			box.invalidate();
+			for (size_t i = begin; i < end; ++i) {
+				node->_pushChild(entries[i].first);
+				entries[i].first->_setParent(node);
+				box.include(entries[i].second);
+			}
+			parents.emplace_back(node, box);
+			begin = end;
+		}
+		entries.swap(parents);
+		leafLevel = false;
+	}
+	for (const auto & entry : entries) {
+		_pushChild(entry.first);
+		entry.first->_setParent(this);
+	}
+	isLeaf = leafLevel;
+}
+
 bool RTree::doRemoveChild(Util::Reference<Node> child) {
 	if (dynamic_cast<RTree *> (child.get()) != nullptr) {
 		WARN("An internal node cannot be removed directly. Remove the entries in the leaf nodes instead.");
@@ -79,7 +153,10 @@ bool RTree::doRemoveChild(Util::Reference<Node> child) {
 		return false;
 	}
 	// [Delete record]
-	leaf->removeChild(child.get());
+	// The observers are informed by removeChild() or removeChildren() of the root.
+	leaf->ListNode::doRemoveChild(child);
+	static_cast<GroupNode *>(leaf)->invalidateCompoundBB();
+	leaf->worldBBChanged();
 	// [Propagate changes]
 	condenseTree(leaf);
 	// [Shorten tree]
@@ -58,6 +58,28 @@ class RTree : public ListNode {
 		 */
 		bool doRemoveChild(Util::Reference<Node> child) override;
 
+		/**
+		 * Insert several nodes into the tree. If the tree is empty, it is built
+		 * bottom-up by Sort-Tile-Recursive packing. Otherwise, the nodes are
+		 * inserted one after another.
+		 *
+		 * @param newChildren New nodes to add to the tree.
+		 * @see Scott T. Leutenegger, Mario A. Lopez, Jeffrey Edgington. STR: a simple and efficient algorithm for R-tree packing.
+		 * In ICDE '97: Proceedings of the Thirteenth International Conference on Data Engineering, pages 497–506, 1997.
+		 */
+		void doAddChildren(const std::vector<Util::Reference<Node>> & newChildren) override;
+
+		/**
+		 * Remove several nodes from the tree by searching and deleting one after another.
+		 * The observers are informed once by GroupNode::removeChildren().
+		 *
+		 * @see doRemoveChild()
+		 */
+		void doRemoveChildren(const std::vector<Util::Reference<Node>> & childrenToRemove,
+							std::vector<Node *> & removedChildren) override {
+			GroupNode::doRemoveChildren(childrenToRemove, removedChildren);
+		}
+
 		//! Return a string representation describing this node.
 		std::string toString() const;
 
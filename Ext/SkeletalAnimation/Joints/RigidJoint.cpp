@@ -87,6 +87,19 @@ bool RigidJoint::doRemoveChild(Util::Reference<Node> _childToRemove)
     return ListNode::doRemoveChild(_childToRemove);
 }
 
+void RigidJoint::doRemoveChildren(const std::vector<Util::Reference<Node>> & _childrenToRemove,
+                                  std::vector<Node *> & _removedChildren)
+{
+    for(const auto & childToRemove : _childrenToRemove)
+    {
+        auto child = inverseChildMatrices.find(childToRemove);
+        if(child != inverseChildMatrices.end() && childToRemove.get()->getParent() == this)
+            childToRemove.get()->setRelTransformation(childToRemove.get()->getRelTransformationMatrix() * child->second);
+    }
+    
+    ListNode::doRemoveChildren(_childrenToRemove, _removedChildren);
+}
+
 }
 
 #endif
@@ -80,6 +80,8 @@ namespace MinSG {
         // adds an child by first multiplying the child with the offset matrix and if given by all other children (stacking)
         virtual void doAddChild(Util::Reference<Node> _child) override;
         virtual bool doRemoveChild(Util::Reference<Node> _childToRemove) override;
+        virtual void doRemoveChildren(const std::vector<Util::Reference<Node>> & _childrenToRemove,
+                                      std::vector<Node *> & _removedChildren) override;
         
         
 	private:
@@ -95,7 +95,8 @@ void buildList(GroupNode * group, Util::GenericAttributeMap & /*options*/) {
 	checkPreCondtions(group);
 
 	const auto closedNodes = collectClosedNodes(group);
-	std::deque<Reference<Node> > closed;
+	std::vector<Reference<Node> > closed;
+	closed.reserve(closedNodes.size());
 	for(const auto & closedNode : closedNodes) {
 		closed.emplace_back(closedNode);
 		changeParentKeepTransformation(closedNode, nullptr);
@@ -106,9 +107,7 @@ void buildList(GroupNode * group, Util::GenericAttributeMap & /*options*/) {
 		destroy(child);
 	}
 	
-	for(const auto & child : closed) {
-		changeParentKeepTransformation(child.get(), group);
-	}
+	changeParentKeepTransformation(closed, group);
 
 	std::cout << "TreeBuilder: built list" << std::endl;
 }
@@ -189,6 +189,13 @@ void ValuatedRegionNode::doAddChild(Util::Reference<Node> child) {
 	ListNode::doAddChild(child);
 }
 
+//! ---|> GroupNode
+void ValuatedRegionNode::validateChild(Node * child) const {
+	if (!dynamic_cast<ValuatedRegionNode*>(child)) {
+		throw std::invalid_argument("ValuatedRegionNode can only contain other ValuatedRegionNodes");
+	}
+}
+
 //! ---|> Node
 void ValuatedRegionNode::doDisplay(FrameContext & context, const RenderParam & rp) {
 	const bool iMode = context.getRenderingContext().getImmediateMode();
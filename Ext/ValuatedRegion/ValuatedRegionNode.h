@@ -54,6 +54,8 @@ class ValuatedRegionNode : public ListNode {
 
 		//! ---|> GroupNode
 		void doAddChild(Util::Reference<Node> child) override;
+		//! ---|> GroupNode
+		void validateChild(Node * child) const override;
 	private:
 		//! ---|> Node
 		ValuatedRegionNode * doClone()const override	{	return new ValuatedRegionNode(*this);	}
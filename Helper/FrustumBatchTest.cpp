@@ -0,0 +1,251 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "FrustumBatchTest.h"
+#include <Geometry/Box.h>
+#include <Geometry/Matrix4x4.h>
+#include <Geometry/Vec3.h>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MINSG_FRUSTUMBATCH_SSE
+#include <emmintrin.h>
+#endif
+#if defined(MINSG_FRUSTUMBATCH_SSE) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MINSG_FRUSTUMBATCH_AVX2
+#include <immintrin.h>
+#endif
+
+namespace MinSG {
+
+// -----------------------------------
+// ---- Planes
+
+FrustumPlanes FrustumPlanes::fromMatrix(const Geometry::Matrix4x4 & m) {
+	FrustumPlanes planes;
+	// left, right, bottom, top, near, far: row 3 +/- row 0, 1, 2
+	for(uint_fast8_t i = 0; i < 6; ++i) {
+		const uint_fast8_t row = i / 2;
+		const float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+		planes.a[i] = m.at(12) + sign * m.at(row * 4 + 0);
+		planes.b[i] = m.at(13) + sign * m.at(row * 4 + 1);
+		planes.c[i] = m.at(14) + sign * m.at(row * 4 + 2);
+		planes.d[i] = m.at(15) + sign * m.at(row * 4 + 3);
+	}
+	return planes;
+}
+
+FrustumPlanes FrustumPlanes::fromFrustum(const Geometry::Frustum & frustum) {
+	// planes in camera coordinates
+	const FrustumPlanes cameraPlanes = fromMatrix(frustum.getProjectionMatrix());
+
+	// The camera looks along its negative z-axis. A plane n*p+d in camera coordinates
+	// is transformed to world coordinates by rotating n into the camera's basis.
+	const Geometry::Vec3 & pos = frustum.getPos();
+	const Geometry::Vec3 dir = frustum.getDir().getNormalized();
+	const Geometry::Vec3 up = frustum.getUp().getNormalized();
+	const Geometry::Vec3 right = dir.cross(up).getNormalized();
+	const Geometry::Vec3 back = -dir;
+
+	FrustumPlanes planes;
+	for(uint_fast8_t i = 0; i < 6; ++i) {
+		const Geometry::Vec3 normal = right * cameraPlanes.a[i] + up * cameraPlanes.b[i] + back * cameraPlanes.c[i];
+		planes.a[i] = normal.getX();
+		planes.b[i] = normal.getY();
+		planes.c[i] = normal.getZ();
+		planes.d[i] = cameraPlanes.d[i] - normal.dot(pos);
+	}
+	return planes;
+}
+
+// -----------------------------------
+// ---- BoxBatch
+
+void BoxBatch::clear() {
+	minX.clear();
+	minY.clear();
+	minZ.clear();
+	maxX.clear();
+	maxY.clear();
+	maxZ.clear();
+}
+
+void BoxBatch::reserve(size_t count) {
+	minX.reserve(count);
+	minY.reserve(count);
+	minZ.reserve(count);
+	maxX.reserve(count);
+	maxY.reserve(count);
+	maxZ.reserve(count);
+}
+
+void BoxBatch::push_back(const Geometry::Box & box) {
+	minX.push_back(box.getMinX());
+	minY.push_back(box.getMinY());
+	minZ.push_back(box.getMinZ());
+	maxX.push_back(box.getMaxX());
+	maxY.push_back(box.getMaxY());
+	maxZ.push_back(box.getMaxZ());
+}
+
+void BoxBatch::set(size_t index, const Geometry::Box & box) {
+	minX[index] = box.getMinX();
+	minY[index] = box.getMinY();
+	minZ[index] = box.getMinZ();
+	maxX[index] = box.getMaxX();
+	maxY[index] = box.getMaxY();
+	maxZ[index] = box.getMaxZ();
+}
+
+Geometry::Box BoxBatch::get(size_t index) const {
+	return Geometry::Box(minX[index], maxX[index], minY[index], maxY[index], minZ[index], maxZ[index]);
+}
+
+// -----------------------------------
+// ---- Kernels
+
+/*
+ * For each plane, the largest and the smallest signed distance of the box's
+ * corners are max(a*minX, a*maxX) + max(b*minY, b*maxY) + max(c*minZ, c*maxZ) + d
+ * and the same with min. The box is outside, if the largest distance is
+ * negative for a plane, and intersects, if the smallest distance is negative.
+ * All kernels evaluate this expression in the same order.
+ */
+
+static void classifyScalar(const FrustumPlanes & planes, const BoxArrays & boxes, size_t first, size_t count, uint8_t * results) {
+	for(size_t i = first; i < count; ++i) {
+		bool outside = false;
+		bool intersect = false;
+		for(uint_fast8_t p = 0; p < 6; ++p) {
+			const float ax0 = planes.a[p] * boxes.minX[i], ax1 = planes.a[p] * boxes.maxX[i];
+			const float by0 = planes.b[p] * boxes.minY[i], by1 = planes.b[p] * boxes.maxY[i];
+			const float cz0 = planes.c[p] * boxes.minZ[i], cz1 = planes.c[p] * boxes.maxZ[i];
+			const float maxDist = ((std::max(ax0, ax1) + std::max(by0, by1)) + std::max(cz0, cz1)) + planes.d[p];
+			const float minDist = ((std::min(ax0, ax1) + std::min(by0, by1)) + std::min(cz0, cz1)) + planes.d[p];
+			outside = outside || maxDist < 0.0f;
+			intersect = intersect || minDist < 0.0f;
+		}
+		results[i] = outside ? BOX_OUTSIDE : (intersect ? BOX_INTERSECT : BOX_INSIDE);
+	}
+}
+
+//! (internal) Convert the lane masks of outside and intersecting boxes to result codes.
+static inline void storeCodes(int outsideMask, int intersectMask, size_t lanes, uint8_t * results) {
+	for(size_t lane = 0; lane < lanes; ++lane) {
+		const bool outside = (outsideMask >> lane) & 1;
+		const bool intersect = (intersectMask >> lane) & 1;
+		results[lane] = outside ? BOX_OUTSIDE : (intersect ? BOX_INTERSECT : BOX_INSIDE);
+	}
+}
+
+#ifdef MINSG_FRUSTUMBATCH_SSE
+//! @return Index of the first box that has not been classified.
+static size_t classifySSE(const FrustumPlanes & planes, const BoxArrays & boxes, size_t count, uint8_t * results) {
+	const __m128 zero = _mm_setzero_ps();
+	size_t i = 0;
+	for(; i + 4 <= count; i += 4) {
+		const __m128 minX = _mm_loadu_ps(boxes.minX + i), maxX = _mm_loadu_ps(boxes.maxX + i);
+		const __m128 minY = _mm_loadu_ps(boxes.minY + i), maxY = _mm_loadu_ps(boxes.maxY + i);
+		const __m128 minZ = _mm_loadu_ps(boxes.minZ + i), maxZ = _mm_loadu_ps(boxes.maxZ + i);
+		__m128 outside = zero;
+		__m128 intersect = zero;
+		for(uint_fast8_t p = 0; p < 6; ++p) {
+			const __m128 a = _mm_set1_ps(planes.a[p]);
+			const __m128 b = _mm_set1_ps(planes.b[p]);
+			const __m128 c = _mm_set1_ps(planes.c[p]);
+			const __m128 d = _mm_set1_ps(planes.d[p]);
+			const __m128 ax0 = _mm_mul_ps(a, minX), ax1 = _mm_mul_ps(a, maxX);
+			const __m128 by0 = _mm_mul_ps(b, minY), by1 = _mm_mul_ps(b, maxY);
+			const __m128 cz0 = _mm_mul_ps(c, minZ), cz1 = _mm_mul_ps(c, maxZ);
+			const __m128 maxDist = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_max_ps(ax0, ax1), _mm_max_ps(by0, by1)), _mm_max_ps(cz0, cz1)), d);
+			const __m128 minDist = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_min_ps(ax0, ax1), _mm_min_ps(by0, by1)), _mm_min_ps(cz0, cz1)), d);
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(maxDist, zero));
+			intersect = _mm_or_ps(intersect, _mm_cmplt_ps(minDist, zero));
+		}
+		storeCodes(_mm_movemask_ps(outside), _mm_movemask_ps(intersect), 4, results + i);
+	}
+	return i;
+}
+#endif
+
+#ifdef MINSG_FRUSTUMBATCH_AVX2
+//! @return Index of the first box that has not been classified.
+__attribute__((target("avx2")))
+static size_t classifyAVX2(const FrustumPlanes & planes, const BoxArrays & boxes, size_t count, uint8_t * results) {
+	const __m256 zero = _mm256_setzero_ps();
+	size_t i = 0;
+	for(; i + 8 <= count; i += 8) {
+		const __m256 minX = _mm256_loadu_ps(boxes.minX + i), maxX = _mm256_loadu_ps(boxes.maxX + i);
+		const __m256 minY = _mm256_loadu_ps(boxes.minY + i), maxY = _mm256_loadu_ps(boxes.maxY + i);
+		const __m256 minZ = _mm256_loadu_ps(boxes.minZ + i), maxZ = _mm256_loadu_ps(boxes.maxZ + i);
+		__m256 outside = zero;
+		__m256 intersect = zero;
+		for(uint_fast8_t p = 0; p < 6; ++p) {
+			const __m256 a = _mm256_set1_ps(planes.a[p]);
+			const __m256 b = _mm256_set1_ps(planes.b[p]);
+			const __m256 c = _mm256_set1_ps(planes.c[p]);
+			const __m256 d = _mm256_set1_ps(planes.d[p]);
+			const __m256 ax0 = _mm256_mul_ps(a, minX), ax1 = _mm256_mul_ps(a, maxX);
+			const __m256 by0 = _mm256_mul_ps(b, minY), by1 = _mm256_mul_ps(b, maxY);
+			const __m256 cz0 = _mm256_mul_ps(c, minZ), cz1 = _mm256_mul_ps(c, maxZ);
+			const __m256 maxDist = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_max_ps(ax0, ax1), _mm256_max_ps(by0, by1)), _mm256_max_ps(cz0, cz1)), d);
+			const __m256 minDist = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_min_ps(ax0, ax1), _mm256_min_ps(by0, by1)), _mm256_min_ps(cz0, cz1)), d);
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(maxDist, zero, _CMP_LT_OQ));
+			intersect = _mm256_or_ps(intersect, _mm256_cmp_ps(minDist, zero, _CMP_LT_OQ));
+		}
+		storeCodes(_mm256_movemask_ps(outside), _mm256_movemask_ps(intersect), 8, results + i);
+	}
+	return i;
+}
+#endif
+
+bool isInstructionSetSupported(simdInstructionSet_t instructionSet) {
+	switch(instructionSet) {
+		case simdInstructionSet_t::SCALAR:
+			return true;
+		case simdInstructionSet_t::SSE:
+#ifdef MINSG_FRUSTUMBATCH_SSE
+			return true;
+#else
+			return false;
+#endif
+		case simdInstructionSet_t::AVX2:
+#ifdef MINSG_FRUSTUMBATCH_AVX2
+			return __builtin_cpu_supports("avx2");
+#else
+			return false;
+#endif
+		default:
+			return false;
+	}
+}
+
+simdInstructionSet_t getFastestInstructionSet() {
+	static const simdInstructionSet_t fastest = isInstructionSetSupported(simdInstructionSet_t::AVX2) ? simdInstructionSet_t::AVX2 :
+												(isInstructionSetSupported(simdInstructionSet_t::SSE) ? simdInstructionSet_t::SSE : simdInstructionSet_t::SCALAR);
+	return fastest;
+}
+
+void classifyBoxes(const FrustumPlanes & planes, const BoxArrays & boxes, size_t count, uint8_t * results,
+					simdInstructionSet_t instructionSet) {
+	size_t first = 0;
+	if(!isInstructionSetSupported(instructionSet))
+		instructionSet = simdInstructionSet_t::SCALAR;
+#ifdef MINSG_FRUSTUMBATCH_AVX2
+	if(instructionSet == simdInstructionSet_t::AVX2)
+		first = classifyAVX2(planes, boxes, count, results);
+#endif
+#ifdef MINSG_FRUSTUMBATCH_SSE
+	if(instructionSet == simdInstructionSet_t::SSE)
+		first = classifySSE(planes, boxes, count, results);
+#endif
+	// remaining boxes
+	classifyScalar(planes, boxes, first, count, results);
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_FRUSTUMBATCHTEST_H
+#define MINSG_FRUSTUMBATCHTEST_H
+
+#include <Geometry/Frustum.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Geometry {
+template<typename _T> class _Box;
+typedef _Box<float> Box;
+template<typename _T> class _Matrix4x4;
+typedef _Matrix4x4<float> Matrix4x4;
+}
+namespace MinSG {
+
+/** @addtogroup helper
+ * @{
+ */
+
+//! Result codes of classifyBoxes().
+static const uint8_t BOX_OUTSIDE = 0;
+static const uint8_t BOX_INTERSECT = 1;
+static const uint8_t BOX_INSIDE = 2;
+
+inline Geometry::Frustum::intersection_t toIntersection(uint8_t code) {
+	return code == BOX_INSIDE ? Geometry::Frustum::intersection_t::INSIDE :
+			(code == BOX_INTERSECT ? Geometry::Frustum::intersection_t::INTERSECT : Geometry::Frustum::intersection_t::OUTSIDE);
+}
+
+enum class simdInstructionSet_t : uint8_t {
+	SCALAR,
+	SSE,
+	AVX2
+};
+
+//! @return @c true iff the kernel for the instruction set has been compiled in and is supported by the CPU.
+bool isInstructionSetSupported(simdInstructionSet_t instructionSet);
+
+//! @return The fastest supported instruction set.
+simdInstructionSet_t getFastestInstructionSet();
+
+/**
+ * The six planes of a frustum in world coordinates (structure of arrays).
+ * A point p is on the inner side of plane i, if a[i]*p.x + b[i]*p.y + c[i]*p.z + d[i] >= 0.
+ */
+struct FrustumPlanes {
+	float a[6];
+	float b[6];
+	float c[6];
+	float d[6];
+
+	//! Extract the planes from the camera parameters and the projection matrix of the frustum.
+	static FrustumPlanes fromFrustum(const Geometry::Frustum & frustum);
+
+	//! Extract the planes from a world to clipping space matrix (Gribb/Hartmann).
+	static FrustumPlanes fromMatrix(const Geometry::Matrix4x4 & worldToClipping);
+};
+
+//! Pointers to the coordinates of a set of boxes (structure of arrays).
+struct BoxArrays {
+	const float * minX;
+	const float * minY;
+	const float * minZ;
+	const float * maxX;
+	const float * maxY;
+	const float * maxZ;
+};
+
+//! Coordinates of boxes stored as structure of arrays.
+class BoxBatch {
+	public:
+		void clear();
+		void reserve(size_t count);
+		void push_back(const Geometry::Box & box);
+		void set(size_t index, const Geometry::Box & box);
+		Geometry::Box get(size_t index) const;
+		size_t size() const								{	return minX.size();	}
+		bool empty() const								{	return minX.empty();	}
+		//! Return the arrays starting at the box with index @p first.
+		BoxArrays getArrays(size_t first = 0) const {
+			const BoxArrays arrays = {minX.data() + first, minY.data() + first, minZ.data() + first, maxX.data() + first, maxY.data() + first, maxZ.data() + first};
+			return arrays;
+		}
+	private:
+		std::vector<float> minX, minY, minZ, maxX, maxY, maxZ;
+};
+
+/**
+ * Classify @p count boxes against the frustum planes. For each box, BOX_OUTSIDE,
+ * BOX_INTERSECT or BOX_INSIDE is written to @p results.
+ * As Geometry::Frustum::isBoxInFrustum(), the test is conservative: boxes near
+ * the corners of the frustum may be classified as intersecting.
+ * All instruction sets produce the same results.
+ */
+void classifyBoxes(const FrustumPlanes & planes, const BoxArrays & boxes, size_t count, uint8_t * results,
+					simdInstructionSet_t instructionSet);
+
+inline void classifyBoxes(const FrustumPlanes & planes, const BoxArrays & boxes, size_t count, uint8_t * results) {
+	classifyBoxes(planes, boxes, count, results, getFastestInstructionSet());
+}
+
+inline void classifyBoxes(const FrustumPlanes & planes, const BoxBatch & boxes, std::vector<uint8_t> & results) {
+	results.resize(boxes.size());
+	classifyBoxes(planes, boxes.getArrays(), boxes.size(), results.data());
+}
+
+//! @}
+}
+
+#endif /* MINSG_FRUSTUMBATCHTEST_H */
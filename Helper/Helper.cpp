@@ -407,6 +407,16 @@ void initShaderState(ShaderState * shaderState,
 
 
 
+//! (internal) Set the relative transformation; an SRT is kept if possible.
+static void setRelTransformationKeepSRT(Node * child, const Geometry::Matrix4x4f & ncMat){
+	if(child->hasRelTransformationSRT() && ncMat.convertsSafelyToSRT()){
+		child->setRelTransformation(ncMat._toSRT());
+	}
+	else{
+		child->setRelTransformation(ncMat);
+	}
+}
+
 void changeParentKeepTransformation(Util::Reference<Node> child, GroupNode * newParent){
 		
 	const Geometry::Matrix4x4f ncMat = (
@@ -422,12 +432,25 @@ void changeParentKeepTransformation(Util::Reference<Node> child, GroupNode * new
 		child->getParent()->removeChild(child.get());
 	}
 	
-	if(child->hasRelTransformationSRT() && ncMat.convertsSafelyToSRT()){
-		child->setRelTransformation(ncMat._toSRT());
-	}
-	else{
-		child->setRelTransformation(ncMat);
+	setRelTransformationKeepSRT(child.get(), ncMat);
+}
+
+void changeParentKeepTransformation(const std::vector<Util::Reference<Node>> & children, GroupNode * newParent){
+	if(newParent == nullptr){
+		for(const auto & child : children)
+			changeParentKeepTransformation(child, nullptr);
+		return;
 	}
+	const Geometry::Matrix4x4f worldToLocal = newParent->getWorldToLocalMatrix();
+	std::vector<Geometry::Matrix4x4f> ncMats;
+	ncMats.reserve(children.size());
+	for(const auto & child : children)
+		ncMats.emplace_back(worldToLocal * child->getWorldTransformationMatrix());
+
+	newParent->addChildren(children);
+
+	for(size_t i = 0; i < children.size(); ++i)
+		setRelTransformationKeepSRT(children[i].get(), ncMats[i]);
 }
 
 Geometry::Box combineNodesWorldBBs(const std::vector<Node*> & nodes){
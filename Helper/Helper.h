@@ -59,6 +59,15 @@ class TextureState;
  */
 void changeParentKeepTransformation(Util::Reference<Node> child, GroupNode * newParent);
 
+/*!
+ * moves all given children to the given new parent (if exists)
+ * such that their world matrices do not change.
+ * In contrast to calling changeParentKeepTransformation for each child,
+ * the children are added with a single call of GroupNode::addChildren.
+ * @note newParent may be nullptr
+ */
+void changeParentKeepTransformation(const std::vector<Util::Reference<Node>> & children, GroupNode * newParent);
+
 /*! Returns the combined world bounding boxes of the given nodes.*/
 Geometry::Box combineNodesWorldBBs(const std::vector<Node*> & nodes);
 
@@ -0,0 +1,273 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_HELPER_NODETRAVERSAL_H
+#define MINSG_HELPER_NODETRAVERSAL_H
+
+#include "../Core/NodeVisitor.h"
+#include "../Core/Nodes/GroupNode.h"
+#include "../Core/Nodes/ListNode.h"
+#include "../Core/Nodes/Node.h"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace MinSG {
+/** @addtogroup helper
+ * @{
+ */
+
+/**
+ * Header-only, non-recursive depth-first traversal of a subtree.
+ *
+ * In contrast to Node::traverse() with a NodeVisitor, the callbacks are template
+ * parameters, so that they can be inlined, and the path from the root to the
+ * current node is kept on an explicit stack instead of the call stack. Therefore,
+ * the depth of the tree is only limited by the available memory. The stack can be
+ * reused for several traversals to avoid allocations.
+ *
+ * The children of ListNodes (including its subclasses) are accessed directly; the
+ * children of other GroupNodes are determined by calling their traverse() method
+ * for one level. The nodes are visited in the same order as by Node::traverse(),
+ * and the callbacks have the same semantics as NodeVisitor::enter() and
+ * NodeVisitor::leave():
+ *  - CONTINUE_TRAVERSAL: visit the children of the node before leaving it
+ *  - BREAK_TRAVERSAL: skip the children of the node (enter() only)
+ *  - EXIT_TRAVERSAL: stop the traversal immediately
+ *
+ * The overloads without a Stack parameter use a thread local stack (see LocalStack),
+ * so that they do not allocate memory once the stack has grown to the depth of the tree.
+ *
+ * \note The children of a node must not be modified while the node is on the stack.
+ */
+namespace NodeTraversal {
+
+//! Reusable stack of a traversal. A stack must not be used by a nested traversal.
+class Stack {
+	public:
+		void reserve(size_t depth)	{	frames.reserve(depth);	}
+
+	private:
+		template<typename Enter_t, typename Leave_t>
+		friend NodeVisitor::status traverse(Node *, Enter_t &&, Leave_t &&, Stack &);
+
+		struct Frame {
+			Node * node;
+			//! Children are accessed directly, if the node is a ListNode; otherwise they are stored in genericChildren.
+			ListNode * listNode;
+			size_t next;
+			size_t count;
+			size_t genericBegin;
+		};
+		std::vector<Frame> frames;
+		std::vector<Node *> genericChildren;
+
+		//! Collects the children of a GroupNode that is not a ListNode.
+		struct ChildCollector : public NodeVisitor {
+			Node * parent;
+			std::vector<Node *> & children;
+			ChildCollector(Node * _parent, std::vector<Node *> & _children) : parent(_parent), children(_children) {}
+			virtual ~ChildCollector() {}
+			NodeVisitor::status enter(Node * node) override {
+				if(node == parent)
+					return CONTINUE_TRAVERSAL;
+				children.push_back(node);
+				return BREAK_TRAVERSAL;
+			}
+		};
+
+		//! Push a frame for the children of @p node; returns false if the node has no children.
+		bool push(Node * node) {
+			GroupNode * groupNode = dynamic_cast<GroupNode *>(node);
+			if(groupNode == nullptr)
+				return false;
+			ListNode * listNode = dynamic_cast<ListNode *>(groupNode);
+			if(listNode != nullptr) {
+				const size_t count = listNode->countChildren();
+				if(count == 0)
+					return false;
+				frames.push_back({node, listNode, 0, count, 0});
+			} else {
+				const size_t begin = genericChildren.size();
+				ChildCollector collector(node, genericChildren);
+				node->traverse(collector);
+				if(genericChildren.size() == begin)
+					return false;
+				frames.push_back({node, nullptr, 0, genericChildren.size() - begin, begin});
+			}
+			return true;
+		}
+
+		//! @return The next child of the top frame or nullptr if all children have been visited.
+		Node * nextChild() {
+			Frame & frame = frames.back();
+			if(frame.next >= frame.count)
+				return nullptr;
+			const size_t index = frame.next++;
+			return frame.listNode != nullptr ? frame.listNode->getChild(index) : genericChildren[frame.genericBegin + index];
+		}
+
+		//! Remove the top frame and return its node.
+		Node * pop() {
+			const Frame & frame = frames.back();
+			Node * node = frame.node;
+			if(frame.listNode == nullptr)
+				genericChildren.resize(frame.genericBegin);
+			frames.pop_back();
+			return node;
+		}
+
+		void clear() {
+			frames.clear();
+			genericChildren.clear();
+		}
+};
+
+/**
+ * Provides the thread local stack for the lifetime of the object. If the thread
+ * local stack is already used by an enclosing traversal (e.g. a traversal started
+ * from a callback), a separate stack is provided instead.
+ */
+class LocalStack {
+	public:
+		LocalStack() : shared(getShared()), borrowed(!shared.inUse) {
+			shared.inUse = true;
+		}
+		~LocalStack() {
+			if(borrowed)
+				shared.inUse = false;
+		}
+		LocalStack(const LocalStack &) = delete;
+		LocalStack & operator=(const LocalStack &) = delete;
+
+		Stack & get()	{	return borrowed ? shared.stack : ownStack;	}
+
+	private:
+		struct Shared {
+			Stack stack;
+			bool inUse = false;
+		};
+		static Shared & getShared() {
+			static thread_local Shared shared;
+			return shared;
+		}
+
+		Shared & shared;
+		const bool borrowed;
+		Stack ownStack;
+};
+
+/**
+ * Traverse the subtree of @p root; @p enter and @p leave are called with a Node *
+ * and return a NodeVisitor::status.
+ * @return EXIT_TRAVERSAL if the traversal has been stopped, otherwise the result of leaving the root.
+ */
+template<typename Enter_t, typename Leave_t>
+NodeVisitor::status traverse(Node * root, Enter_t && enter, Leave_t && leave, Stack & stack) {
+	if(root == nullptr)
+		return NodeVisitor::CONTINUE_TRAVERSAL;
+	stack.clear();
+	NodeVisitor::status status = enter(root);
+	if(status == NodeVisitor::EXIT_TRAVERSAL)
+		return NodeVisitor::EXIT_TRAVERSAL;
+	if(status != NodeVisitor::CONTINUE_TRAVERSAL || !stack.push(root))
+		return leave(root);
+	while(true) {
+		Node * child = stack.nextChild();
+		if(child != nullptr) {
+			status = enter(child);
+			if(status == NodeVisitor::EXIT_TRAVERSAL) {
+				stack.clear();
+				return NodeVisitor::EXIT_TRAVERSAL;
+			}
+			if(status == NodeVisitor::CONTINUE_TRAVERSAL && stack.push(child))
+				continue;
+			if(leave(child) == NodeVisitor::EXIT_TRAVERSAL) {
+				stack.clear();
+				return NodeVisitor::EXIT_TRAVERSAL;
+			}
+		} else {
+			Node * node = stack.pop();
+			status = leave(node);
+			if(stack.frames.empty())
+				return status;
+			if(status == NodeVisitor::EXIT_TRAVERSAL) {
+				stack.clear();
+				return NodeVisitor::EXIT_TRAVERSAL;
+			}
+		}
+	}
+}
+
+template<typename Enter_t, typename Leave_t>
+NodeVisitor::status traverse(Node * root, Enter_t && enter, Leave_t && leave) {
+	LocalStack stack;
+	return traverse(root, std::forward<Enter_t>(enter), std::forward<Leave_t>(leave), stack.get());
+}
+
+//! Callback for traverse() that does nothing.
+struct Continue {
+	NodeVisitor::status operator()(Node *) const	{	return NodeVisitor::CONTINUE_TRAVERSAL;	}
+};
+
+/**
+ * Pre-order traversal of the subtree; @p enter returns a NodeVisitor::status
+ * (BREAK_TRAVERSAL skips the subtree of the node).
+ */
+template<typename Enter_t>
+NodeVisitor::status traverseTopDown(Node * root, Enter_t && enter, Stack & stack) {
+	return traverse(root, std::forward<Enter_t>(enter), Continue(), stack);
+}
+
+template<typename Enter_t>
+NodeVisitor::status traverseTopDown(Node * root, Enter_t && enter) {
+	LocalStack stack;
+	return traverse(root, std::forward<Enter_t>(enter), Continue(), stack.get());
+}
+
+//! Call @p func for all nodes of type @p _T in pre-order.
+template<typename _T = Node, typename Func_t>
+void forEachNodeTopDown(Node * root, Func_t && func, Stack & stack) {
+	traverse(root, [&func](Node * node) {
+					_T * castedNode = dynamic_cast<_T *>(node);
+					if(castedNode != nullptr)
+						func(castedNode);
+					return NodeVisitor::CONTINUE_TRAVERSAL;
+				}, Continue(), stack);
+}
+
+template<typename _T = Node, typename Func_t>
+void forEachNodeTopDown(Node * root, Func_t && func) {
+	LocalStack stack;
+	forEachNodeTopDown<_T>(root, std::forward<Func_t>(func), stack.get());
+}
+
+//! Call @p func for all nodes of type @p _T in post-order.
+template<typename _T = Node, typename Func_t>
+void forEachNodeBottomUp(Node * root, Func_t && func, Stack & stack) {
+	traverse(root, Continue(), [&func](Node * node) {
+					_T * castedNode = dynamic_cast<_T *>(node);
+					if(castedNode != nullptr)
+						func(castedNode);
+					return NodeVisitor::CONTINUE_TRAVERSAL;
+				}, stack);
+}
+
+template<typename _T = Node, typename Func_t>
+void forEachNodeBottomUp(Node * root, Func_t && func) {
+	LocalStack stack;
+	forEachNodeBottomUp<_T>(root, std::forward<Func_t>(func), stack.get());
+}
+
+}
+
+//! @}
+}
+
+#endif /* MINSG_HELPER_NODETRAVERSAL_H */
@@ -0,0 +1,186 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "ParallelCulling.h"
+#include "../Core/NodeVisitor.h"
+#include "../Core/Nodes/GroupNode.h"
+#include "../Core/Nodes/Node.h"
+#include <Geometry/Box.h>
+#include <Geometry/Frustum.h>
+#include <Util/Macros.h>
+#include <algorithm>
+#include <utility>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace MinSG {
+
+namespace {
+
+//! Subtree that is culled by one task.
+struct Task {
+	Node * root;
+	bool inside;
+	//! Nodes collected by the sequential pass in front of this subtree.
+	std::vector<Node *> preceding;
+	std::vector<Node *> result;
+
+	Task(Node * _root, bool _inside, std::vector<Node *> && _preceding) :
+		root(_root), inside(_inside), preceding(std::move(_preceding)) {}
+};
+
+//! Culling of a subtree (\see collectNodesInFrustum()).
+struct CullingVisitor : public NodeVisitor {
+	const Geometry::Frustum & frustum;
+	const bool includeIntersectingNodes;
+	bool (*filter)(Node *);
+	std::vector<Node *> & nodes;
+	uint32_t insideFrustum;
+
+	CullingVisitor(const Geometry::Frustum & _frustum, bool _includeIntersectingNodes, bool (*_filter)(Node *),
+					std::vector<Node *> & _nodes, bool inside) :
+		frustum(_frustum), includeIntersectingNodes(_includeIntersectingNodes), filter(_filter), nodes(_nodes),
+		insideFrustum(inside ? 1 : 0) {}
+	virtual ~CullingVisitor() {}
+
+	NodeVisitor::status enter(Node * node) override {
+		if(!node->isActive()) {
+			return BREAK_TRAVERSAL;
+		} else if(insideFrustum > 0) {
+			++insideFrustum;
+		} else {
+			const auto result = frustum.isBoxInFrustum(node->getWorldBB());
+			if(result == Geometry::Frustum::intersection_t::INSIDE) {
+				++insideFrustum;
+			} else if(result == Geometry::Frustum::intersection_t::INTERSECT) {
+				if(!includeIntersectingNodes)
+					return CONTINUE_TRAVERSAL;
+			} else {
+				return BREAK_TRAVERSAL;
+			}
+		}
+		if(filter(node))
+			nodes.push_back(node);
+		return CONTINUE_TRAVERSAL;
+	}
+
+	NodeVisitor::status leave(Node * /*node*/) override {
+		if(insideFrustum > 0)
+			--insideFrustum;
+		return CONTINUE_TRAVERSAL;
+	}
+};
+
+/*! Sequential pass over the nodes above the split depth. Creates a task for
+	every GroupNode at the split depth that has not been culled.	*/
+struct SplitVisitor : public NodeVisitor {
+	const Geometry::Frustum & frustum;
+	const ParallelCullingParameters & parameters;
+	bool (*filter)(Node *);
+	std::vector<Task> & tasks;
+	std::vector<Node *> pending;
+	//! For each node on the current path: is the node completely inside of the frustum?
+	std::vector<bool> insidePath;
+
+	SplitVisitor(const Geometry::Frustum & _frustum, const ParallelCullingParameters & _parameters,
+				bool (*_filter)(Node *), std::vector<Task> & _tasks) :
+		frustum(_frustum), parameters(_parameters), filter(_filter), tasks(_tasks) {}
+	virtual ~SplitVisitor() {}
+
+	NodeVisitor::status enter(Node * node) override {
+		const bool parentInside = !insidePath.empty() && insidePath.back();
+		insidePath.push_back(parentInside);
+		if(!node->isActive())
+			return BREAK_TRAVERSAL;
+		if(insidePath.size() > parameters.splitDepth && dynamic_cast<GroupNode *>(node) != nullptr) {
+			tasks.emplace_back(node, parentInside, std::move(pending));
+			pending.clear();
+			return BREAK_TRAVERSAL;
+		}
+		// validate the world matrix and box; the tasks below only read them
+		node->getWorldTransformationMatrixPtr();
+		const Geometry::Box & worldBB = node->getWorldBB();
+		if(!parentInside) {
+			const auto result = frustum.isBoxInFrustum(worldBB);
+			if(result == Geometry::Frustum::intersection_t::INSIDE) {
+				insidePath.back() = true;
+			} else if(result == Geometry::Frustum::intersection_t::INTERSECT) {
+				if(!parameters.includeIntersectingNodes)
+					return CONTINUE_TRAVERSAL;
+			} else {
+				return BREAK_TRAVERSAL;
+			}
+		}
+		if(filter(node))
+			pending.push_back(node);
+		return CONTINUE_TRAVERSAL;
+	}
+
+	NodeVisitor::status leave(Node * /*node*/) override {
+		insidePath.pop_back();
+		return CONTINUE_TRAVERSAL;
+	}
+};
+
+}
+
+std::vector<Node *> collectNodesInFrustumParallel(Node * root, const Geometry::Frustum & frustum,
+												const ParallelCullingParameters & parameters, bool (*filter)(Node *)) {
+	std::vector<Node *> nodes;
+	if(root == nullptr)
+		return nodes;
+
+	std::vector<Task> tasks;
+	SplitVisitor splitVisitor(frustum, parameters, filter, tasks);
+	root->traverse(splitVisitor);
+
+	const int taskCount = static_cast<int>(tasks.size());
+#ifdef _OPENMP
+	const int threadCount = parameters.threadCount > 0 ? static_cast<int>(parameters.threadCount) : omp_get_max_threads();
+#endif
+COMPILER_WARN_PUSH
+COMPILER_WARN_OFF_CLANG(-Wunknown-pragmas)
+#pragma omp parallel for schedule(dynamic, 1) num_threads(threadCount) if(taskCount > 1)
+	for(int i = 0; i < taskCount; ++i) {
+		CullingVisitor visitor(frustum, parameters.includeIntersectingNodes, filter, tasks[i].result, tasks[i].inside);
+		tasks[i].root->traverse(visitor);
+	}
+COMPILER_WARN_POP
+
+	// concatenate the results in traversal order
+	size_t count = splitVisitor.pending.size();
+	for(const auto & task : tasks)
+		count += task.preceding.size() + task.result.size();
+	nodes.reserve(count);
+	for(const auto & task : tasks) {
+		nodes.insert(nodes.end(), task.preceding.begin(), task.preceding.end());
+		nodes.insert(nodes.end(), task.result.begin(), task.result.end());
+	}
+	nodes.insert(nodes.end(), splitVisitor.pending.begin(), splitVisitor.pending.end());
+
+	if(parameters.sortFrontToBack) {
+		const int nodeCount = static_cast<int>(nodes.size());
+		std::vector<std::pair<float, Node *>> distances(nodes.size());
+COMPILER_WARN_PUSH
+COMPILER_WARN_OFF_CLANG(-Wunknown-pragmas)
+#pragma omp parallel for num_threads(threadCount) if(nodeCount > 4096)
+		for(int i = 0; i < nodeCount; ++i)
+			distances[i] = std::make_pair(nodes[i]->getWorldBB().getDistanceSquared(frustum.getPos()), nodes[i]);
+COMPILER_WARN_POP
+		std::stable_sort(distances.begin(), distances.end(),
+						[](const std::pair<float, Node *> & a, const std::pair<float, Node *> & b) {
+							return a.first < b.first;
+						});
+		for(int i = 0; i < nodeCount; ++i)
+			nodes[i] = distances[i].second;
+	}
+	return nodes;
+}
+
+}
@@ -0,0 +1,72 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_HELPER_PARALLELCULLING_H
+#define MINSG_HELPER_PARALLELCULLING_H
+
+#include <cstdint>
+#include <vector>
+
+namespace Geometry {
+class Frustum;
+}
+namespace MinSG {
+class Node;
+
+/** @addtogroup helper
+ * @{
+ */
+
+struct ParallelCullingParameters {
+	//! Nodes at this depth (relative to the root) become the roots of the parallel tasks.
+	uint32_t splitDepth;
+	//! Number of threads; 0 uses the OpenMP default.
+	uint32_t threadCount;
+	//! If @c false, only nodes completely inside of the frustum are collected.
+	bool includeIntersectingNodes;
+	//! Sort the result by the distance of the nodes' world bounding boxes to the frustum position.
+	bool sortFrontToBack;
+
+	ParallelCullingParameters() :
+		splitDepth(4), threadCount(0), includeIntersectingNodes(true), sortFrontToBack(false) {}
+};
+
+/**
+ * Parallel version of collectNodesInFrustum().
+ *
+ * The hierarchy above @a splitDepth is culled sequentially. This pass also
+ * validates the world matrices and bounding boxes of these nodes, so that the
+ * subtrees below can be culled concurrently without writing to shared nodes.
+ * The subtrees are processed by an OpenMP loop with dynamic scheduling.
+ * The partial results are concatenated in traversal order, so the result
+ * equals the result of collectNodesInFrustum() (unless @a sortFrontToBack is
+ * set, which sorts the result stably by distance).
+ *
+ * @param filter Only nodes for which the filter returns @c true are collected.
+ * @note The scene graph must not be modified during the call.
+ */
+std::vector<Node *> collectNodesInFrustumParallel(Node * root, const Geometry::Frustum & frustum,
+												const ParallelCullingParameters & parameters, bool (*filter)(Node *));
+
+//! Collect all nodes of type @c _T in the subtree that intersect the frustum (\see collectNodesInFrustum()).
+template<typename _T>
+std::vector<_T *> collectNodesInFrustumParallel(Node * root, const Geometry::Frustum & frustum,
+												const ParallelCullingParameters & parameters = ParallelCullingParameters()) {
+	const auto nodes = collectNodesInFrustumParallel(root, frustum, parameters,
+													[](Node * node) { return dynamic_cast<_T *>(node) != nullptr; });
+	std::vector<_T *> result;
+	result.reserve(nodes.size());
+	for(const auto & node : nodes)
+		result.push_back(static_cast<_T *>(node));
+	return result;
+}
+
+//! @}
+}
+
+#endif // MINSG_HELPER_PARALLELCULLING_H
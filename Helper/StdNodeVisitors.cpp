@@ -29,36 +29,14 @@ namespace MinSG {
 // ----------------------------------------------------------------------------------------------------
 template<>
 void forEachNodeTopDown<Node>(Node * root, const std::function<void (Node *)>& func) { // Specialization for Node
-	if(root == nullptr) {
-		return;
-	}
-	struct Visitor : public NodeVisitor {
-		const std::function<void (Node *)>& m_func;
-		Visitor(const std::function<void (Node *)> & p_func) : m_func(p_func) {
-		}
-		virtual ~Visitor() = default;
-		NodeVisitor::status enter(Node * node) override {
-			// Use enter() to perform a pre-order tree walk
-			m_func(node);
-			return CONTINUE_TRAVERSAL;
-		}
-	} visitor(func);
-	root->traverse(visitor);
+	NodeTraversal::traverseTopDown(root, [&func](Node * node) {
+		func(node);
+		return NodeVisitor::CONTINUE_TRAVERSAL;
+	});
 }
 template<>
 void traverseTopDown<Node>(Node * root, std::function<NodeVisitor::status (Node *)> func) {
-	if(root) {
-		struct Visitor : public NodeVisitor {
-			std::function<NodeVisitor::status (Node *)> m_func;
-			Visitor(std::function<NodeVisitor::status (Node *)> p_func) : m_func(std::move(p_func)) {}
-			virtual ~Visitor() = default;
-		
-			NodeVisitor::status enter(Node * node) override {	// Use enter() to perform a pre-order tree walk
-				return m_func(node);
-			}
-		} visitor(func);
-		root->traverse(visitor);
-	}
+	NodeTraversal::traverseTopDown(root, func);
 }
 
 
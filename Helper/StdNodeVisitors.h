@@ -15,6 +15,7 @@
 #include "../Core/Nodes/GroupNode.h"
 #include "../Core/Nodes/Node.h"
 #include "../Core/Nodes/AbstractCameraNode.h"
+#include "NodeTraversal.h"
 
 #include <Geometry/Box.h>
 
@@ -38,6 +39,7 @@ class GeometryNode;
  *
  * Execute the given function @p func for all nodes of type @p _T in the subtree specified by its root node @p root.
  * A depth-first, pre-order tree walk is performed on the subtree.
+ * \see NodeTraversal for a variant without the overhead of std::function.
  *
  * @tparam _T The type of the nodes for which the function will be executed
  * @param root The root node of the subtree that will be traversed
@@ -47,24 +49,7 @@ class GeometryNode;
  */
 template<typename _T=Node>
 void forEachNodeTopDown(Node * root, const std::function<void (_T *)>& func) {
-	if(root == nullptr) {
-		return;
-	}
-	struct Visitor : public NodeVisitor {
-		const std::function<void (_T *)>& m_func;
-		Visitor(const std::function<void (_T *)> & p_func) : m_func(p_func) {
-		}
-		virtual ~Visitor() = default;
-		NodeVisitor::status enter(Node * node) override {
-			// Use enter() to perform a pre-order tree walk
-			_T * castedNode = dynamic_cast<_T *>(node);
-			if(castedNode != nullptr) {
-				m_func(castedNode);
-			}
-			return CONTINUE_TRAVERSAL;
-		}
-	} visitor(func);
-	root->traverse(visitor);
+	NodeTraversal::forEachNodeTopDown<_T>(root, func);
 }
 template<>
 void forEachNodeTopDown<Node>(Node * root, const std::function<void (Node *)>& func);
@@ -87,25 +72,7 @@ inline void forEachNodeTopDown(Node* root,const std::function<void (Node *)>& fu
  */
 template<typename _T=Node>
 void forEachNodeBottomUp(Node * root, const std::function<void (_T *)>& func) {
-	if(root == nullptr) {
-		return;
-	}
-	struct Visitor : public NodeVisitor {
-		const std::function<void (_T *)>& m_func;
-		Visitor(const std::function<void (_T *)>& p_func) : m_func(p_func) {
-		}
-		virtual ~Visitor() = default;
-
-		NodeVisitor::status leave(Node * node) override {
-			// Use leave() to perform a post-order tree walk
-			_T * castedNode = dynamic_cast<_T *>(node);
-			if(castedNode != nullptr) {
-				m_func(castedNode);
-			}
-			return CONTINUE_TRAVERSAL;
-		}
-	} visitor(func);
-	root->traverse(visitor);
+	NodeTraversal::forEachNodeBottomUp<_T>(root, func);
 }
 /**
  * @brief Execute a function top-down for nodes in a subtree
@@ -119,20 +86,10 @@ void forEachNodeBottomUp(Node * root, const std::function<void (_T *)>& func) {
  */
 template<typename _T=Node>
 void traverseTopDown(Node * root, std::function<NodeVisitor::status (_T *)> func) {
-	if(root) {
-		struct Visitor : public NodeVisitor {
-			std::function<NodeVisitor::status (_T *)> m_func;
-			Visitor(std::function<NodeVisitor::status (_T *)> p_func) : m_func(p_func) {}
-			virtual ~Visitor() = default;
-
-			// Use enter() to perform a pre-order tree walk
-			NodeVisitor::status enter(Node * node) override {
-				_T * castedNode = dynamic_cast<_T *>(node);
-				return castedNode ? m_func(castedNode) : CONTINUE_TRAVERSAL;
-			}
-		} visitor(func);
-		root->traverse(visitor);
-	}
+	NodeTraversal::traverseTopDown(root, [&func](Node * node) {
+		_T * castedNode = dynamic_cast<_T *>(node);
+		return castedNode ? func(castedNode) : NodeVisitor::CONTINUE_TRAVERSAL;
+	});
 }
 template<>
 void traverseTopDown<Node>(Node * root, std::function<NodeVisitor::status (Node *)> func);
@@ -0,0 +1,94 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_SCENEMANAGEMENT_BINARYSCENEFORMAT_H
+#define MINSG_SCENEMANAGEMENT_BINARYSCENEFORMAT_H
+
+#include <cstdint>
+
+namespace MinSG {
+namespace SceneManagement {
+
+/**
+ * Layout of binary MinSG scene files (".msgb"), written by WriterMinSGBinary and
+ * read by ReaderMinSGBinary.
+ *
+ * A file stores the same description tree as a MinSG XML file, but in tables
+ * that can be used directly from a memory mapped file:
+ *  - Header
+ *  - String table: (stringCount + 1) uint32_t offsets relative to the end of
+ *    the offsets, followed by the characters of all strings (not terminated).
+ *  - Element table: one Element per DescriptionMap in pre-order; the first
+ *    element is the scene.
+ *  - Attribute table: the attributes of all elements, consecutive per element.
+ *  - Mesh table: one Mesh per distinct mesh of the scene.
+ *  - Mesh payloads, each aligned to PAYLOAD_ALIGNMENT bytes.
+ *
+ * All offsets are relative to the beginning of the file. All values are stored
+ * in native byte order.
+ */
+namespace BinarySceneFormat {
+
+static const char MAGIC[4] = {'M', 'S', 'G', 'B'};
+static const uint32_t VERSION = 1;
+static const uint32_t PAYLOAD_ALIGNMENT = 16;
+static const uint32_t NO_PARENT = 0xffffffff;
+
+struct Header {
+	char magic[4];
+	uint32_t version;
+	uint32_t stringCount;
+	uint32_t elementCount;
+	uint32_t attributeCount;
+	uint32_t meshCount;
+	uint64_t stringTableOffset;
+	uint64_t elementTableOffset;
+	uint64_t attributeTableOffset;
+	uint64_t meshTableOffset;
+};
+
+struct Element {
+	//! Index of the string with the value of Consts::TYPE
+	uint32_t type;
+	//! Index of the parent element or NO_PARENT; elements named "defs" are the definitions of their parent.
+	uint32_t parent;
+	uint32_t firstAttribute;
+	uint32_t attributeCount;
+};
+
+enum valueType_t : uint32_t {
+	//! The value is the index of a string.
+	VALUE_STRING = 0,
+	//! The value is the index of a mesh (stored as Rendering::Serialization::MeshWrapper_t).
+	VALUE_MESH = 1
+};
+
+struct Attribute {
+	//! Index of the string with the key
+	uint32_t key;
+	uint32_t valueType;
+	uint32_t value;
+};
+
+struct Mesh {
+	/*! MMF data of an empty mesh with the vertex description, the draw mode and
+		the index usage of the mesh.	*/
+	uint64_t layoutOffset;
+	uint64_t layoutSize;
+	uint64_t vertexCount;
+	uint64_t vertexDataOffset;
+	uint64_t vertexDataSize;
+	uint64_t indexCount;
+	uint64_t indexDataOffset;
+};
+
+}
+}
+}
+
+#endif /* MINSG_SCENEMANAGEMENT_BINARYSCENEFORMAT_H */
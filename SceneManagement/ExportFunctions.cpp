@@ -9,21 +9,30 @@
 	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
 */
 #include "ExportFunctions.h"
+#include "SceneChangeTracker.h"
+#include "SplitSceneFormat.h"
 #include "Exporter/ExporterTools.h"
 #include "Exporter/WriterMinSG.h"
+#include "Exporter/WriterMinSGBinary.h"
 
 #include <Util/IO/FileName.h>
+#include <Util/GenericAttribute.h>
 #include <Util/IO/FileUtils.h>
 #include <Util/Timer.h>
 #include <Util/Utils.h>
 
 #include "../Core/Nodes/GeometryNode.h"
+#include "../Core/Nodes/GroupNode.h"
 #include "../Helper/StdNodeVisitors.h"
 
 #include <Rendering/Mesh/Mesh.h>
 #include <Rendering/Serialization/Serialization.h>
 #include <Rendering/Serialization/GenericAttributeSerialization.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
 #include <unordered_set>
 
 namespace MinSG{
@@ -82,7 +91,27 @@ void SceneManagement::saveMeshesInSubtreeAsMMF(Node * rootNode, const std::strin
 }
 
 
-void SceneManagement::saveMinSGFile(SceneManager & sm, const Util::FileName & fileName, const std::deque<Node *> & nodes) {
+//! Bits per position component used by EXPORT_OPTION_QUANTIZE_MESHES.
+static uint32_t meshQuantizationBits = 16;
+
+void SceneManagement::setMeshQuantizationBits(uint32_t positionBits) {
+	meshQuantizationBits = std::max<uint32_t>(1, std::min<uint32_t>(positionBits, 24));
+}
+
+//! (internal) Apply the export options to the context.
+static void initExporterContext(SceneManagement::ExporterContext & ctxt, SceneManagement::exportOption_t exportOptions) {
+	ctxt.shareEqualMeshes = (exportOptions & SceneManagement::EXPORT_OPTION_SHARE_EQUAL_MESHES) > 0;
+	ctxt.compressMeshes = (exportOptions & (SceneManagement::EXPORT_OPTION_COMPRESS_MESHES | SceneManagement::EXPORT_OPTION_QUANTIZE_MESHES)) > 0;
+	ctxt.meshPositionBits = (exportOptions & SceneManagement::EXPORT_OPTION_QUANTIZE_MESHES) > 0 ? meshQuantizationBits : 0;
+}
+
+//! (internal) Report the effect of the export options.
+static void reportExport(const SceneManagement::ExporterContext & ctxt) {
+	if(ctxt.shareEqualMeshes)
+		Util::info << "Shared meshes: " << ctxt.sharedMeshes.size() << " unique meshes stored, " << ctxt.sharedMeshBytesSaved << " bytes saved.\n";
+}
+
+void SceneManagement::saveMinSGFile(SceneManager & sm, const Util::FileName & fileName, const std::deque<Node *> & nodes, exportOption_t exportOptions) {
 	// generate output
 	auto out = Util::FileUtils::openForWriting(fileName);
 	if(!out)
@@ -90,18 +119,160 @@ void SceneManagement::saveMinSGFile(SceneManager & sm, const Util::FileName & fi
 
 	ExporterContext ctxt(sm);
 	ctxt.sceneFile = fileName;
+	initExporterContext(ctxt, exportOptions);
 	std::unique_ptr<DescriptionMap> description(ExporterTools::createDescriptionForScene(ctxt, nodes));
 	if(!WriterMinSG::save(*(out.get()), *(description.get())))
 		throw std::runtime_error("Could not export scene to file " + fileName.toString());
+	reportExport(ctxt);
+}
+
+void SceneManagement::saveMinSGBinaryFile(SceneManager & sm, const Util::FileName & fileName, const std::deque<Node *> & nodes, exportOption_t exportOptions) {
+	auto out = Util::FileUtils::openForWriting(fileName);
+	if(!out)
+		throw std::runtime_error("Cannot write to file " + fileName.toString());
+
+	ExporterContext ctxt(sm);
+	ctxt.sceneFile = fileName;
+	ctxt.storeMeshObjects = true;
+	initExporterContext(ctxt, exportOptions);
+	std::unique_ptr<DescriptionMap> description(ExporterTools::createDescriptionForScene(ctxt, nodes));
+	if(!WriterMinSGBinary::save(*(out.get()), *(description.get())))
+		throw std::runtime_error("Could not export scene to file " + fileName.toString());
+	reportExport(ctxt);
 }
 
-void SceneManagement::saveMinSGStream(SceneManager & sm, std::ostream & out, const std::deque<Node *> & nodes) {
+void SceneManagement::saveMinSGStream(SceneManager & sm, std::ostream & out, const std::deque<Node *> & nodes, exportOption_t exportOptions) {
 	if(!out.good())
 		throw std::runtime_error("Cannot save MinSG nodes to the given stream.");
 
 	ExporterContext ctxt(sm);
+	initExporterContext(ctxt, exportOptions);
 	std::unique_ptr<DescriptionMap> description(ExporterTools::createDescriptionForScene(ctxt, nodes));
 	if(!WriterMinSG::save(out, *(description.get())))
 		throw std::runtime_error("Could not serialize MinSG nodes.");
+	reportExport(ctxt);
+}
+
+//! (internal) Return the name of the next file of a split scene.
+static std::string createSplitSceneFileName(const Util::FileName & fileName, SceneManagement::SplitSceneFormat::Manifest & manifest, const std::string & suffix) {
+	std::string stem = fileName.getFile();
+	if(!fileName.getEnding().empty())
+		stem.resize(stem.size() - fileName.getEnding().size() - 1);
+	std::ostringstream name;
+	name << stem << '.' << (manifest.nextFileNumber++) << suffix;
+	return name.str();
+}
+
+//! (internal) Collect the nodes at @p depth below @p node together with their paths in depth-first order.
+static void collectSplitSceneParts(Node * node, uint32_t depth, std::vector<uint32_t> & path,
+								   std::vector<Node *> & partNodes, std::vector<SceneManagement::SplitSceneFormat::Part> & parts) {
+	if(depth == 0) {
+		partNodes.push_back(node);
+		parts.emplace_back();
+		parts.back().path = path;
+		return;
+	}
+	uint32_t index = 0;
+	for(const auto & child : getChildNodes(node)) {
+		path.push_back(index++);
+		collectSplitSceneParts(child, depth - 1, path, partNodes, parts);
+		path.pop_back();
+	}
+}
+
+void SceneManagement::saveMinSGSplitScene(SceneManager & sm, const Util::FileName & fileName, SceneChangeTracker & tracker, exportOption_t exportOptions) {
+	GroupNode * root = tracker.getRoot();
+	const Util::StringIdentifier partFileAttribute = SplitSceneFormat::getPartFileAttribute();
+
+	SplitSceneFormat::Manifest oldManifest;
+	SplitSceneFormat::loadManifest(fileName, oldManifest);
+	std::unordered_set<std::string> oldPartFiles;
+	for(const auto & part : oldManifest.parts)
+		oldPartFiles.insert(part.file);
+
+	SplitSceneFormat::Manifest manifest;
+	manifest.nextFileNumber = oldManifest.nextFileNumber;
+	manifest.partDepth = tracker.getPartDepth();
+	std::vector<Node *> partNodes;
+	{
+		std::vector<uint32_t> path;
+		collectSplitSceneParts(root, tracker.getPartDepth(), path, partNodes, manifest.parts);
+	}
+
+	const auto changedSubtrees = tracker.collectChangedSubtrees();
+	const std::unordered_set<Node *> changedSubtreeSet(changedSubtrees.begin(), changedSubtrees.end());
+	std::vector<Util::FileName> writtenFiles;
+	try {
+		// parts: unchanged subtrees keep their files
+		for(std::size_t i = 0; i < partNodes.size(); ++i) {
+			Node * partNode = partNodes[i];
+			SplitSceneFormat::Part & part = manifest.parts[i];
+			Util::FileName partFile(fileName);
+			const Util::GenericAttribute * attribute = partNode->getAttribute(partFileAttribute);
+			if(attribute != nullptr && changedSubtreeSet.count(partNode) == 0 && oldPartFiles.count(attribute->toString()) != 0) {
+				partFile.setFile(attribute->toString());
+				if(Util::FileUtils::isFile(partFile)) {
+					part.file = attribute->toString();
+					continue;
+				}
+			}
+			part.file = createSplitSceneFileName(fileName, manifest, ".msgb");
+			partFile.setFile(part.file);
+			writtenFiles.emplace_back(partFile);
+			saveMinSGBinaryFile(sm, partFile, std::deque<Node *>(1, partNode), exportOptions);
+			partNode->setAttribute(partFileAttribute, Util::GenericAttribute::createString(part.file));
+		}
+
+		// root node and the nodes above the parts
+		if(tracker.isRootChanged() || oldManifest.rootFile.empty() || oldManifest.partDepth != manifest.partDepth) {
+			manifest.rootFile = createSplitSceneFileName(fileName, manifest, ".root.minsg");
+			Util::FileName rootFile(fileName);
+			rootFile.setFile(manifest.rootFile);
+			writtenFiles.emplace_back(rootFile);
+
+			auto out = Util::FileUtils::openForWriting(rootFile);
+			if(!out)
+				throw std::runtime_error("Cannot write to file " + rootFile.toString());
+			ExporterContext ctxt(sm);
+			ctxt.sceneFile = rootFile;
+			ctxt.childNodeDepthLimit = tracker.getPartDepth() - 1;
+			std::unique_ptr<DescriptionMap> description(ExporterTools::createDescriptionForScene(ctxt, std::deque<Node *>(1, root)));
+			if(!WriterMinSG::save(*(out.get()), *(description.get())))
+				throw std::runtime_error("Could not export scene to file " + rootFile.toString());
+		} else {
+			manifest.rootFile = oldManifest.rootFile;
+		}
+
+		// replace the manifest
+		Util::FileName tmpFile(fileName);
+		tmpFile.setFile(fileName.getFile() + ".tmp");
+		writtenFiles.emplace_back(tmpFile);
+		if(!SplitSceneFormat::saveManifest(tmpFile, manifest) || std::rename(tmpFile.getPath().c_str(), fileName.getPath().c_str()) != 0)
+			throw std::runtime_error("Cannot write to file " + fileName.toString());
+	} catch(...) {
+		// the old manifest is still valid
+		for(const auto & writtenFile : writtenFiles)
+			Util::FileUtils::remove(writtenFile);
+		throw;
+	}
+
+	// remove the files that are no longer referenced
+	std::unordered_set<std::string> usedFiles;
+	for(const auto & part : manifest.parts)
+		usedFiles.insert(part.file);
+	usedFiles.insert(manifest.rootFile);
+	std::vector<std::string> oldFiles(oldPartFiles.begin(), oldPartFiles.end());
+	if(!oldManifest.rootFile.empty())
+		oldFiles.emplace_back(oldManifest.rootFile);
+	for(const auto & oldFile : oldFiles) {
+		if(usedFiles.count(oldFile) == 0) {
+			Util::FileName obsoleteFile(fileName);
+			obsoleteFile.setFile(oldFile);
+			Util::FileUtils::remove(obsoleteFile);
+		}
+	}
+
+	tracker.clear();
+	Util::info << "Split scene: " << (writtenFiles.size() - 1) << " of " << (manifest.parts.size() + 1) << " files written.\n";
 }
 }
@@ -12,6 +12,7 @@
 #define SCENE_EXPORT_H_
 
 #include <Util/IO/FileName.h>
+#include <cstdint>
 #include <deque>
 #include <iosfwd>
 
@@ -19,17 +20,55 @@ namespace MinSG {
 class Node;
 
 namespace SceneManagement {
+class SceneChangeTracker;
 class SceneManager;
 
+typedef uint32_t exportOption_t;
+static const exportOption_t EXPORT_OPTION_NONE = 0;
+/*! Store the data of equal meshes (same vertex and index data) only once; the other GeometryNodes reference
+	the stored mesh. The meshes are compared by a 64-bit content hash; matches are verified by comparing the data.
+	The number of saved bytes is reported to Util::info.	*/
+static const exportOption_t EXPORT_OPTION_SHARE_EQUAL_MESHES = 1<<0;
+/*! Store the meshes of MinSG XML files losslessly in a compressed encoding (\see MeshEncoding) instead of Base64 encoded MMF data.
+	Binary MinSG scene files are not affected.	*/
+static const exportOption_t EXPORT_OPTION_COMPRESS_MESHES = 1<<1;
+/*! Like EXPORT_OPTION_COMPRESS_MESHES, but positions, normals and colors are quantized (\see setMeshQuantizationBits).	*/
+static const exportOption_t EXPORT_OPTION_QUANTIZE_MESHES = 1<<2;
+
+/*! Set the number of bits per position component used by EXPORT_OPTION_QUANTIZE_MESHES (1 to 24; the default is 16).
+	The positions are quantized relative to the bounding box of each mesh.	*/
+void setMeshQuantizationBits(uint32_t positionBits);
+
 /*!	Save MinSG nodes to a file. Throws an exception on failure.
 	@param fileName Path that the new MinSG XML file will be saved to
-	@param nodes Array of nodes that will be saved	*/
-void saveMinSGFile(SceneManager & sm, const Util::FileName & fileName, const std::deque<Node *> & nodes);
+	@param nodes Array of nodes that will be saved
+	@param exportOptions Options controlling the export procedure	*/
+void saveMinSGFile(SceneManager & sm, const Util::FileName & fileName, const std::deque<Node *> & nodes, exportOption_t exportOptions = EXPORT_OPTION_NONE);
 
 /*!	Save MinSG nodes to a stream. Throws an exception on failure.
 	@param out Output stream to which the MinSG XML data will be written
-	@param nodes Array of nodes that will be saved	 */
-void saveMinSGStream(SceneManager & sm, std::ostream & out, const std::deque<Node *> & nodes);
+	@param nodes Array of nodes that will be saved
+	@param exportOptions Options controlling the export procedure	 */
+void saveMinSGStream(SceneManager & sm, std::ostream & out, const std::deque<Node *> & nodes, exportOption_t exportOptions = EXPORT_OPTION_NONE);
+
+/*!	Save MinSG nodes to a binary MinSG scene file (\see BinarySceneFormat). Meshes without
+	a file name are stored as raw vertex and index data. Throws an exception on failure.
+	@param fileName Path that the new binary MinSG file will be saved to (usually with the ending ".msgb")
+	@param nodes Array of nodes that will be saved
+	@param exportOptions Options controlling the export procedure	*/
+void saveMinSGBinaryFile(SceneManager & sm, const Util::FileName & fileName, const std::deque<Node *> & nodes, exportOption_t exportOptions = EXPORT_OPTION_NONE);
+
+/*!	Save the scene below the root node of @p tracker as split MinSG scene (\see SplitSceneFormat).
+	Only the subtrees that the tracker reports as changed are written into new part files, and the root
+	file is only written if the root node or a node above the part depth changed (or the part depth
+	differs from the saved one); the other subtrees keep their part files. Therefore,
+	the time for saving is proportional to the size of the changed subtrees. Afterwards, the manifest
+	@p fileName is replaced, files that are no longer referenced are removed, and the tracker is cleared.
+	Throws an exception on failure.
+	@param fileName Path of the manifest file (usually with the ending ".minsgs")
+	@param tracker Tracker of the root node that will be saved; the root node has to be a GroupNode
+	@param exportOptions Options controlling the export procedure of the parts	*/
+void saveMinSGSplitScene(SceneManager & sm, const Util::FileName & fileName, SceneChangeTracker & tracker, exportOption_t exportOptions = EXPORT_OPTION_NONE);
 
 /*!	Traverses the scene graph below @a rootNode and saves all meshes
 	that are found in GeometryNodes and that are not saved yet into PLY
@@ -24,7 +24,12 @@
 #include "../../Core/Nodes/CameraNode.h"
 #include "../../Core/Nodes/CameraNodeOrtho.h"
 
+#include "../MeshEncoding.h"
+#include "../MeshHashing.h"
+
 #include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
 #include <Rendering/Serialization/Serialization.h>
 
 #include <Util/Serialization/Serialization.h>
@@ -40,7 +45,37 @@ namespace MinSG {
 namespace SceneManagement {
 
 
-static void describeGeometryNode(ExporterContext & /*ctxt*/,DescriptionMap & desc, Node * node) {
+/*! (internal) Return the shared mesh with the same data as @p mesh, or nullptr if there is none.
+	@p hash is set to the content hash of @p mesh if it has to be calculated.	*/
+static const ExporterContext::SharedMesh * findSharedMesh(ExporterContext & ctxt, Rendering::Mesh * mesh, uint64_t & hash) {
+	const auto indexIt = ctxt.sharedMeshIndices.find(mesh);
+	if(indexIt != ctxt.sharedMeshIndices.end())
+		return &ctxt.sharedMeshes[indexIt->second];
+
+	hash = MeshHashing::calculateHash(mesh);
+	const auto bucketIt = ctxt.sharedMeshesByHash.find(hash);
+	if(bucketIt == ctxt.sharedMeshesByHash.end())
+		return nullptr;
+	for(const auto & index : bucketIt->second) {
+		if(MeshHashing::equalData(ctxt.sharedMeshes[index].mesh, mesh)) {
+			ctxt.sharedMeshIndices.emplace(mesh, index);
+			return &ctxt.sharedMeshes[index];
+		}
+	}
+	return nullptr;
+}
+
+/*! (internal) Add @p mesh, whose data has been stored successfully using @p dataSize bytes, to the shared meshes.
+	@return the id of the shared mesh	*/
+static const std::string & addSharedMesh(ExporterContext & ctxt, Rendering::Mesh * mesh, uint64_t hash, std::size_t dataSize) {
+	const std::size_t index = ctxt.sharedMeshes.size();
+	ctxt.sharedMeshes.push_back({mesh, "mesh" + Util::StringUtils::toString(index), dataSize});
+	ctxt.sharedMeshesByHash[hash].push_back(index);
+	ctxt.sharedMeshIndices.emplace(mesh, index);
+	return ctxt.sharedMeshes.back().meshId;
+}
+
+static void describeGeometryNode(ExporterContext & ctxt,DescriptionMap & desc, Node * node) {
 	desc.setString(Consts::ATTR_NODE_TYPE, Consts::NODE_TYPE_GEOMETRY);
 
 	std::unique_ptr<DescriptionMap> dataDesc(new DescriptionMap);
@@ -56,15 +91,54 @@ static void describeGeometryNode(ExporterContext & /*ctxt*/,DescriptionMap & des
 
 	Rendering::Mesh * m = gn->getMesh();
 	if(m!=nullptr) { // mesh present?
+		// share meshes with equal data; prototypes are stored before the nodes that are described first
+		const bool shareMesh = m->getFileName().empty() && ctxt.shareEqualMeshes && (ctxt.storeMeshObjects || !ctxt.creatingDefinitions);
+		uint64_t hash = 0;
+		if(shareMesh) {
+			const ExporterContext::SharedMesh * sharedMesh = findSharedMesh(ctxt, m, hash);
+			if(sharedMesh != nullptr) {
+				// pointer-equal meshes are stored only once in binary scenes anyway
+				if(!ctxt.storeMeshObjects || sharedMesh->mesh != m)
+					ctxt.sharedMeshBytesSaved += sharedMesh->dataSize;
+				dataDesc->setString(Consts::ATTR_DATA_TYPE,"mesh");
+				if(ctxt.storeMeshObjects)
+					dataDesc->setValue(Consts::ATTR_MESH_DATA,new Rendering::Serialization::MeshWrapper_t(sharedMesh->mesh));
+				else
+					dataDesc->setString(Consts::ATTR_REFERENCED_MESH_ID,sharedMesh->meshId);
+				ExporterTools::addDataEntry(desc, std::move(dataDesc));
+				return;
+			}
+		}
+
 		// no filename -> store data in .minsg
-		if(m->getFileName().empty()) {
-			std::ostringstream meshStream;
-			if(Rendering::Serialization::saveMesh(gn->getMesh(), "mmf", meshStream)) {
+		if(m->getFileName().empty() && ctxt.storeMeshObjects) {
+			dataDesc->setString(Consts::ATTR_DATA_TYPE,"mesh");
+			dataDesc->setValue(Consts::ATTR_MESH_DATA,new Rendering::Serialization::MeshWrapper_t(m));
+			if(shareMesh)
+				addSharedMesh(ctxt, m, hash, m->openVertexData().dataSize() +
+						(m->isUsingIndexData() ? m->openIndexData().getIndexCount() * sizeof(uint32_t) : 0));
+		} else if(m->getFileName().empty()) {
+			std::string meshString;
+			if(ctxt.compressMeshes) {
+				const std::vector<uint8_t> meshData = MeshEncoding::encodeMesh(m, ctxt.meshPositionBits);
+				if(!meshData.empty()) {
+					dataDesc->setString(Consts::ATTR_DATA_ENCODING,Consts::DATA_ENCODING_COMPRESSED_MESH_BASE64);
+					meshString = Util::encodeBase64(meshData);
+				}
+			} else {
+				std::ostringstream meshStream;
+				if(Rendering::Serialization::saveMesh(gn->getMesh(), "mmf", meshStream)) {
+					dataDesc->setString(Consts::ATTR_DATA_ENCODING,Consts::DATA_ENCODING_BASE64);
+					const std::string streamString = meshStream.str();
+					meshString = Util::encodeBase64(std::vector<uint8_t>(streamString.begin(), streamString.end()));
+				}
+			}
+			if(!meshString.empty()) {
 				dataDesc->setString(Consts::ATTR_DATA_TYPE,"mesh");
-				dataDesc->setString(Consts::ATTR_DATA_ENCODING,"base64");
-				const std::string streamString = meshStream.str();
-				const std::string meshString = Util::encodeBase64(std::vector<uint8_t>(streamString.begin(), streamString.end()));
 				dataDesc->setString(Consts::DATA_BLOCK,meshString);
+				// only meshes that have been stored can be referenced by the following nodes
+				if(shareMesh)
+					dataDesc->setString(Consts::ATTR_MESH_ID,addSharedMesh(ctxt, m, hash, meshString.size()));
 			}
 		} else { // filename given?
 			Util::FileName meshFilename(m->getFileName());
@@ -13,11 +13,15 @@
 
 #include <Util/IO/FileName.h>
 #include <Util/GenericAttribute.h>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <deque>
 #include <set>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace Geometry {
 template<typename _T> class _SRT;
@@ -26,6 +30,9 @@ typedef _SRT<float> SRT;
 namespace Util {
 class GenericAttributeMap;
 }
+namespace Rendering {
+class Mesh;
+}
 namespace MinSG {
 class Node;
 class State;
@@ -50,7 +57,37 @@ struct ExporterContext {
 		
 	Util::FileName sceneFile;
 
-	ExporterContext(SceneManager & _m) : sceneManager(_m),tmpNodeCounter(0),creatingDefinitions(false){}
+	/*! If true, meshes without a file name are stored as Rendering::Serialization::MeshWrapper_t in
+		the description instead of Base64 encoded MMF data (used by WriterMinSGBinary).	*/
+	bool storeMeshObjects;
+
+	/*! If true, meshes with equal vertex and index data are stored only once; the other GeometryNodes
+		reference the stored mesh by its id (\see EXPORT_OPTION_SHARE_EQUAL_MESHES). Meshes of prototypes
+		are always stored completely, because the definitions precede the scene.	*/
+	bool shareEqualMeshes;
+	struct SharedMesh {
+		Rendering::Mesh * mesh;
+		std::string meshId;
+		std::size_t dataSize;	//!< size of the stored data in bytes
+	};
+	std::vector<SharedMesh> sharedMeshes;
+	std::unordered_map<uint64_t, std::vector<std::size_t>> sharedMeshesByHash; // content hash -> indices of sharedMeshes
+	std::unordered_map<Rendering::Mesh *, std::size_t> sharedMeshIndices; // mesh -> index of the shared mesh with equal data
+	//! Number of bytes that have not been stored because of shared meshes.
+	std::size_t sharedMeshBytesSaved;
+
+	/*! Number of levels of child nodes that are described below the exported nodes (limited
+		for the root file of split scenes; \see saveMinSGSplitScene).	*/
+	uint32_t childNodeDepthLimit;
+	uint32_t childNodeDepth; // level of the currently described child nodes
+
+	/*! If true, meshes are stored with MeshEncoding instead of MMF data (\see EXPORT_OPTION_COMPRESS_MESHES).
+		The positions are quantized with meshPositionBits bits per component; zero means lossless.	*/
+	bool compressMeshes;
+	uint32_t meshPositionBits;
+
+	ExporterContext(SceneManager & _m) : sceneManager(_m),tmpNodeCounter(0),creatingDefinitions(false),storeMeshObjects(false),
+			shareEqualMeshes(false),sharedMeshBytesSaved(0),childNodeDepthLimit(UINT32_MAX),childNodeDepth(0),compressMeshes(false),meshPositionBits(0){}
 
 	void addFinalizingAction(const FinalizeAction & action) {
 		finalizeActions.push_back(action);
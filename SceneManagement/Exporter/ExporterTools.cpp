@@ -185,11 +185,15 @@ void ExporterTools::addDataEntry(DescriptionMap & description,std::unique_ptr<De
 
 //! (static)
 void ExporterTools::addChildNodesToDescription(ExporterContext & ctxt,DescriptionMap & description, Node * node){
+	if(ctxt.childNodeDepth >= ctxt.childNodeDepthLimit)
+		return;
+	++ctxt.childNodeDepth;
 	for(const auto & child : getChildNodes(node)){
 		std::unique_ptr<DescriptionMap> childDescription(createDescriptionForNode(ctxt, child));
 		if(childDescription)
 			addChildEntry(description,std::move(childDescription));
 	}
+	--ctxt.childNodeDepth;
 }
 
 //! (static)
@@ -0,0 +1,216 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "WriterMinSGBinary.h"
+#include "../BinarySceneFormat.h"
+#include "../SceneDescription.h"
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/Serialization/Serialization.h>
+#include <Util/Macros.h>
+#include <Util/References.h>
+#include <algorithm>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace MinSG {
+namespace SceneManagement {
+
+using namespace BinarySceneFormat;
+
+struct WriterContext {
+	std::vector<std::string> strings;
+	std::unordered_map<std::string, uint32_t> stringIndices;
+	std::vector<Element> elements;
+	std::vector<Attribute> attributes;
+	std::vector<Rendering::Mesh *> meshes;
+	std::unordered_map<Rendering::Mesh *, uint32_t> meshIndices;
+};
+
+static uint32_t addString(WriterContext & ctxt, const std::string & str) {
+	const auto result = ctxt.stringIndices.emplace(str, static_cast<uint32_t>(ctxt.strings.size()));
+	if(result.second)
+		ctxt.strings.push_back(str);
+	return result.first->second;
+}
+
+static uint32_t addMesh(WriterContext & ctxt, Rendering::Mesh * mesh) {
+	const auto result = ctxt.meshIndices.emplace(mesh, static_cast<uint32_t>(ctxt.meshes.size()));
+	if(result.second)
+		ctxt.meshes.push_back(mesh);
+	return result.first->second;
+}
+
+static void addElement(WriterContext & ctxt, const DescriptionMap & d, uint32_t parent) {
+	const uint32_t index = static_cast<uint32_t>(ctxt.elements.size());
+	ctxt.elements.push_back({addString(ctxt, d.getString(Consts::TYPE)), parent, static_cast<uint32_t>(ctxt.attributes.size()), 0});
+
+	// sort the attributes by their keys to get a deterministic output
+	std::vector<std::pair<std::string, const Util::GenericAttribute *>> entries;
+	for(const auto & mapEntry : d) {
+		if(mapEntry.first == Consts::TYPE || mapEntry.first == Consts::CHILDREN || mapEntry.first == Consts::DEFINITIONS)
+			continue;
+		entries.emplace_back(mapEntry.first.toString(), d.getValue(mapEntry.first));
+	}
+	std::sort(entries.begin(), entries.end());
+
+	for(const auto & entry : entries) {
+		if(entry.second == nullptr)
+			continue;
+		const auto meshWrapper = dynamic_cast<const Rendering::Serialization::MeshWrapper_t *>(entry.second);
+		if(meshWrapper != nullptr) {
+			if(meshWrapper->get() != nullptr)
+				ctxt.attributes.push_back({addString(ctxt, entry.first), VALUE_MESH, addMesh(ctxt, meshWrapper->get())});
+		} else {
+			ctxt.attributes.push_back({addString(ctxt, entry.first), VALUE_STRING, addString(ctxt, entry.second->toString())});
+		}
+	}
+	ctxt.elements[index].attributeCount = static_cast<uint32_t>(ctxt.attributes.size()) - ctxt.elements[index].firstAttribute;
+
+	const auto definitions = dynamic_cast<const DescriptionMap *>(d.getValue(Consts::DEFINITIONS));
+	if(definitions != nullptr)
+		addElement(ctxt, *definitions, index);
+	const auto children = dynamic_cast<const DescriptionArray *>(d.getValue(Consts::CHILDREN));
+	if(children != nullptr) {
+		for(const auto & child : *children) {
+			const auto childDescription = dynamic_cast<const DescriptionMap *>(child.get());
+			if(childDescription != nullptr)
+				addElement(ctxt, *childDescription, index);
+		}
+	}
+}
+
+static uint64_t align(uint64_t offset, uint64_t alignment) {
+	return (offset + alignment - 1) / alignment * alignment;
+}
+
+//! Write zeros until @p position reaches @p offset.
+static void writePadding(std::ostream & out, uint64_t & position, uint64_t offset) {
+	static const char zeros[PAYLOAD_ALIGNMENT] = {};
+	while(position < offset) {
+		const uint64_t count = std::min<uint64_t>(offset - position, sizeof(zeros));
+		out.write(zeros, static_cast<std::streamsize>(count));
+		position += count;
+	}
+}
+
+template<typename T>
+static void writeTable(std::ostream & out, uint64_t & position, const std::vector<T> & table) {
+	if(table.empty())
+		return;
+	out.write(reinterpret_cast<const char *>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(T)));
+	position += table.size() * sizeof(T);
+}
+
+//! (static)
+bool WriterMinSGBinary::save(std::ostream & out, const DescriptionMap & sceneDescription) {
+	if(!out.good()) {
+		WARN("Invalid stream.");
+		return false;
+	}
+	WriterContext ctxt;
+	addElement(ctxt, sceneDescription, NO_PARENT);
+
+	// string table
+	std::vector<uint32_t> stringOffsets;
+	stringOffsets.reserve(ctxt.strings.size() + 1);
+	uint32_t stringDataSize = 0;
+	for(const auto & str : ctxt.strings) {
+		stringOffsets.push_back(stringDataSize);
+		stringDataSize += static_cast<uint32_t>(str.size());
+	}
+	stringOffsets.push_back(stringDataSize);
+
+	// mesh layouts
+	std::vector<std::string> meshLayouts;
+	for(const auto & mesh : ctxt.meshes) {
+		Util::Reference<Rendering::Mesh> layoutMesh = new Rendering::Mesh(mesh->getVertexDescription(), 0, 0);
+		layoutMesh->setDrawMode(mesh->getDrawMode());
+		layoutMesh->setUseIndexData(mesh->isUsingIndexData());
+		std::ostringstream layoutStream;
+		if(!Rendering::Serialization::saveMesh(layoutMesh.get(), "mmf", layoutStream)) {
+			WARN("Could not serialize the vertex description of a mesh.");
+			return false;
+		}
+		meshLayouts.emplace_back(layoutStream.str());
+	}
+
+	Header header;
+	std::copy(MAGIC, MAGIC + sizeof(MAGIC), header.magic);
+	header.version = VERSION;
+	header.stringCount = static_cast<uint32_t>(ctxt.strings.size());
+	header.elementCount = static_cast<uint32_t>(ctxt.elements.size());
+	header.attributeCount = static_cast<uint32_t>(ctxt.attributes.size());
+	header.meshCount = static_cast<uint32_t>(ctxt.meshes.size());
+	header.stringTableOffset = sizeof(Header);
+	header.elementTableOffset = align(header.stringTableOffset + stringOffsets.size() * sizeof(uint32_t) + stringDataSize, 8);
+	header.attributeTableOffset = header.elementTableOffset + ctxt.elements.size() * sizeof(Element);
+	header.meshTableOffset = align(header.attributeTableOffset + ctxt.attributes.size() * sizeof(Attribute), 8);
+
+	// mesh payloads
+	std::vector<Mesh> meshRecords;
+	uint64_t offset = header.meshTableOffset + ctxt.meshes.size() * sizeof(Mesh);
+	for(std::size_t i = 0; i < ctxt.meshes.size(); ++i) {
+		Rendering::Mesh * mesh = ctxt.meshes[i];
+		Mesh record;
+		record.layoutOffset = align(offset, PAYLOAD_ALIGNMENT);
+		record.layoutSize = meshLayouts[i].size();
+		const Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+		record.vertexCount = vertexData.getVertexCount();
+		record.vertexDataOffset = align(record.layoutOffset + record.layoutSize, PAYLOAD_ALIGNMENT);
+		record.vertexDataSize = vertexData.dataSize();
+		record.indexCount = mesh->isUsingIndexData() ? mesh->openIndexData().getIndexCount() : 0;
+		record.indexDataOffset = align(record.vertexDataOffset + record.vertexDataSize, PAYLOAD_ALIGNMENT);
+		offset = record.indexDataOffset + record.indexCount * sizeof(uint32_t);
+		meshRecords.push_back(record);
+	}
+
+	uint64_t position = 0;
+	out.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+	position += sizeof(Header);
+	writeTable(out, position, stringOffsets);
+	for(const auto & str : ctxt.strings) {
+		out.write(str.data(), static_cast<std::streamsize>(str.size()));
+		position += str.size();
+	}
+	writePadding(out, position, header.elementTableOffset);
+	writeTable(out, position, ctxt.elements);
+	writeTable(out, position, ctxt.attributes);
+	writePadding(out, position, header.meshTableOffset);
+	writeTable(out, position, meshRecords);
+
+	for(std::size_t i = 0; i < ctxt.meshes.size(); ++i) {
+		Rendering::Mesh * mesh = ctxt.meshes[i];
+		const Mesh & record = meshRecords[i];
+		writePadding(out, position, record.layoutOffset);
+		out.write(meshLayouts[i].data(), static_cast<std::streamsize>(record.layoutSize));
+		position += record.layoutSize;
+
+		writePadding(out, position, record.vertexDataOffset);
+		const Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+		out.write(reinterpret_cast<const char *>(vertexData.data()), static_cast<std::streamsize>(record.vertexDataSize));
+		position += record.vertexDataSize;
+
+		if(record.indexCount > 0) {
+			writePadding(out, position, record.indexDataOffset);
+			const Rendering::MeshIndexData & indexData = mesh->openIndexData();
+			out.write(reinterpret_cast<const char *>(indexData.data()), static_cast<std::streamsize>(record.indexCount * sizeof(uint32_t)));
+			position += record.indexCount * sizeof(uint32_t);
+		}
+	}
+	return out.good();
+}
+
+}
+}
@@ -0,0 +1,33 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_SCENEMANAGEMENT_WRITERMINSGBINARY_H
+#define MINSG_SCENEMANAGEMENT_WRITERMINSGBINARY_H
+
+#include <iosfwd>
+
+namespace Util {
+class GenericAttributeMap;
+}
+namespace MinSG {
+namespace SceneManagement {
+typedef Util::GenericAttributeMap DescriptionMap;
+
+/**
+ * Writer for binary MinSG scene files (\see BinarySceneFormat).
+ * Meshes that are stored as Rendering::Serialization::MeshWrapper_t in the
+ * description are written as raw vertex and index data; a mesh that is used
+ * by several elements is written only once.
+ */
+struct WriterMinSGBinary {
+static bool save(std::ostream & out, const DescriptionMap & sceneDescription);
+};
+
+}
+}
+#endif // MINSG_SCENEMANAGEMENT_WRITERMINSGBINARY_H
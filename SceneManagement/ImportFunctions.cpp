@@ -9,33 +9,231 @@
 	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
 */
 #include "ImportFunctions.h"
+#include "ExportFunctions.h"
+#include "MeshHashing.h"
 #include "SceneDescription.h"
+#include "SplitSceneFormat.h"
 
 #include "Importer/ImportContext.h"
 #include "Importer/ReaderMinSG.h"
+#include "Importer/ReaderMinSGBinary.h"
 #include "Importer/ImporterTools.h"
 #include "Importer/ReaderDAE.h"
 
+#include "SceneManager.h"
+
+#include "../Core/Nodes/GeometryNode.h"
 #include "../Core/Nodes/ListNode.h"
+#include "../Core/NodeMemoryPool.h"
+#include "../Helper/Helper.h"
+#include "../Helper/NodeTraversal.h"
 #include "../Helper/StdNodeVisitors.h"
 
 #ifdef MINSG_EXT_LOADERCOLLADA
 #include "../Ext/LoaderCOLLADA/LoaderCOLLADA.h"
 #endif
 
+#include <Geometry/Matrix4x4.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Util/GenericAttribute.h>
 #include <Util/IO/FileUtils.h>
+#include <Util/Macros.h>
 #include <Util/Timer.h>
 #include <Util/Utils.h>
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <iomanip>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
 
 namespace MinSG{
 
 namespace SceneManagement {
 	
 ImportContext createImportContext(SceneManager & sm,const importOption_t importOptions) {
-	return {sm, nullptr, importOptions, Util::FileName("")};
+	const importOption_t poolOption = sm.areNodeMemoryPoolsEnabled() ? IMPORT_OPTION_USE_NODE_MEMORY_POOLS : IMPORT_OPTION_NONE;
+	return {sm, nullptr, importOptions | poolOption, Util::FileName("")};
+}
+
+
+//! (internal) Create the nodes with the given function below a dummy root node and detach them afterwards.
+static std::vector<Util::Reference<Node>> createDetachedNodes(ImportContext & importContext, const std::function<void ()> & createNodes) {
+	Util::Reference<ListNode> dummyContainerNode=new ListNode;
+	importContext.setRootNode(dummyContainerNode.get());
+
+	createNodes();
+
+	// detach nodes from dummy root node
+	std::vector<Util::Reference<Node>> nodes;
+	const auto nodesTmp = getChildNodes(dummyContainerNode.get());
+	for(const auto & node : nodesTmp) {
+		nodes.push_back(node);
+		node->removeFromParent();
+	}
+	importContext.setRootNode(nullptr);
+	return nodes;
+}
+
+//! (internal) Create the nodes of a scene description.
+static std::vector<Util::Reference<Node>> buildNodes(ImportContext & importContext, const DescriptionMap * sceneDescription) {
+	return createDetachedNodes(importContext, [&importContext, sceneDescription]() {
+		ImporterTools::buildSceneFromDescription(importContext, sceneDescription);
+	});
+}
+
+//! (internal) Create the nodes of a binary MinSG scene file.
+static std::vector<Util::Reference<Node>> loadBinaryScene(ImportContext & importContext, const Util::FileName & fileName) {
+	const NodeMemoryPool::Scope poolScope((importContext.getImportOptions() & IMPORT_OPTION_USE_NODE_MEMORY_POOLS) > 0);
+
+	std::unique_ptr<const DescriptionMap> sceneDescription(ReaderMinSGBinary::loadScene(fileName));
+	if(!sceneDescription) {
+		WARN(std::string("Could not load file: ") + fileName.toString());
+		return std::vector<Util::Reference<Node>>();
+	}
+
+	return buildNodes(importContext, sceneDescription.get());
+}
+
+// ----------- import cache
+
+//! (internal) Remove options from an ImportContext for the lifetime of the object.
+class ImportOptionsRemover {
+	private:
+		ImportContext & importContext;
+		const importOption_t previousOptions;
+	public:
+		ImportOptionsRemover(ImportContext & _importContext, importOption_t removedOptions) :
+				importContext(_importContext), previousOptions(_importContext.importOptions) {
+			importContext.importOptions &= ~removedOptions;
+		}
+		~ImportOptionsRemover() {
+			importContext.importOptions = previousOptions;
+		}
+		ImportOptionsRemover(const ImportOptionsRemover &) = delete;
+		ImportOptionsRemover & operator=(const ImportOptionsRemover &) = delete;
+};
+
+//! Directory of the import cache; if empty, the directory ".minsgcache" next to the imported file is used.
+static Util::FileName importCacheDirectory;
+static std::mutex importCacheDirectoryMutex;
+
+void setImportCacheDirectory(const Util::FileName & directory) {
+	std::lock_guard<std::mutex> lock(importCacheDirectoryMutex);
+	importCacheDirectory = directory;
+}
+
+//! (internal) Calculate the hash of the content of a file. @return false if the file cannot be read.
+static bool hashFileContent(const Util::FileName & fileName, uint64_t & hash) {
+	if(!Util::FileUtils::isFile(fileName))
+		return false;
+	const std::vector<uint8_t> data = Util::FileUtils::loadFile(fileName);
+	hash = MeshHashing::hashData(0, data.data(), data.size());
+	return true;
+}
+
+Util::FileName getImportCacheFile(const Util::FileName & fileName, const importOption_t importOptions) {
+	uint64_t hash;
+	if(!hashFileContent(fileName, hash))
+		return Util::FileName();
+
+	// the remaining options do not influence the created nodes
+	const importOption_t relevantOptions = importOptions & ~(IMPORT_OPTION_USE_IMPORT_CACHE | IMPORT_OPTION_STREAMING | IMPORT_OPTION_USE_NODE_MEMORY_POOLS);
+	std::ostringstream cacheFileName;
+	cacheFileName << std::hex << std::setfill('0') << std::setw(16) << hash << '_' << std::setw(8) << relevantOptions << ".msgb";
+
+	Util::FileName cacheFile;
+	{
+		std::lock_guard<std::mutex> lock(importCacheDirectoryMutex);
+		cacheFile = importCacheDirectory;
+	}
+	if(cacheFile.getPath().empty())
+		cacheFile = Util::FileName::createDirName(fileName.getDir() + ".minsgcache");
+	cacheFile.setFile(cacheFileName.str());
+	return cacheFile;
+}
+
+//! (internal) Return the file that lists the mesh files of the cached scene together with the hashes of their content.
+static Util::FileName getMeshListFile(const Util::FileName & cacheFile) {
+	Util::FileName listFile(cacheFile);
+	listFile.setFile(cacheFile.getFile() + ".meshes");
+	return listFile;
 }
 
+//! (internal) Return true if the mesh files of the cached scene exist and have not been changed.
+static bool checkCachedMeshFiles(const ImportContext & importContext, const Util::FileName & cacheFile) {
+	const Util::FileName listFile = getMeshListFile(cacheFile);
+	if(!Util::FileUtils::isFile(listFile))
+		return false;
+	std::istringstream list(Util::FileUtils::getFileContents(listFile));
+	uint64_t expectedHash;
+	std::string meshFileName;
+	while(list >> std::hex >> expectedHash && list.get() == ' ' && std::getline(list, meshFileName)) {
+		const auto location = importContext.fileLocator.locateFile(Util::FileName(meshFileName));
+		uint64_t hash;
+		if(!location.first || !hashFileContent(location.second, hash) || hash != expectedHash)
+			return false;
+	}
+	return list.eof();
+}
+
+/*! (internal) Store the imported nodes in the import cache together with the list of the referenced mesh files.
+	The files are renamed after they have been written completely.	*/
+static void storeInImportCache(ImportContext & importContext, const Util::FileName & cacheFile, const std::vector<Util::Reference<Node>> & nodes) {
+	std::set<std::string> meshFileNames;
+	for(const auto & node : nodes) {
+		NodeTraversal::forEachNodeTopDown<GeometryNode>(node.get(), [&meshFileNames](GeometryNode * geoNode) {
+			const Rendering::Mesh * mesh = geoNode->getMesh();
+			if(mesh != nullptr && !mesh->getFileName().toString().empty())
+				meshFileNames.insert(mesh->getFileName().toString());
+		});
+	}
+	std::ostringstream meshList;
+	meshList << std::hex << std::setfill('0');
+	for(const auto & meshFileName : meshFileNames) {
+		const auto location = importContext.fileLocator.locateFile(Util::FileName(meshFileName));
+		uint64_t hash;
+		if(!location.first || !hashFileContent(location.second, hash))
+			return;
+		meshList << std::setw(16) << hash << ' ' << meshFileName << '\n';
+	}
+
+	const Util::FileName cacheDirectory = Util::FileName::createDirName(cacheFile.getDir());
+	if(!Util::FileUtils::isDir(cacheDirectory))
+		Util::FileUtils::createDir(cacheDirectory);
+
+	Util::FileName tmpFile(cacheFile);
+	tmpFile.setFile(cacheFile.getFile() + ".tmp");
+	const Util::FileName listFile = getMeshListFile(cacheFile);
+	Util::FileName tmpListFile(listFile);
+	tmpListFile.setFile(listFile.getFile() + ".tmp");
+	std::deque<Node *> nodeList;
+	for(const auto & node : nodes)
+		nodeList.push_back(node.get());
+	try {
+		saveMinSGBinaryFile(importContext.sceneManager, tmpFile, nodeList);
+		const std::string meshListString = meshList.str();
+		if(!Util::FileUtils::saveFile(tmpListFile, std::vector<uint8_t>(meshListString.begin(), meshListString.end())))
+			throw std::runtime_error("Could not write " + tmpListFile.toString());
+	} catch(const std::exception & e) {
+		WARN(std::string("Could not write the import cache: ") + e.what());
+		Util::FileUtils::remove(tmpFile);
+		Util::FileUtils::remove(tmpListFile);
+		return;
+	}
+
+	// a scene file with an outdated list of mesh files is not used
+	if(std::rename(tmpFile.getPath().c_str(), cacheFile.getPath().c_str()) != 0 ||
+			std::rename(tmpListFile.getPath().c_str(), listFile.getPath().c_str()) != 0) {
+		WARN(std::string("Could not write the import cache: ") + cacheFile.toString());
+		Util::FileUtils::remove(tmpFile);
+		Util::FileUtils::remove(tmpListFile);
+	}
+}
 
 std::vector<Util::Reference<Node>> loadMinSGFile(SceneManager& sm,const Util::FileName & fileName, const importOption_t importOptions/*=IMPORT_OPTION_NONE*/) {
 	auto importContext = createImportContext(sm,importOptions);
@@ -43,15 +241,34 @@ std::vector<Util::Reference<Node>> loadMinSGFile(SceneManager& sm,const Util::Fi
 }
 
 std::vector<Util::Reference<Node>> loadMinSGFile(ImportContext & importContext,const Util::FileName & fileName) {
+	if(fileName.getEnding() == "msgb")
+		return loadMinSGBinaryFile(importContext, fileName);
 	importContext.setFileName(fileName);
 
+	// restore the nodes from the import cache; the file name of the context stays the imported file
+	const bool useImportCache = (importContext.getImportOptions() & IMPORT_OPTION_USE_IMPORT_CACHE) > 0;
+	const Util::FileName cacheFile = useImportCache ? getImportCacheFile(fileName, importContext.getImportOptions()) : Util::FileName();
+	if(!cacheFile.getPath().empty() && Util::FileUtils::isFile(cacheFile) && checkCachedMeshFiles(importContext, cacheFile)) {
+		std::vector<Util::Reference<Node>> nodes;
+		{
+			// the cached meshes have already been optimized
+			const ImportOptionsRemover optionsRemover(importContext, IMPORT_OPTION_OPTIMIZE_MESHES);
+			nodes = loadBinaryScene(importContext, cacheFile);
+		}
+		if(!nodes.empty())
+			return nodes;
+	}
+
 	auto in = Util::FileUtils::openForReading(fileName);
 	if(!in) {
 		WARN(std::string("Could not load file: ") + fileName.toString());
 		return std::vector<Util::Reference<Node>>();
 	}
 
-	return loadMinSGStream(importContext, *(in.get()));
+	auto nodes = loadMinSGStream(importContext, *(in.get()));
+	if(!cacheFile.getPath().empty() && !nodes.empty())
+		storeInImportCache(importContext, cacheFile, nodes);
+	return nodes;
 }
 
 std::vector<Util::Reference<Node>> loadMinSGStream(ImportContext & importContext, std::istream & in) {
@@ -60,24 +277,78 @@ std::vector<Util::Reference<Node>> loadMinSGStream(ImportContext & importContext
 		return std::vector<Util::Reference<Node>>();
 	}
 
+	const NodeMemoryPool::Scope poolScope((importContext.getImportOptions() & IMPORT_OPTION_USE_NODE_MEMORY_POOLS) > 0);
+
+	if((importContext.getImportOptions() & IMPORT_OPTION_STREAMING) > 0) {
+		return createDetachedNodes(importContext, [&importContext, &in]() {
+			ReaderMinSG::importScene(importContext, in);
+		});
+	}
+
 	// parse xml and create description
 	std::unique_ptr<const DescriptionMap> sceneDescription(ReaderMinSG::loadScene(in));
 
-	// create MinSG scene tree from description with dummy root node
-	Util::Reference<ListNode> dummyContainerNode=new ListNode;
-	importContext.setRootNode(dummyContainerNode.get());
+	return buildNodes(importContext, sceneDescription.get());
+}
 
-	ImporterTools::buildSceneFromDescription(importContext, sceneDescription.get());
+std::vector<Util::Reference<Node>> loadMinSGBinaryFile(SceneManager& sm,const Util::FileName & fileName, const importOption_t importOptions/*=IMPORT_OPTION_NONE*/) {
+	auto importContext = createImportContext(sm,importOptions);
+	return loadMinSGBinaryFile(importContext, fileName);
+}
 
-	// detach nodes from dummy root node
-	std::vector<Util::Reference<Node>> nodes;
-	const auto nodesTmp = getChildNodes(dummyContainerNode.get());
-	for(const auto & node : nodesTmp) {
-		nodes.push_back(node);
-		node->removeFromParent();
+std::vector<Util::Reference<Node>> loadMinSGBinaryFile(ImportContext & importContext,const Util::FileName & fileName) {
+	importContext.setFileName(fileName);
+	return loadBinaryScene(importContext, fileName);
+}
+
+GroupNode * loadMinSGSplitScene(SceneManager & sm, const Util::FileName & fileName, const importOption_t importOptions/*=IMPORT_OPTION_NONE*/) {
+	SplitSceneFormat::Manifest manifest;
+	if(!SplitSceneFormat::loadManifest(fileName, manifest)) {
+		WARN(std::string("Could not load split scene: ") + fileName.toString());
+		return nullptr;
 	}
-	importContext.setRootNode(nullptr);
-	return nodes;
+	auto importContext = createImportContext(sm, importOptions);
+
+	Util::FileName rootFile(fileName);
+	rootFile.setFile(manifest.rootFile);
+	const auto rootNodes = loadMinSGFile(importContext, rootFile);
+	Util::Reference<GroupNode> root = rootNodes.size() == 1 ? dynamic_cast<GroupNode *>(rootNodes.front().get()) : nullptr;
+	if(root.isNull()) {
+		WARN(std::string("Invalid root file of split scene: ") + rootFile.toString());
+		return nullptr;
+	}
+
+	const Util::StringIdentifier partFileAttribute = SplitSceneFormat::getPartFileAttribute();
+	// the parts are listed in depth-first order, so that every part is the next child of its parent
+	std::vector<uint32_t> parentPath;
+	GroupNode * parent = root.get();
+	for(const auto & part : manifest.parts) {
+		if(parentPath.size() + 1 != part.path.size() || !std::equal(parentPath.begin(), parentPath.end(), part.path.begin())) {
+			parentPath.assign(part.path.begin(), part.path.end() - 1);
+			parent = root.get();
+			for(const auto & index : parentPath) {
+				const auto children = getChildNodes(parent);
+				parent = index < children.size() ? dynamic_cast<GroupNode *>(children[index]) : nullptr;
+				if(parent == nullptr)
+					break;
+			}
+		}
+		if(parent == nullptr || part.path.back() != parent->countChildren()) {
+			WARN(std::string("Invalid part path in split scene: ") + fileName.toString());
+			return nullptr;
+		}
+
+		Util::FileName partFile(fileName);
+		partFile.setFile(part.file);
+		const auto partNodes = loadMinSGFile(importContext, partFile);
+		if(partNodes.size() != 1) {
+			WARN(std::string("Invalid part file of split scene: ") + partFile.toString());
+			return nullptr;
+		}
+		partNodes.front()->setAttribute(partFileAttribute, Util::GenericAttribute::createString(part.file));
+		parent->addChild(partNodes.front());
+	}
+	return root.detachAndDecrease();
 }
 
 GroupNode * loadCOLLADA(SceneManager& sm,const Util::FileName & fileName, const importOption_t importOptions) {
@@ -86,6 +357,7 @@ GroupNode * loadCOLLADA(SceneManager& sm,const Util::FileName & fileName, const
 }
 
 GroupNode * loadCOLLADA(ImportContext & importContext, const Util::FileName & fileName) {
+	const NodeMemoryPool::Scope poolScope((importContext.getImportOptions() & IMPORT_OPTION_USE_NODE_MEMORY_POOLS) > 0);
 	Util::Reference<GroupNode> container = new ListNode;
 	importContext.setFileName(fileName);
 	importContext.setRootNode(container.get());
@@ -31,6 +31,17 @@ static const importOption_t IMPORT_OPTION_DAE_INVERT_TRANSPARENCY = 1<<2;
 static const importOption_t IMPORT_OPTION_USE_TEXTURE_REGISTRY = 1<<3;
 static const importOption_t IMPORT_OPTION_USE_MESH_REGISTRY = 1<<4;
 static const importOption_t IMPORT_OPTION_USE_MESH_HASHING_REGISTRY = 1<<5;
+//! Allocate the imported nodes from the node memory pools (\see NodeMemoryPool).
+static const importOption_t IMPORT_OPTION_USE_NODE_MEMORY_POOLS = 1<<6;
+//! Create the nodes of MinSG XML files while reading them instead of creating the description of the whole scene first (\see ReaderMinSG::importScene).
+static const importOption_t IMPORT_OPTION_STREAMING = 1<<7;
+/*! Restore MinSG XML files from the import cache if they have been imported before with the same options; otherwise,
+	store the imported nodes in the cache (\see setImportCacheDirectory, getImportCacheFile).	*/
+static const importOption_t IMPORT_OPTION_USE_IMPORT_CACHE = 1<<8;
+/*! Optimize the imported indexed triangle meshes for rendering throughput (\see MeshOptimization::optimizeMesh) after all
+	meshes have been loaded. Optimized meshes lose their file name, so that the optimized data is stored when the scene
+	is exported. The results are available by ImportContext::getOptimizedMeshes().	*/
+static const importOption_t IMPORT_OPTION_OPTIMIZE_MESHES = 1<<9;
 
 
 /**
@@ -46,7 +57,7 @@ std::vector<Util::Reference<Node>> loadMinSGFile(SceneManager& sm,const Util::Fi
  * Load MinSG nodes from a file.
  * 
  * @param importContext Context that is used for the import procedure
- * @param fileName Path to a MinSG XML file
+ * @param fileName Path to a MinSG XML file; files with the ending ".msgb" are loaded with loadMinSGBinaryFile()
  * @return Array of MinSG nodes. In case of an error, an empty array will be returned.
  */
 std::vector<Util::Reference<Node>> loadMinSGFile(ImportContext & importContext, const Util::FileName & fileName);
@@ -60,11 +71,59 @@ std::vector<Util::Reference<Node>> loadMinSGFile(ImportContext & importContext,
  */
 std::vector<Util::Reference<Node>> loadMinSGStream(ImportContext & importContext, std::istream & in);
 
+/**
+ * Load MinSG nodes from a binary MinSG scene file (\see BinarySceneFormat).
+ * The file is mapped into memory and the meshes are created directly from the
+ * stored vertex and index data.
+ * 
+ * @param fileName Path to a binary MinSG scene file (usually with the ending ".msgb")
+ * @param importOptions Options controlling the import procedure
+ * @return Array of MinSG nodes. In case of an error, an empty array will be returned.
+ */
+std::vector<Util::Reference<Node>> loadMinSGBinaryFile(SceneManager& sm,const Util::FileName & fileName, const importOption_t importOptions = IMPORT_OPTION_NONE);
+
+//! \see loadMinSGBinaryFile(SceneManager&,const Util::FileName &,const importOption_t)
+std::vector<Util::Reference<Node>> loadMinSGBinaryFile(ImportContext & importContext, const Util::FileName & fileName);
+
 GroupNode * loadCOLLADA(SceneManager & sm,const Util::FileName & fileName,const importOption_t importOptions=IMPORT_OPTION_NONE);
 GroupNode * loadCOLLADA(ImportContext & importContext, const Util::FileName & fileName);
 
+/**
+ * Load a split MinSG scene (\see SplitSceneFormat, saveMinSGSplitScene). The part files
+ * are added as children of the nodes of the root file at the paths of the manifest. To save
+ * only the changes of the loaded scene, create a SceneChangeTracker with the part depth of
+ * the manifest for the root node and clear it.
+ *
+ * @param fileName Path of the manifest file
+ * @param importOptions Options controlling the import procedure
+ * @return Root node of the scene, or nullptr in case of an error
+ */
+GroupNode * loadMinSGSplitScene(SceneManager & sm, const Util::FileName & fileName, const importOption_t importOptions = IMPORT_OPTION_NONE);
+
 ImportContext createImportContext(SceneManager & sm,const importOption_t importOptions=IMPORT_OPTION_NONE);
 
+/**
+ * Set the directory of the import cache (\see IMPORT_OPTION_USE_IMPORT_CACHE). If no
+ * directory is set, the cache files are stored in the subdirectory ".minsgcache" of
+ * the directory containing the imported file. The directory may be changed while
+ * other threads import files.
+ */
+void setImportCacheDirectory(const Util::FileName & directory);
+
+/**
+ * Return the file of the import cache for a MinSG XML file. The cache files are
+ * binary MinSG scene files (\see BinarySceneFormat) whose names consist of a hash
+ * of the content of the imported file and of the import options; changing the
+ * content of the file therefore invalidates its cache file. Next to each cache file,
+ * the mesh files referenced by the scene are listed with hashes of their content;
+ * the cache file is only used if these mesh files have not been changed.
+ *
+ * @param fileName Path to a MinSG XML file
+ * @param importOptions Options of the import (IMPORT_OPTION_USE_IMPORT_CACHE is ignored)
+ * @return Path of the cache file (that may not exist), or an empty file name if the file cannot be read
+ */
+Util::FileName getImportCacheFile(const Util::FileName & fileName, const importOption_t importOptions);
+
 }
 }
 
@@ -16,6 +16,7 @@
 #include "ImporterTools.h"
 #include "ImportContext.h"
 #include "MeshImportHandler.h"
+#include "../MeshHashing.h"
 
 #include "../../Core/Nodes/GroupNode.h"
 #include "../../Core/Nodes/ListNode.h"
@@ -27,14 +28,14 @@
 #include "../../Core/States/LightingState.h"
 
 #include <Rendering/Serialization/Serialization.h>
-#include <Rendering/MeshUtils/MeshUtils.h>
 
 #include <Util/Macros.h>
-#include <Util/Encoding.h>
 
 #include <cassert>
 #include <cstdint>
 #include <functional>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 namespace MinSG {
@@ -53,9 +54,13 @@ static bool importLightNode(ImportContext & ctxt, const std::string & nodeType,
 	} else {
 		node->setLightType(Rendering::LightParameters::POINT);
 	}
-	node->setAmbientLightColor(Util::Color4f(Util::StringUtils::toFloats(d.getString(Consts::ATTR_LIGHT_AMBIENT, ""))));
-	node->setDiffuseLightColor(Util::Color4f(Util::StringUtils::toFloats(d.getString(Consts::ATTR_LIGHT_DIFFUSE, ""))));
-	node->setSpecularLightColor(Util::Color4f(Util::StringUtils::toFloats(d.getString(Consts::ATTR_LIGHT_SPECULAR, ""))));
+	std::vector<float> color;
+	ImporterTools::getFloatValues(d, Consts::ATTR_LIGHT_AMBIENT, color);
+	node->setAmbientLightColor(Util::Color4f(color));
+	ImporterTools::getFloatValues(d, Consts::ATTR_LIGHT_DIFFUSE, color);
+	node->setDiffuseLightColor(Util::Color4f(color));
+	ImporterTools::getFloatValues(d, Consts::ATTR_LIGHT_SPECULAR, color);
+	node->setSpecularLightColor(Util::Color4f(color));
 	node->setConstantAttenuation(Util::StringUtils::toNumber<float>(d.getString(Consts::ATTR_LIGHT_CONSTANT_ATTENUATION, "1.0")));
 	node->setLinearAttenuation(Util::StringUtils::toNumber<float>(d.getString(Consts::ATTR_LIGHT_LINEAR_ATTENUATION, "0.0")));
 	node->setQuadraticAttenuation(Util::StringUtils::toNumber<float>(d.getString(Consts::ATTR_LIGHT_QUADRATIC_ATTENUATION, "0.0")));
@@ -158,6 +163,17 @@ static bool importCameraNode(ImportContext & ctxt, const std::string & nodeType,
 	return true;
 }
 
+/*! Returns true if the mesh file can be loaded in parallel when the import is finalized.
+	This is the case for single mesh files that would be loaded by the default MeshImportHandler;
+	other handlers (e.g. of the OutOfCore extension) are always called during the traversal.	*/
+static bool isDeferredMeshFile(const std::string & fileNameString) {
+	const MeshImportHandler * handler = ImporterTools::getMeshImportHandler();
+	if(handler == nullptr || typeid(*handler) != typeid(MeshImportHandler))
+		return false;
+	const std::string ending = Util::FileName(fileNameString).getEnding();
+	return ending == "mmf" || ending == "ply";
+}
+
 static bool importGeometryNode(ImportContext & ctxt, const std::string & nodeType, const DescriptionMap & d, GroupNode * parent) {
 	if(nodeType != Consts::NODE_TYPE_GEOMETRY || parent == nullptr)
 		return false;
@@ -198,6 +214,11 @@ static bool importGeometryNode(ImportContext & ctxt, const std::string & nodeTyp
 			}
 		}
 
+		if(node==nullptr && isDeferredMeshFile(fileNameString)) {
+			auto gn = new GeometryNode;
+			ctxt.addPendingMeshFile(gn, fileNameString);
+			node = gn;
+		}
 		if(node==nullptr) {
 			node = ImporterTools::getMeshImportHandler()->handleImport(ctxt.fileLocator, fileNameString, dataDesc);
 
@@ -215,21 +236,26 @@ static bool importGeometryNode(ImportContext & ctxt, const std::string & nodeTyp
 			}
 		}
 
-	} // Load MMF data from a Base64 encoded block.
+	} // Load MMF data or compressed mesh data (\see MeshEncoding) from a Base64 encoded block.
 	else if(dataDesc->getValue(Consts::DATA_BLOCK)) {
-		const std::string dataBlock = dataDesc->getString(Consts::DATA_BLOCK);
-		if(dataDesc->getString(Consts::ATTR_DATA_ENCODING) != Consts::DATA_ENCODING_BASE64) {
+		std::string dataBlock = dataDesc->getString(Consts::DATA_BLOCK);
+		const std::string encoding = dataDesc->getString(Consts::ATTR_DATA_ENCODING);
+		const bool compressedMesh = encoding == Consts::DATA_ENCODING_COMPRESSED_MESH_BASE64;
+		if(encoding != Consts::DATA_ENCODING_BASE64 && !compressedMesh) {
 			WARN("Unknown data block encoding.");
 			return false;
 		}
-		const std::vector<uint8_t> meshData = Util::decodeBase64(dataBlock);
-
-		Rendering::Mesh * mesh = Rendering::Serialization::loadMesh("mmf", std::string(meshData.begin(), meshData.end()));
-		if(mesh == nullptr) {
-			WARN("Loading the mesh failed.");
-			return false;
-		}
-		node = new GeometryNode(mesh);
+		// the mesh is decoded in parallel to the other meshes when the import is finalized
+		auto gn = new GeometryNode;
+		ctxt.addPendingMesh(gn, std::move(dataBlock), dataDesc->getString(Consts::ATTR_MESH_ID), compressedMesh);
+		node = gn;
+	} // The mesh is shared with a previous GeometryNode (exported with EXPORT_OPTION_SHARE_EQUAL_MESHES).
+	else if(dataDesc->getValue(Consts::ATTR_REFERENCED_MESH_ID)) {
+		const std::string meshId = dataDesc->getString(Consts::ATTR_REFERENCED_MESH_ID);
+		auto gn = new GeometryNode;
+		if(!ctxt.addSharedMesh(gn, meshId))
+			WARN("Unknown mesh id \"" + meshId + "\".");
+		node = gn;
 	} //  A Mesh-Object is already contained in the description.
 	else if(dataType == "mesh") {
 		Rendering::Serialization::MeshWrapper_t * meshWrapper = dynamic_cast<Rendering::Serialization::MeshWrapper_t *>(dataDesc->getValue(Consts::ATTR_MESH_DATA));
@@ -248,9 +274,9 @@ static bool importGeometryNode(ImportContext & ctxt, const std::string & nodeTyp
 	const bool useMeshHashingRegistry = (ctxt.importOptions & IMPORT_OPTION_USE_MESH_HASHING_REGISTRY)>0 ;
 	if(useMeshHashingRegistry) {
 		GeometryNode * gn = dynamic_cast<GeometryNode *>(node);
-		if(gn!=nullptr && !gn->getMesh()->empty()) {
+		if(gn!=nullptr && gn->getMesh()!=nullptr && !gn->getMesh()->empty()) {
 			Util::Reference<Rendering::Mesh> mesh = gn->getMesh();
-			const uint32_t hash = Rendering::MeshUtils::calculateHash(mesh.get());
+			const uint64_t hash = MeshHashing::calculateHash(mesh.get());
 			Rendering::Mesh * mesh2 = ctxt.getRegisteredMesh(hash,mesh.get());
 			if(mesh2==nullptr) {
 				ctxt.registerMesh(hash,mesh.get());
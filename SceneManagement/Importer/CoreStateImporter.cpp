@@ -56,6 +56,27 @@ static Rendering::Uniform importUniform(const DescriptionMap & d) {
 	try {
 		const std::string dataType = d.getString(Consts::ATTR_SHADER_UNIFORM_TYPE);
 		const std::string name = d.getString(Consts::ATTR_SHADER_UNIFORM_NAME);
+
+		// the float values are usually parsed by the reader already (\see FloatValuesAttribute)
+		std::vector<float> floatValues;
+		const auto createFloatUniform = [&](Rendering::Uniform::dataType_t type) {
+			ImporterTools::getFloatValues(d, Consts::ATTR_SHADER_UNIFORM_VALUES, floatValues);
+			return Rendering::Uniform(name, type, floatValues);
+		};
+		if(dataType == Consts::SHADER_UNIFORM_TYPE_FLOAT)
+			return createFloatUniform(Rendering::Uniform::UNIFORM_FLOAT);
+		else if(dataType == Consts::SHADER_UNIFORM_TYPE_VEC2F)
+			return createFloatUniform(Rendering::Uniform::UNIFORM_VEC2F);
+		else if(dataType == Consts::SHADER_UNIFORM_TYPE_VEC3F)
+			return createFloatUniform(Rendering::Uniform::UNIFORM_VEC3F);
+		else if(dataType == Consts::SHADER_UNIFORM_TYPE_VEC4F)
+			return createFloatUniform(Rendering::Uniform::UNIFORM_VEC4F);
+
+		else if(dataType == Consts::SHADER_UNIFORM_TYPE_MATRIX_3X3F)
+			return createFloatUniform(Rendering::Uniform::UNIFORM_MATRIX_3X3F);
+		else if(dataType == Consts::SHADER_UNIFORM_TYPE_MATRIX_4X4F)
+			return createFloatUniform(Rendering::Uniform::UNIFORM_MATRIX_4X4F);
+
 		const std::string values = d.getString(Consts::ATTR_SHADER_UNIFORM_VALUES);
 
 		if(dataType == Consts::SHADER_UNIFORM_TYPE_BOOL)
@@ -76,20 +97,6 @@ static Rendering::Uniform importUniform(const DescriptionMap & d) {
 		else if(dataType == Consts::SHADER_UNIFORM_TYPE_VEC4I)
 			return Rendering::Uniform(name, Rendering::Uniform::UNIFORM_VEC4I,Util::StringUtils::toInts(values));
 
-		else if(dataType == Consts::SHADER_UNIFORM_TYPE_FLOAT)
-			return Rendering::Uniform(name, Rendering::Uniform::UNIFORM_FLOAT, Util::StringUtils::toFloats(values));
-		else if(dataType == Consts::SHADER_UNIFORM_TYPE_VEC2F)
-			return Rendering::Uniform(name, Rendering::Uniform::UNIFORM_VEC2F,Util::StringUtils::toFloats(values));
-		else if(dataType == Consts::SHADER_UNIFORM_TYPE_VEC3F)
-			return Rendering::Uniform(name, Rendering::Uniform::UNIFORM_VEC3F,Util::StringUtils::toFloats(values));
-		else if(dataType == Consts::SHADER_UNIFORM_TYPE_VEC4F)
-			return Rendering::Uniform(name, Rendering::Uniform::UNIFORM_VEC4F,Util::StringUtils::toFloats(values));
-
-		else if(dataType == Consts::SHADER_UNIFORM_TYPE_MATRIX_3X3F)
-			return Rendering::Uniform(name, Rendering::Uniform::UNIFORM_MATRIX_3X3F,Util::StringUtils::toFloats(values));
-		else if(dataType == Consts::SHADER_UNIFORM_TYPE_MATRIX_4X4F)
-			return Rendering::Uniform(name, Rendering::Uniform::UNIFORM_MATRIX_4X4F,Util::StringUtils::toFloats(values));
-
 		WARN("Unknown uniform dataType");
 	} catch(const std::invalid_argument & e) {
 		WARN(e.what());
@@ -484,34 +491,30 @@ static bool importMaterialState(ImportContext & ctxt, const std::string & stateT
 		return false;
 
 	auto state = new MaterialState();
-	std::string strAmbient = d.getString(Consts::ATTR_MATERIAL_AMBIENT);
-	if(!strAmbient.empty()) {
-		std::vector<float> vecAmbient = Util::StringUtils::toFloats(strAmbient);
-		FAIL_IF(vecAmbient.size() != 4);
-		state->changeParameters().setAmbient(Util::Color4f(vecAmbient[0], vecAmbient[1], vecAmbient[2], vecAmbient[3]));
+	std::vector<float> values;
+	ImporterTools::getFloatValues(d, Consts::ATTR_MATERIAL_AMBIENT, values);
+	if(!values.empty()) {
+		FAIL_IF(values.size() != 4);
+		state->changeParameters().setAmbient(Util::Color4f(values[0], values[1], values[2], values[3]));
 	}
-	std::string strDiffuse = d.getString(Consts::ATTR_MATERIAL_DIFFUSE);
-	if(!strDiffuse.empty()) {
-		std::vector<float> vecDiffuse = Util::StringUtils::toFloats(strDiffuse);
-		FAIL_IF(vecDiffuse.size() != 4);
-		state->changeParameters().setDiffuse(Util::Color4f(vecDiffuse[0], vecDiffuse[1], vecDiffuse[2], vecDiffuse[3]));
+	ImporterTools::getFloatValues(d, Consts::ATTR_MATERIAL_DIFFUSE, values);
+	if(!values.empty()) {
+		FAIL_IF(values.size() != 4);
+		state->changeParameters().setDiffuse(Util::Color4f(values[0], values[1], values[2], values[3]));
 	}
-	std::string strSpecular = d.getString(Consts::ATTR_MATERIAL_SPECULAR);
-	if(!strSpecular.empty()) {
-		std::vector<float> vecSpecular = Util::StringUtils::toFloats(strSpecular);
-		FAIL_IF(vecSpecular.size() != 4);
-		state->changeParameters().setSpecular(Util::Color4f(vecSpecular[0], vecSpecular[1], vecSpecular[2], vecSpecular[3]));
+	ImporterTools::getFloatValues(d, Consts::ATTR_MATERIAL_SPECULAR, values);
+	if(!values.empty()) {
+		FAIL_IF(values.size() != 4);
+		state->changeParameters().setSpecular(Util::Color4f(values[0], values[1], values[2], values[3]));
 	}
-	std::string strEmission = d.getString(Consts::ATTR_MATERIAL_EMISSION);
-	if(!strEmission.empty()) {
-		std::vector<float> vecEmission = Util::StringUtils::toFloats(strEmission);
-		FAIL_IF(vecEmission.size() != 4);
-		state->changeParameters().setEmission(Util::Color4f(vecEmission[0], vecEmission[1], vecEmission[2], vecEmission[3]));
+	ImporterTools::getFloatValues(d, Consts::ATTR_MATERIAL_EMISSION, values);
+	if(!values.empty()) {
+		FAIL_IF(values.size() != 4);
+		state->changeParameters().setEmission(Util::Color4f(values[0], values[1], values[2], values[3]));
 	}
-	std::string strShininess = d.getString(Consts::ATTR_MATERIAL_SHININESS);
-	if(!strShininess.empty()) {
-		float shininess = Util::StringUtils::toNumber<float>(strShininess);
-		state->changeParameters().setShininess(shininess);
+	ImporterTools::getFloatValues(d, Consts::ATTR_MATERIAL_SHININESS, values);
+	if(!values.empty()) {
+		state->changeParameters().setShininess(values.front());
 	}
 
 
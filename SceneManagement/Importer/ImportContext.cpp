@@ -9,8 +9,16 @@
 	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
 */
 #include "ImportContext.h"
-#include <Rendering/MeshUtils/MeshUtils.h>
+#include "../ImportFunctions.h"
+#include "../MeshEncoding.h"
+#include "../MeshHashing.h"
+#include "../../Core/Nodes/GroupNode.h"
+#include "../../Helper/StdNodeVisitors.h"
+#include <Rendering/Serialization/Serialization.h>
+#include <Util/Encoding.h>
+#include <Util/Macros.h>
 #include <Util/References.h>
+#include <Util/Utils.h>
 #include <functional>
 #include <utility>
 
@@ -21,6 +29,9 @@ namespace MinSG {
 namespace SceneManagement {
 
 void ImportContext::executeFinalizingActions(){
+	finishPendingMeshes();
+	if( (importOptions & IMPORT_OPTION_OPTIMIZE_MESHES)>0 )
+		optimizeMeshes();
 	for(auto & action : finalizeActions) {
 		action(*this);
 	}
@@ -43,7 +54,7 @@ Rendering::Mesh * ImportContext::getRegisteredMesh( const std::string & meshFile
 }
 
 
-Rendering::Mesh * ImportContext::getRegisteredMesh(const uint32_t hash , Rendering::Mesh * m)const{
+Rendering::Mesh * ImportContext::getRegisteredMesh(const uint64_t hash , Rendering::Mesh * m)const{
 
 	auto it = registeredHashedMeshes.find(hash);
 	if(it==registeredHashedMeshes.end())
@@ -51,12 +62,194 @@ Rendering::Mesh * ImportContext::getRegisteredMesh(const uint32_t hash , Renderi
 
 	const meshHashingRegistryBucket_t & bucket = it->second;
 	for(const auto & it2 : bucket) {
-		if(Rendering::MeshUtils::compareMeshes(it2.get(), m)) {
+		if(MeshHashing::equalData(it2.get(), m)) {
 			return it2.get();
 		}
 	}
 	return nullptr;
 }
 
+
+// ----------- pending Meshes
+
+void ImportContext::addPendingMesh(GeometryNode * node, std::string base64Data, const std::string & meshId, bool compressedMesh){
+	if(!meshId.empty())
+		pendingMeshIds[meshId] = pendingMeshes.size();
+	pendingMeshDataSize += base64Data.size();
+	pendingMeshes.emplace_back();
+	pendingMeshes.back().nodes.emplace_back(node);
+	pendingMeshes.back().base64Data = std::move(base64Data);
+	pendingMeshes.back().meshId = meshId;
+	pendingMeshes.back().compressedMesh = compressedMesh;
+}
+
+bool ImportContext::addSharedMesh(GeometryNode * node, const std::string & meshId){
+	const auto pendingIt = pendingMeshIds.find(meshId);
+	if(pendingIt != pendingMeshIds.end()) {
+		pendingMeshes[pendingIt->second].nodes.emplace_back(node);
+		return true;
+	}
+	const auto sharedIt = sharedMeshes.find(meshId);
+	if(sharedIt == sharedMeshes.end())
+		return false;
+	node->setMesh(sharedIt->second.get());
+	return true;
+}
+
+void ImportContext::addPendingMeshFile(GeometryNode * node, const std::string & meshFileName){
+	if( (importOptions & IMPORT_OPTION_USE_MESH_REGISTRY)>0 ) {
+		const auto result = pendingMeshFiles.emplace(meshFileName, pendingMeshes.size());
+		if(!result.second) {
+			pendingMeshes[result.first->second].nodes.emplace_back(node);
+			return;
+		}
+	}
+	pendingMeshes.emplace_back();
+	pendingMeshes.back().nodes.emplace_back(node);
+	pendingMeshes.back().meshFileName = meshFileName;
+}
+
+//! (internal) Called concurrently; must only access the given pending mesh.
+static void decodePendingMesh(const Util::FileLocator & locator, bool calculateHash, Rendering::Mesh * & mesh, std::string & base64Data,
+								bool compressedMesh, const std::string & meshFileName, uint64_t & hash) {
+	if(!meshFileName.empty()) {
+		const Util::FileName fileName(meshFileName);
+		const auto location = locator.locateFile(fileName);
+		if(!location.first)
+			return;
+		mesh = Rendering::Serialization::loadMesh(location.second);
+		if(mesh != nullptr)
+			mesh->setFileName(fileName);
+	} else {
+		const std::vector<uint8_t> meshData = Util::decodeBase64(base64Data);
+		std::string().swap(base64Data);
+		if(compressedMesh)
+			mesh = MeshEncoding::decodeMesh(meshData.data(), meshData.size());
+		else
+			mesh = Rendering::Serialization::loadMesh("mmf", std::string(meshData.begin(), meshData.end()));
+	}
+	if(calculateHash && mesh != nullptr && !mesh->empty())
+		hash = MeshHashing::calculateHash(mesh);
+}
+
+void ImportContext::finishPendingMeshes(){
+	if(pendingMeshes.empty())
+		return;
+	const bool useMeshRegistry = (importOptions & IMPORT_OPTION_USE_MESH_REGISTRY)>0;
+	const bool useMeshHashingRegistry = (importOptions & IMPORT_OPTION_USE_MESH_HASHING_REGISTRY)>0;
+
+	// decode the meshes in parallel; the reference counters are only touched after the loop
+	const int meshCount = static_cast<int>(pendingMeshes.size());
+	std::vector<Rendering::Mesh *> meshes(pendingMeshes.size(), nullptr);
+COMPILER_WARN_PUSH
+COMPILER_WARN_OFF_CLANG(-Wunknown-pragmas)
+#pragma omp parallel for schedule(dynamic) if(meshCount > 1)
+	for(int i = 0; i < meshCount; ++i) {
+		PendingMesh & pending = pendingMeshes[i];
+		decodePendingMesh(fileLocator, useMeshHashingRegistry, meshes[i], pending.base64Data, pending.compressedMesh, pending.meshFileName, pending.hash);
+	}
+COMPILER_WARN_POP
+
+	// assign the meshes and update the registries in the original order
+	for(std::size_t i = 0; i < pendingMeshes.size(); ++i) {
+		PendingMesh & pending = pendingMeshes[i];
+		Util::Reference<Rendering::Mesh> mesh = meshes[i];
+		if(mesh.isNull()) {
+			WARN(pending.meshFileName.empty() ? std::string("Loading the mesh failed.") : "Loading the mesh failed: " + pending.meshFileName);
+			continue;
+		}
+		if(useMeshRegistry && !pending.meshFileName.empty())
+			registerMesh(pending.meshFileName, mesh.get());
+		if(useMeshHashingRegistry && !mesh->empty()) {
+			Rendering::Mesh * registeredMesh = getRegisteredMesh(pending.hash, mesh.get());
+			if(registeredMesh == nullptr)
+				registerMesh(pending.hash, mesh.get());
+			else
+				mesh = registeredMesh;
+		}
+		if(!pending.meshId.empty())
+			sharedMeshes[pending.meshId] = mesh;
+		for(const auto & node : pending.nodes)
+			node->setMesh(mesh.get());
+	}
+	pendingMeshes.clear();
+	pendingMeshFiles.clear();
+	pendingMeshIds.clear();
+	pendingMeshDataSize = 0;
+}
+// ----------- mesh optimization
+
+void ImportContext::optimizeMeshes(){
+	if(rootNode == nullptr)
+		return;
+	// the imported nodes of each mesh that has not been processed before
+	std::unordered_map<Rendering::Mesh *, std::vector<GeometryNode *>> meshNodes;
+	std::vector<Rendering::Mesh *> meshes;
+	for(const auto & geoNode : collectNodes<GeometryNode>(rootNode)) {
+		Rendering::Mesh * mesh = geoNode->getMesh();
+		if(mesh == nullptr || processedMeshes.count(Util::Reference<Rendering::Mesh>(mesh)) > 0)
+			continue;
+		auto & nodes = meshNodes[mesh];
+		if(nodes.empty())
+			meshes.push_back(mesh);
+		nodes.push_back(geoNode);
+	}
+	if(meshes.empty())
+		return;
+
+	/* A mesh that is also referenced outside of this import (e.g. by the nodes of a previous import
+		that got it from a registry of this context) is not changed; its imported nodes get an optimized clone.	*/
+	std::unordered_map<Rendering::Mesh *, int> contextReferences;
+	for(const auto & entry : registeredMeshes)
+		++contextReferences[entry.second.get()];
+	for(const auto & bucket : registeredHashedMeshes) {
+		for(const auto & registeredMesh : bucket.second)
+			++contextReferences[registeredMesh.get()];
+	}
+	for(const auto & entry : sharedMeshes)
+		++contextReferences[entry.second.get()];
+	for(auto & mesh : meshes) {
+		const auto & nodes = meshNodes[mesh];
+		const auto contextIt = contextReferences.find(mesh);
+		const int knownReferences = static_cast<int>(nodes.size()) + (contextIt == contextReferences.end() ? 0 : contextIt->second);
+		if(mesh->countReferences() > knownReferences) {
+			mesh = mesh->clone();
+			for(const auto & node : nodes)
+				node->setMesh(mesh);
+		}
+		processedMeshes.insert(Util::Reference<Rendering::Mesh>(mesh));
+	}
+
+	const int meshCount = static_cast<int>(meshes.size());
+	std::vector<MeshOptimization::Result> results(meshes.size());
+	std::vector<char> optimized(meshes.size(), 0);
+COMPILER_WARN_PUSH
+COMPILER_WARN_OFF_CLANG(-Wunknown-pragmas)
+#pragma omp parallel for schedule(dynamic) if(meshCount > 1)
+	for(int i = 0; i < meshCount; ++i)
+		optimized[i] = MeshOptimization::optimizeMesh(meshes[i], results[i]) ? 1 : 0;
+COMPILER_WARN_POP
+
+	double trianglesBefore = 0.0;
+	double missesBefore = 0.0;
+	double missesAfter = 0.0;
+	const std::size_t firstResult = optimizedMeshes.size();
+	for(std::size_t i = 0; i < meshes.size(); ++i) {
+		if(!optimized[i])
+			continue;
+		Rendering::Mesh * mesh = meshes[i];
+		// the mesh no longer matches its file
+		mesh->setFileName(Util::FileName());
+		const double triangleCount = mesh->openIndexData().getIndexCount() / 3;
+		trianglesBefore += triangleCount;
+		missesBefore += results[i].acmrBefore * triangleCount;
+		missesAfter += results[i].acmrAfter * triangleCount;
+		optimizedMeshes.push_back({mesh, results[i]});
+	}
+	if(optimizedMeshes.size() > firstResult)
+		Util::info << "Optimized " << (optimizedMeshes.size() - firstResult) << " meshes: ACMR " << (missesBefore / trianglesBefore)
+				<< " -> " << (missesAfter / trianglesBefore) << ".\n";
+}
+
 }
 }
@@ -11,6 +11,8 @@
 #ifndef MINSG_IMPORT_CONTEXT_H
 #define MINSG_IMPORT_CONTEXT_H
 
+#include "../../Core/Nodes/GeometryNode.h"
+#include "../MeshOptimization.h"
 #include <Rendering/Mesh/Mesh.h>
 #include <Rendering/Texture/Texture.h>
 #include <Util/AttributeProvider.h>
@@ -20,6 +22,9 @@
 #include <functional>
 #include <deque>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -50,6 +55,8 @@ class ImportContext : public Util::AttributeProvider {
 		void addFinalizingAction(const FinalizeAction & action) {	finalizeActions.push_back(action);	}
 		void addSearchPath(std::string p) 					{	fileLocator.addSearchPath( std::move(p) );	}
 
+		/*! Decode the pending meshes (\see addPendingMesh), optimize the meshes if requested (\see optimizeMeshes),
+			and execute the registered finalizing actions. */
 		void executeFinalizingActions();
 		uint32_t getImportOptions()const					{	return importOptions;	}
 		const Util::FileName & getFileName()const			{	return fileName;	}
@@ -114,22 +121,104 @@ class ImportContext : public Util::AttributeProvider {
 		//@{
 	public:
 		typedef std::vector<Util::Reference<Rendering::Mesh> > meshHashingRegistryBucket_t;
-		typedef std::map<uint32_t, meshHashingRegistryBucket_t > meshHasingRegistry_t;
+		typedef std::map<uint64_t, meshHashingRegistryBucket_t > meshHasingRegistry_t;
 
-		/*!	Associates a Mesh with a hash value.  */
-		void registerMesh( const uint32_t hash , Rendering::Mesh * m)	{	registeredHashedMeshes[hash].push_back(m); }
+		/*!	Associates a Mesh with a hash value (\see MeshHashing::calculateHash).  */
+		void registerMesh( const uint64_t hash , Rendering::Mesh * m)	{	registeredHashedMeshes[hash].push_back(m); }
 
 
 		/*!	Returns a Mesh with the same data as the given mesh and hash-value
-			@param hash The hash of the mesh.
+			@param hash The hash of the mesh (\see MeshHashing::calculateHash).
 			@param mesh The Mesh for comparison.
 			@return The registered Mesh or nullptr.	*/
-		Rendering::Mesh * getRegisteredMesh(const uint32_t hash , Rendering::Mesh * m)const;
+		Rendering::Mesh * getRegisteredMesh(const uint64_t hash , Rendering::Mesh * m)const;
 
 	private:
 		meshHasingRegistry_t registeredHashedMeshes;
 		//@}
 
+		/**
+		 * @name Pending Meshes
+		 * The meshes of GeometryNodes can be decoded after the traversal of the scene description.
+		 * All pending meshes are decoded in parallel and are assigned to their nodes in the order
+		 * in which they have been added; the mesh registries are updated in the same order.
+		 */
+		//@{
+	public:
+		/*!	Decode the given MMF data block (Base64 encoded) later and assign the mesh to the node.
+			If @p meshId is not empty, other nodes can share the mesh by its id (\see addSharedMesh).
+			If @p compressedMesh is true, the block contains data of MeshEncoding::encodeMesh instead of MMF data.	*/
+		void addPendingMesh(GeometryNode * node, std::string base64Data, const std::string & meshId = "", bool compressedMesh = false);
+
+		/*!	Assign the mesh with the given id (Consts::ATTR_MESH_ID) to the node; the mesh has to be
+			added before. Used for meshes exported with EXPORT_OPTION_SHARE_EQUAL_MESHES.
+			@return false if no mesh with the given id is known.	*/
+		bool addSharedMesh(GeometryNode * node, const std::string & meshId);
+
+		/*!	Load the given mesh file later and assign the mesh to the node. If the mesh registry is
+			used (IMPORT_OPTION_USE_MESH_REGISTRY), all nodes using the same file share one mesh.	*/
+		void addPendingMeshFile(GeometryNode * node, const std::string & meshFileName);
+
+		/*!	Decode all pending meshes in parallel and assign them to their nodes.
+			@note Called by executeFinalizingActions() and after the import of the prototypes.	*/
+		void finishPendingMeshes();
+
+		bool hasPendingMeshes()const						{	return !pendingMeshes.empty();	}
+		//! Size of the encoded data of the pending meshes in bytes.
+		std::size_t getPendingMeshDataSize()const			{	return pendingMeshDataSize;	}
+
+	private:
+		struct PendingMesh {
+			std::vector<Util::Reference<GeometryNode>> nodes;
+			std::string base64Data;
+			std::string meshFileName;
+			std::string meshId;
+			uint64_t hash;
+			bool compressedMesh;
+			PendingMesh() : hash(0), compressedMesh(false) {}
+		};
+		std::vector<PendingMesh> pendingMeshes;
+		//! Index of the pending mesh loaded from a file; only used with the mesh registry.
+		std::unordered_map<std::string, std::size_t> pendingMeshFiles;
+		std::size_t pendingMeshDataSize = 0;
+		//! Index of the pending mesh with the given id.
+		std::unordered_map<std::string, std::size_t> pendingMeshIds;
+		//! Decoded meshes with an id.
+		std::unordered_map<std::string, Util::Reference<Rendering::Mesh>> sharedMeshes;
+		//@}
+
+		/**
+		 * @name Mesh Optimization
+		 * Used with IMPORT_OPTION_OPTIMIZE_MESHES.
+		 */
+		//@{
+	public:
+		struct OptimizedMesh {
+			Util::Reference<Rendering::Mesh> mesh;
+			MeshOptimization::Result result;
+		};
+
+		/*!	Optimize the meshes of all GeometryNodes below the root node in parallel; meshes that have
+			been processed before by this context are skipped. Meshes that are also used outside of the
+			current import are not changed; the imported nodes get optimized clones instead.
+			@note Called by executeFinalizingActions() if IMPORT_OPTION_OPTIMIZE_MESHES is set.	*/
+		void optimizeMeshes();
+
+		//! The meshes that have been optimized by this context with their vertex counts and ACMR.
+		const std::vector<OptimizedMesh> & getOptimizedMeshes()const	{	return optimizedMeshes;	}
+
+	private:
+		std::vector<OptimizedMesh> optimizedMeshes;
+		struct MeshReferenceHash {
+			std::size_t operator()(const Util::Reference<Rendering::Mesh> & mesh) const {
+				return std::hash<Rendering::Mesh *>()(mesh.get());
+			}
+		};
+		/*! All meshes passed to MeshOptimization::optimizeMesh; the references keep them alive, so that
+			the address of a released mesh cannot be taken by a new mesh that would then be skipped.	*/
+		std::unordered_set<Util::Reference<Rendering::Mesh>, MeshReferenceHash> processedMeshes;
+		//@}
+
 
 };
 
@@ -88,7 +88,7 @@ void registerBehaviourImporter(BehaviourImport_Fn_t fn)				{	behaviourImporter.p
 void registerAdditionalDataImporter(AdditionalDataImport_Fn_t fn)	{	additionalDataImporter.push_back(fn);	}
 
 
-static bool processDescription(ImportContext & ctxt, const DescriptionMap & d, Node * parent) {
+bool processDescription(ImportContext & ctxt, const DescriptionMap & d, Node * parent) {
 	if( !parent){
 		WARN("parent may not be null");
 		return false;
@@ -164,15 +164,19 @@ void finalizeNode(ImportContext & ctxt, Node * node,const DescriptionMap & d){
 	if(node==nullptr)
 		return;
 	registerNamedNode(ctxt,d, node);
+	std::vector<float> values;
 	{ // applyTransformation(d, node);
 		Util::GenericAttribute * matrixAttribute = d.getValue(Consts::ATTR_MATRIX);
 		node->resetRelTransformation();
 		if(matrixAttribute) {
-			std::istringstream matrixStream(matrixAttribute->toString());
-			Geometry::Matrix4x4f matrix;
-			matrixStream >> matrix;
-			if(!matrix.isIdentity()) {
-				node->setRelTransformation(matrix);
+			getFloatValues(d, Consts::ATTR_MATRIX, values);
+			if(values.size() != 16) {
+				WARN("Syntax error in matrix.");
+			} else {
+				const Geometry::Matrix4x4f matrix(values.data());
+				if(!matrix.isIdentity()) {
+					node->setRelTransformation(matrix);
+				}
 			}
 		} else {
 			Geometry::SRT srt = getSRT(d);
@@ -187,10 +191,9 @@ void finalizeNode(ImportContext & ctxt, Node * node,const DescriptionMap & d){
 	}
 
 	if(d.contains(Consts::ATTR_FIXED_BB)){
-		const std::string bbString = d.getString(SceneManagement::Consts::ATTR_FIXED_BB);
-		const auto boxValues = Util::StringUtils::toFloats(bbString);
-		FAIL_IF(boxValues.size() != 6);
-		node->setFixedBB(Geometry::Box(Geometry::Vec3(boxValues[0], boxValues[1], boxValues[2]), boxValues[3], boxValues[4], boxValues[5]));
+		getFloatValues(d, Consts::ATTR_FIXED_BB, values);
+		FAIL_IF(values.size() != 6);
+		node->setFixedBB(Geometry::Box(Geometry::Vec3(values[0], values[1], values[2]), values[3], values[4], values[5]));
 	}
 
 	if(d.contains(Consts::ATTR_RENDERING_LAYERS))
@@ -245,11 +248,11 @@ void finalizeState(ImportContext & ctxt, State * state,const DescriptionMap & d)
 
 //! (static)
 Geometry::SRT getSRT(const DescriptionMap & d) {
+	std::vector<float> values;
 	Geometry::Vec3 pos(0,0,0);
 	{
-		Util::GenericAttribute * attr = d.getValue(Consts::ATTR_SRT_POS);
-		if(attr) {
-			const auto values = Util::StringUtils::toFloats(attr->toString());
+		if(d.contains(Consts::ATTR_SRT_POS)) {
+			getFloatValues(d, Consts::ATTR_SRT_POS, values);
 			if(values.size() != 3) {
 				WARN("Syntax error in position of SRT.");
 				return Geometry::SRT();
@@ -259,9 +262,8 @@ Geometry::SRT getSRT(const DescriptionMap & d) {
 	}
 	Geometry::Vec3 dir(0,0,1);
 	{
-		Util::GenericAttribute * attr = d.getValue(Consts::ATTR_SRT_DIR);
-		if(attr) {
-			const auto values = Util::StringUtils::toFloats(attr->toString());
+		if(d.contains(Consts::ATTR_SRT_DIR)) {
+			getFloatValues(d, Consts::ATTR_SRT_DIR, values);
 			if(values.size() != 3) {
 				WARN("Syntax error in direction vector of SRT.");
 				return Geometry::SRT();
@@ -271,9 +273,8 @@ Geometry::SRT getSRT(const DescriptionMap & d) {
 	}
 	Geometry::Vec3 up(0,1,0);
 	{
-		Util::GenericAttribute * attr = d.getValue(Consts::ATTR_SRT_UP);
-		if(attr) {
-			const auto values = Util::StringUtils::toFloats(attr->toString());
+		if(d.contains(Consts::ATTR_SRT_UP)) {
+			getFloatValues(d, Consts::ATTR_SRT_UP, values);
 			if(values.size() != 3) {
 				WARN("Syntax error in up vector of SRT.");
 				return Geometry::SRT();
@@ -283,14 +284,31 @@ Geometry::SRT getSRT(const DescriptionMap & d) {
 	}
 	float scale = 1.0f;
 	{
-		Util::GenericAttribute * srtScale = d.getValue(Consts::ATTR_SRT_SCALE);
-		if(srtScale) {
-			scale = Util::StringUtils::toNumber<float>(srtScale->toString());
+		getFloatValues(d, Consts::ATTR_SRT_SCALE, values);
+		if(!values.empty()) {
+			scale = values.front();
 		}
 	}
 	return Geometry::SRT(pos,dir,up,scale);
 }
 
+//! (static)
+void getFloatValues(const DescriptionMap & d, const Util::StringIdentifier & key, std::vector<float> & values) {
+	const Util::GenericAttribute * attr = d.getValue(key);
+	if(attr == nullptr) {
+		values.clear();
+		return;
+	}
+	const auto floatValues = dynamic_cast<const FloatValuesAttribute *>(attr);
+	if(floatValues != nullptr) {
+		values.assign(floatValues->getValues().begin(), floatValues->getValues().end());
+		return;
+	}
+	const std::string str = attr->toString();
+	if(!parseFloatValues(str, values))
+		values = Util::StringUtils::toFloats(str);
+}
+
 //! (static)
 void addAttributes(ImportContext & ctxt, const DescriptionArray * subDescriptions, Util::AttributeProvider * attrProvider)  {
 	if( !subDescriptions ) 
@@ -378,6 +396,36 @@ MeshImportHandler * getMeshImportHandler() 							{	return meshImportHandler.get
 //! @note This object takes ownership of the import handler and will delete it when it is not needed anymore.
 void setMeshImportHandler(std::unique_ptr<MeshImportHandler> handler)	{	meshImportHandler=std::move(handler);	}
 
+void importDefinitions(ImportContext & ctxt, const DescriptionMap & defs) {
+	/// prototype Nodes
+	auto nodes = dynamic_cast<const DescriptionArray *>(defs.getValue(Consts::CHILDREN));
+	if(!nodes)
+		return;
+	for(auto & node : *nodes) {
+		auto p = dynamic_cast<const DescriptionMap *>(node.get());
+		if(!p)
+			FAIL();
+		if(p->getString(Consts::TYPE) == Consts::TYPE_NODE) {
+			Util::Reference<ListNode> dummy = new ListNode;
+			processDescription(ctxt, *p, dummy.get());
+			//Util::info << "Created Prototype \""<<getNameOfRegisteredNode(n)<<"\".\n";
+		} else if(p->getString(Consts::TYPE) == Consts::TYPE_ADDITIONAL_DATA) {
+			// handleAdditionalData(ctxt, *p);
+			bool handled = false;
+			for(const auto & importer : additionalDataImporter) {
+				if(importer(ctxt, p->getString(Consts::ATTR_NODE_TYPE), *p)) {
+					handled = true;
+					break;
+				}
+			}
+			if(!handled)
+				WARN("Could not handle additional data Node!");
+		} else {
+			WARN(std::string("Unsupported Prototype: ") + p->getString(Consts::TYPE));
+		}
+	}
+}
+
 void buildSceneFromDescription(ImportContext & ctxt,const DescriptionMap * d) {
 	Util::info << "\nBegin parsing description:\n";
 	if( !d ) {
@@ -395,39 +443,13 @@ void buildSceneFromDescription(ImportContext & ctxt,const DescriptionMap * d) {
 	}
 	{
 		/// read Definitions
-		//		Util::info << "defs:\n";
 		auto defs = dynamic_cast<const DescriptionMap *>(d->getValue(Consts::DEFINITIONS));
-		if(defs) {
-			/// prototype Nodes
-			auto nodes = dynamic_cast<const DescriptionArray *>(defs->getValue(Consts::CHILDREN));
-			if(nodes) {
-				for(auto & node : *nodes) {
-					auto p = dynamic_cast<const DescriptionMap *>(node.get());
-					if(!p)
-						FAIL();
-					if(p->getString(Consts::TYPE) == Consts::TYPE_NODE) {
-						Util::Reference<ListNode> dummy = new ListNode;
-						processDescription(ctxt, *p, dummy.get());
-						//Util::info << "Created Prototype \""<<getNameOfRegisteredNode(n)<<"\".\n";
-					} else if(p->getString(Consts::TYPE) == Consts::TYPE_ADDITIONAL_DATA) {
-						// handleAdditionalData(ctxt, *p);
-						bool handled = false;
-						for(const auto & importer : additionalDataImporter) {
-							if(importer(ctxt, p->getString(Consts::ATTR_NODE_TYPE), *p)) {
-								handled = true;
-								break;
-							}
-						}
-						if(!handled)
-							WARN("Could not handle additional data Node!");
-					} else {
-						WARN(std::string("Unsupported Prototype: ") + p->getString(Consts::TYPE));
-					}
-				}
-			}
-		}
+		if(defs)
+			importDefinitions(ctxt, *defs);
 		Util::info << "---\n";
 	}
+	// the prototypes are cloned when the children are read, so their meshes have to be available
+	ctxt.finishPendingMeshes();
 
 	{
 		/// read children
@@ -14,6 +14,7 @@
 #include "ImportContext.h"
 #include <deque>
 #include <string>
+#include <vector>
 
 namespace Geometry {
 template<typename T_> class _SRT;
@@ -22,6 +23,7 @@ typedef _SRT<float> SRT;
 namespace Util {
 class GenericAttributeList;
 class GenericAttributeMap;
+class StringIdentifier;
 }
 namespace MinSG {
 class Node;
@@ -53,6 +55,11 @@ void finalizeState(ImportContext & ctxt, State * state,const DescriptionMap & d)
 
 Geometry::SRT getSRT(const DescriptionMap & d) ;
 
+/*! Store the numbers stored for the given key in @p values, which is cleared if the key is not set.
+	Values that have already been parsed by the reader (\see FloatValuesAttribute) are copied directly;
+	passing the same array for several keys avoids repeated allocations.	*/
+void getFloatValues(const DescriptionMap & d, const Util::StringIdentifier & key, std::vector<float> & values);
+
 void addAttributes(ImportContext & ctxt, const DescriptionArray * subDescriptions, Util::AttributeProvider * attrProvider) ;
 
 typedef std::function<bool (ImportContext & ctxt,const std::string & type, const DescriptionMap & description, GroupNode * parent)> NodeImport_Fn_t;
@@ -68,6 +75,14 @@ void registerAdditionalDataImporter(AdditionalDataImport_Fn_t);
 MeshImportHandler * getMeshImportHandler();
 void setMeshImportHandler(std::unique_ptr<MeshImportHandler> handler);
 
+/*! Create the node, state or behaviour of the given description using the registered importers.
+	A created node is added to @p parent (which has to be a GroupNode); a state or behaviour is added to @p parent.
+	@return true iff an importer handled the description.	*/
+bool processDescription(ImportContext & ctxt, const DescriptionMap & d, Node * parent);
+
+/*! Create the prototype nodes and the additional data of a "defs" description.	*/
+void importDefinitions(ImportContext & ctxt, const DescriptionMap & defs);
+
 void buildSceneFromDescription(ImportContext & importContext,const DescriptionMap * d);
 
 }
@@ -9,6 +9,7 @@
 	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
 */
 #include "ReaderDAE.h"
+#include "../NumberParsing.h"
 #include "../SceneDescription.h"
 #include <Geometry/Matrix4x4.h>
 #include <Geometry/Vec3.h>
@@ -21,7 +22,9 @@
 #include <Util/MicroXML.h>
 #include <Util/StringUtils.h>
 #include <Util/Utils.h>
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <deque>
 #include <iostream>
 #include <iterator>
@@ -30,6 +33,7 @@
 #include <map>
 #include <memory>
 #include <stack>
+#include <vector>
 
 namespace MinSG {
 namespace SceneManagement {
@@ -73,7 +77,127 @@ static const Util::StringIdentifier DAE_ATTR_TEXCOORD("texcoord");
 static const Util::StringIdentifier DAE_ATTR_TEXTURE("texture");
 static const Util::StringIdentifier DAE_ATTR_URL("url");
 
-typedef Util::WrapperAttribute<std::deque<float>> float_data_t;
+typedef Util::WrapperAttribute<std::vector<float>> float_data_t;
+typedef Util::WrapperAttribute<std::vector<uint32_t>> index_data_t;
+
+//! Large number arrays are split into chunks of this size, which are parsed in parallel.
+static const std::size_t NUMBER_CHUNK_SIZE = 1024 * 1024;
+
+static inline bool isSpace(char c) {
+	return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static inline bool isDigit(char c) {
+	return c >= '0' && c <= '9';
+}
+
+//! (internal) Parse the float beginning at @p cursor. @return Pointer behind the number, or nullptr on failure.
+static const char * parseNumber(const char * cursor, const char * end, float & value) {
+	const char * next = NumberParsing::parseFloat(cursor, end, value);
+	if(next == nullptr || (next != end && !isSpace(*next)))
+		return nullptr;
+	return next;
+}
+
+//! (internal) Parse the unsigned integer beginning at @p cursor. @return Pointer behind the number, or nullptr on failure.
+static const char * parseNumber(const char * cursor, const char * end, uint32_t & value) {
+	uint64_t result = 0;
+	const char * const begin = cursor;
+	for(; cursor != end && isDigit(*cursor); ++cursor) {
+		result = result * 10 + static_cast<uint64_t>(*cursor - '0');
+		if(result > UINT32_MAX)
+			return nullptr;
+	}
+	if(cursor == begin || (cursor != end && !isSpace(*cursor)))
+		return nullptr;
+	value = static_cast<uint32_t>(result);
+	return cursor;
+}
+
+//! (internal) Return the number of whitespace separated tokens in the given range.
+static std::size_t countTokens(const char * cursor, const char * end) {
+	std::size_t count = 0;
+	bool inToken = false;
+	for(; cursor != end; ++cursor) {
+		const bool space = isSpace(*cursor);
+		if(!space && !inToken)
+			++count;
+		inToken = !space;
+	}
+	return count;
+}
+
+/*! (internal) Parse the numbers of the range and write them to @p out; invalid numbers are written as zero.
+	@return false if an invalid number has been found.	*/
+template<typename value_t, typename OutputIterator>
+static bool parseNumbers(const char * cursor, const char * end, OutputIterator out) {
+	bool valid = true;
+	while(true) {
+		while(cursor != end && isSpace(*cursor))
+			++cursor;
+		if(cursor == end)
+			return valid;
+		value_t value = 0;
+		const char * next = parseNumber(cursor, end, value);
+		if(next == nullptr) {
+			value = 0;
+			valid = false;
+			next = cursor;
+			while(next != end && !isSpace(*next))
+				++next;
+		}
+		*out = value;
+		++out;
+		cursor = next;
+	}
+}
+
+/*! (internal) Convert the whitespace separated numbers of a <float_array> or <p> element. Small arrays are
+	parsed into storage reserved for @p expectedCount values (the count attribute of the element). Large
+	arrays are split at whitespace into chunks; the tokens of all chunks are counted in parallel, the array
+	is allocated once, and the chunks are parsed in parallel directly into their part of the array.
+	@return false if an invalid number has been found.	*/
+template<typename value_t>
+static bool parseNumberArray(const std::string & text, std::size_t expectedCount, std::vector<value_t> & values) {
+	const char * const begin = text.data();
+	const char * const end = begin + text.size();
+	values.clear();
+	if(text.size() <= NUMBER_CHUNK_SIZE) {
+		values.reserve(expectedCount);
+		return parseNumbers<value_t>(begin, end, std::back_inserter(values));
+	}
+
+	// chunk k contains the tokens beginning in [chunkBegins[k], chunkBegins[k+1]); chunks are split at whitespace
+	const int chunkCount = static_cast<int>((text.size() + NUMBER_CHUNK_SIZE - 1) / NUMBER_CHUNK_SIZE);
+	std::vector<const char *> chunkBegins(static_cast<std::size_t>(chunkCount) + 1, end);
+	chunkBegins[0] = begin;
+	for(int k = 1; k < chunkCount; ++k) {
+		const char * cursor = std::max(begin + static_cast<std::size_t>(k) * NUMBER_CHUNK_SIZE, chunkBegins[k - 1]);
+		while(cursor != end && !isSpace(*cursor))
+			++cursor;
+		chunkBegins[k] = cursor;
+	}
+
+	std::vector<std::size_t> chunkOffsets(static_cast<std::size_t>(chunkCount) + 1, 0);
+COMPILER_WARN_PUSH
+COMPILER_WARN_OFF_CLANG(-Wunknown-pragmas)
+#pragma omp parallel for schedule(dynamic)
+	for(int k = 0; k < chunkCount; ++k)
+		chunkOffsets[k + 1] = countTokens(chunkBegins[k], chunkBegins[k + 1]);
+COMPILER_WARN_POP
+	for(int k = 0; k < chunkCount; ++k)
+		chunkOffsets[k + 1] += chunkOffsets[k];
+
+	values.resize(chunkOffsets[chunkCount]);
+	std::vector<char> validChunks(static_cast<std::size_t>(chunkCount), 1);
+COMPILER_WARN_PUSH
+COMPILER_WARN_OFF_CLANG(-Wunknown-pragmas)
+#pragma omp parallel for schedule(dynamic)
+	for(int k = 0; k < chunkCount; ++k)
+		validChunks[k] = parseNumbers<value_t>(chunkBegins[k], chunkBegins[k + 1], values.data() + chunkOffsets[k]) ? 1 : 0;
+COMPILER_WARN_POP
+	return std::find(validChunks.begin(), validChunks.end(), 0) == validChunks.end();
+}
 
 //! Add the given child description to the Consts::CHILDREN-List of the container.
 static void addToMinSGChildren(DescriptionMap * container, DescriptionMap * child) {
@@ -173,7 +297,8 @@ struct VertexPart {
 	} type;
 	uint16_t indexOffset;
 	uint16_t stride;
-	std::vector<float> data;
+	//! Values of the <float_array>; owned by the description of the array.
+	const std::vector<float> * data;
 
 	//! Fill the internal fields from the given @c <source> description.
 	bool fill(const std::string & semantic, const uint16_t offset, const DescriptionMap * desc) {
@@ -220,9 +345,9 @@ struct VertexPart {
 			WARN("Wrong data format.");
 			return false;
 		}
-		std::copy(floatData->ref().begin(), floatData->ref().end(), std::back_inserter(data));
+		data = &floatData->ref();
 
-		if(data.size() != Util::StringUtils::toNumber<size_t>(floatArray->getString(DAE_ATTR_COUNT))) {
+		if(data->size() != Util::StringUtils::toNumber<size_t>(floatArray->getString(DAE_ATTR_COUNT))) {
 			WARN("Vertex count does not match.");
 			return false;
 		}
@@ -1034,8 +1159,14 @@ bool VisitorContext::data(const std::string & tagName, const std::string & _data
 	if(tagName == "float_array") {
 		// convert string to list of numbers
 		auto floatData = new float_data_t;
-		Util::StringUtils::extractFloats(_data, floatData->ref());
+		if(!parseNumberArray(_data, Util::StringUtils::toNumber<size_t>(elementStack.top()->getString(DAE_ATTR_COUNT)), floatData->ref()))
+			WARN("Invalid number in <float_array>.");
 		elementStack.top()->setValue(DAE_DATA, floatData);
+	} else if(tagName == "p") {
+		auto indexData = new index_data_t;
+		if(!parseNumberArray(_data, 0, indexData->ref()))
+			WARN("Invalid index in <p>.");
+		elementStack.top()->setValue(DAE_DATA, indexData);
 	} else {
 		elementStack.top()->setValue(DAE_DATA, Util::GenericAttribute::createString(_data));
 	}
@@ -1323,6 +1454,21 @@ Rendering::Mesh * VisitorContext::createSingleMesh(const std::deque<VertexPart>
 	const VertexAttribute &  weightAttrCount = vd.getAttribute(ATTR_ID_WEIGHTSCOUNT);
 #endif
 
+	// check the indices before the mesh is created
+	const std::size_t vertexIndexCount = static_cast<std::size_t>(3) * triangleCount * (maxIndexOffset + 1);
+	if(indices.size() < vertexIndexCount) {
+		WARN("Too few indices.");
+		return nullptr;
+	}
+	for(const auto & part : orderedParts) {
+		for(std::size_t indexPos = part.indexOffset; indexPos < vertexIndexCount; indexPos += maxIndexOffset + 1) {
+			if((static_cast<std::size_t>(indices[indexPos]) + 1) * part.stride > part.data->size()) {
+				WARN("Index out of range.");
+				return nullptr;
+			}
+		}
+	}
+
 	// create mesh
 	auto mesh = new Mesh();
 	MeshIndexData & iData = mesh->openIndexData();
@@ -1348,7 +1494,7 @@ Rendering::Mesh * VisitorContext::createSingleMesh(const std::deque<VertexPart>
 				vertexPos = indices[indexPos + part.indexOffset];
 #endif
 			for(uint_fast8_t v = 0; v < part.stride; ++v) {
-				*vertexData = part.data[pos];
+				*vertexData = (*part.data)[pos];
 				++vertexData;
 				++pos;
 			}
@@ -1636,11 +1782,9 @@ bool VisitorContext::createMeshes(const DescriptionMap * geoDesc, mesh_list_t &
 				continue;
 			}
 
-			std::string vCountData = vCountNode->getString(DAE_DATA);
-			std::deque<unsigned long> vCountValues;
-			Util::StringUtils::extractUnsignedLongs(vCountData, vCountValues);
-
-			bool valid = true;
+			// the count attribute of the polylist is the number of polygons
+			std::vector<uint32_t> vCountValues;
+			bool valid = parseNumberArray(vCountNode->getString(DAE_DATA), triangleCount, vCountValues);
 			const size_t vCountSize = vCountValues.size();
 			for(uint_fast32_t i = 0; i < vCountSize; ++i){
 				if(vCountValues[i] != 3 && vCountValues[i] != 4) {
@@ -1712,13 +1856,10 @@ bool VisitorContext::createMeshes(const DescriptionMap * geoDesc, mesh_list_t &
 					}
 				} else if(child->getString(DAE_TAG_TYPE) == "p") {
 
-					const std::string indexData = child->getString(DAE_DATA);
-					// Convert string to numbers immediately.
-					std::deque<unsigned long> pIndexVector;
-					Util::StringUtils::extractUnsignedLongs(indexData, pIndexVector);
-
-					if(pIndexVector.empty())
+					const index_data_t * pIndexData = dynamic_cast<const index_data_t *>(child->getValue(DAE_DATA));
+					if(pIndexData == nullptr || pIndexData->ref().empty())
 						continue;
+					const std::vector<uint32_t> & pIndexVector = pIndexData->ref();
 					/* 2-------1
 					 * |	   |
 					 * |       |
@@ -1736,30 +1877,30 @@ bool VisitorContext::createMeshes(const DescriptionMap * geoDesc, mesh_list_t &
 					 *   '     |
 					 * 3-------4
 					 */
+					const std::size_t vertexStride = maxIndexOffset + 1u;
+					std::size_t quadCount = 0;
+					for(uint_fast32_t i = 0; i < vCountSize; ++i) {
+						if(vCountValues[i] == 4)
+							++quadCount;
+					}
+					if(pIndexVector.size() < (3 * vCountSize + quadCount) * vertexStride) {
+						WARN("Too few indices in polylist.");
+						continue;
+					}
+					triangleCount += static_cast<uint32_t>(quadCount); //each quad adds one triangle
+					indices.reserve(indices.size() + (3 * vCountSize + 3 * quadCount) * vertexStride);
 
-					int curIndex = 0;
+					auto polygonBegin = pIndexVector.begin();
 					for(uint_fast32_t i = 0; i < vCountSize; ++i){
+						// triangle (1, 2, 3)
+						indices.insert(indices.end(), polygonBegin, polygonBegin + 3 * vertexStride);
 						if(vCountValues[i] == 4) {
-							triangleCount++; //increment triangle count
-
-							int insertPIndexVertex1 = curIndex + 3 * (maxIndexOffset + 1); //index to insert vertex copy of 3 for new triangle
-							int insertPIndexVertex2 = insertPIndexVertex1 + 2 * (maxIndexOffset + 1); //index to insert vertex copy of 1 for new triangle
-
-							//new vertex (copy of 3)
-							std::deque<unsigned long> toInsert1(pIndexVector.begin() + curIndex + 2 * (maxIndexOffset + 1), pIndexVector.begin() + curIndex + 3 * (maxIndexOffset + 1));
-							pIndexVector.insert(pIndexVector.begin() + insertPIndexVertex1, toInsert1.begin(), toInsert1.end());
-
-							//new vertex (copy of 1)
-							std::deque<unsigned long> toInsert2(pIndexVector.begin() + curIndex, pIndexVector.begin() + curIndex + maxIndexOffset + 1);
-							pIndexVector.insert(pIndexVector.begin() + insertPIndexVertex2, toInsert2.begin(), toInsert2.end());
-
-							curIndex += 2 * (maxIndexOffset + 1); //p vector is longer now, so increment index
+							// second triangle (3, 4, 1)
+							indices.insert(indices.end(), polygonBegin + 2 * vertexStride, polygonBegin + 4 * vertexStride);
+							indices.insert(indices.end(), polygonBegin, polygonBegin + vertexStride);
 						}
-						curIndex += vCountValues[i] * (maxIndexOffset + 1); //increment index (also for 3-vertex polys)
+						polygonBegin += vCountValues[i] * vertexStride;
 					}
-
-					// Copy to vector.
-					indices.insert(indices.end(), pIndexVector.begin(), pIndexVector.end());
 				}
 			}
 #ifdef MINSG_EXT_SKELETAL_ANIMATION
@@ -1842,12 +1983,9 @@ bool VisitorContext::createMeshes(const DescriptionMap * geoDesc, mesh_list_t &
 						}
 					}
 				} else if(child->getString(DAE_TAG_TYPE) == "p") {
-					const std::string indexData = child->getString(DAE_DATA);
-					// Convert string to numbers immediately.
-					std::deque<unsigned long> indicesTemp;
-					Util::StringUtils::extractUnsignedLongs(indexData, indicesTemp);
-					// Copy to vector.
-					indices.insert(indices.end(), indicesTemp.begin(), indicesTemp.end());
+					const index_data_t * pIndexData = dynamic_cast<const index_data_t *>(child->getValue(DAE_DATA));
+					if(pIndexData != nullptr)
+						indices.insert(indices.end(), pIndexData->ref().begin(), pIndexData->ref().end());
 				}
 			}
 #ifdef MINSG_EXT_SKELETAL_ANIMATION
@@ -9,17 +9,64 @@
 	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
 */
 #include "ReaderMinSG.h"
+#include "ImportContext.h"
+#include "ImporterTools.h"
 #include "../SceneDescription.h"
+#include "../../Core/Nodes/ListNode.h"
 #include <Util/Macros.h>
 #include <Util/GenericAttribute.h>
 #include <Util/MicroXML.h>
+#include <Util/References.h>
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <stack>
+#include <string>
+#include <vector>
 
 namespace MinSG {
 namespace SceneManagement {
 namespace ReaderMinSG {
 
+//! Return true if the value of the attribute consists of float values that are parsed directly.
+static bool isFloatAttribute(const Util::StringIdentifier & key, const Util::MicroXML::attributes_t & attributes) {
+	static const Util::StringIdentifier floatAttributes[] = {
+		Consts::ATTR_SRT_POS, Consts::ATTR_SRT_DIR, Consts::ATTR_SRT_UP, Consts::ATTR_SRT_SCALE,
+		Consts::ATTR_MATRIX, Consts::ATTR_FIXED_BB,
+		Consts::ATTR_LIGHT_AMBIENT, Consts::ATTR_LIGHT_DIFFUSE, Consts::ATTR_LIGHT_SPECULAR,
+		Consts::ATTR_MATERIAL_AMBIENT, Consts::ATTR_MATERIAL_DIFFUSE, Consts::ATTR_MATERIAL_SPECULAR,
+		Consts::ATTR_MATERIAL_EMISSION, Consts::ATTR_MATERIAL_SHININESS
+	};
+	if(std::find(std::begin(floatAttributes), std::end(floatAttributes), key) != std::end(floatAttributes))
+		return true;
+	if(key == Consts::ATTR_SHADER_UNIFORM_VALUES) {
+		static const std::string floatUniformTypes[] = {
+			Consts::SHADER_UNIFORM_TYPE_FLOAT, Consts::SHADER_UNIFORM_TYPE_VEC2F, Consts::SHADER_UNIFORM_TYPE_VEC3F,
+			Consts::SHADER_UNIFORM_TYPE_VEC4F, Consts::SHADER_UNIFORM_TYPE_MATRIX_2X2F,
+			Consts::SHADER_UNIFORM_TYPE_MATRIX_3X3F, Consts::SHADER_UNIFORM_TYPE_MATRIX_4X4F
+		};
+		for(const auto & attrEntry : attributes) {
+			if(attrEntry.first == Consts::ATTR_SHADER_UNIFORM_TYPE.toString())
+				return std::find(std::begin(floatUniformTypes), std::end(floatUniformTypes), attrEntry.second) != std::end(floatUniformTypes);
+		}
+	}
+	return false;
+}
+
+/*! Store the attributes of an element in its description. Numeric values are parsed once here,
+	so that the importers do not have to parse their string representation.	*/
+static void setAttributes(DescriptionMap & desc, const Util::MicroXML::attributes_t & attributes) {
+	std::vector<float> values;
+	for(const auto & attrEntry : attributes) {
+		const Util::StringIdentifier key(attrEntry.first);
+		if(isFloatAttribute(key, attributes) && parseFloatValues(attrEntry.second, values)) {
+			desc.setValue(key, new FloatValuesAttribute(values));
+		} else {
+			desc.setString(key, attrEntry.second);// TODO! (manager.parseString(it->second)));
+		}
+	}
+}
+
 struct VisitorContext {
 	std::stack<DescriptionMap *> elements;
 	std::unique_ptr<DescriptionMap> scene;
@@ -41,9 +88,7 @@ static bool visitorEnter(VisitorContext & ctxt,
 		ctxt.scene.reset(desc);
 	}
 
-	for(const auto & attrEntry : attributes) {
-		desc->setString(attrEntry.first, attrEntry.second);// TODO! (manager.parseString(it->second)));
-	}
+	setAttributes(*desc, attributes);
 
 	if(!parent) {
 		return true;
@@ -87,6 +132,147 @@ const DescriptionMap * loadScene(std::istream & in) {
 	return context.scene.release();
 }
 
+
+// ----------- streamed import
+
+//! Limit for the size of the pending mesh data; the pending meshes are decoded when it is exceeded.
+static const std::size_t MAX_PENDING_MESH_DATA_SIZE = 64 * 1024 * 1024;
+
+struct StreamingElement {
+	//! Description of an element that is imported when it is closed; nullptr if the description is part of its parent's description.
+	std::unique_ptr<DescriptionMap> ownedDescription;
+	DescriptionMap * description;
+	//! If true, the child nodes are created when they are closed and collected in @a children; only the description of the element itself is kept.
+	bool streamChildren;
+	std::vector<Util::Reference<Node>> children;
+
+	StreamingElement() : description(nullptr), streamChildren(false) {}
+};
+
+struct StreamingContext {
+	ImportContext & importContext;
+	std::vector<StreamingElement> elements;
+	//! Temporary parent of the created nodes.
+	Util::Reference<ListNode> container;
+	bool sceneFound;
+
+	explicit StreamingContext(ImportContext & _importContext) :
+		importContext(_importContext), container(new ListNode), sceneFound(false) {}
+};
+
+static bool streamingEnter(StreamingContext & ctxt,
+						   const std::string & tagName,
+						   const Util::MicroXML::attributes_t & attributes) {
+	std::unique_ptr<DescriptionMap> desc(new DescriptionMap);
+	desc->setString(Consts::TYPE, tagName);
+	setAttributes(*desc, attributes);
+
+	StreamingElement element;
+	element.description = desc.get();
+	if(ctxt.elements.empty()) {
+		if(tagName != "scene" || ctxt.sceneFound) {
+			WARN("Unknown Format.");
+			return false;
+		}
+		ctxt.sceneFound = true;
+		element.ownedDescription = std::move(desc);
+		element.streamChildren = true;
+	} else {
+		StreamingElement & parent = ctxt.elements.back();
+		if(ctxt.elements.size() == 1 || (parent.streamChildren && tagName == Consts::TYPE_NODE)) {
+			/* The node importers only look at the states, behaviours, data and attributes of their descriptions;
+				child nodes are created by ImporterTools::finalizeNode, so they can be created before their parent. */
+			element.streamChildren = (tagName == Consts::TYPE_NODE);
+			element.ownedDescription = std::move(desc);
+		} else if(tagName == "defs") {
+			parent.description->setValue(Consts::DEFINITIONS, desc.release());
+		} else {
+			auto * children = dynamic_cast<DescriptionArray *>(parent.description->getValue(Consts::CHILDREN));
+			if(!children) {
+				children = new DescriptionArray;
+				parent.description->setValue(Consts::CHILDREN, children);
+			}
+			children->push_back(desc.release());
+		}
+	}
+	ctxt.elements.push_back(std::move(element));
+	return true;
+}
+
+static bool streamingLeave(StreamingContext & ctxt, const std::string & tagName) {
+	if(ctxt.elements.empty()) {
+		FAIL();
+	}
+	const StreamingElement element = std::move(ctxt.elements.back());
+	ctxt.elements.pop_back();
+	if(!element.ownedDescription || ctxt.elements.empty())
+		return true;
+
+	ImportContext & importContext = ctxt.importContext;
+	if(tagName == "defs" && ctxt.elements.size() == 1) {
+		ImporterTools::importDefinitions(importContext, *element.ownedDescription);
+		// the prototypes are cloned when the following nodes are created, so their meshes have to be available
+		importContext.finishPendingMeshes();
+		return true;
+	} else if(tagName != Consts::TYPE_NODE) {
+		WARN(std::string("Unsupported Type:") + tagName);
+		return true;
+	}
+
+	if(!ImporterTools::processDescription(importContext, *element.ownedDescription, ctxt.container.get())) {
+		WARN("Could not create Node");
+		return true;
+	}
+	std::vector<Util::Reference<Node>> nodes;
+	for(std::size_t i = 0; i < ctxt.container->countChildren(); ++i) {
+		nodes.emplace_back(ctxt.container->getChild(i));
+	}
+	ctxt.container->clearChildren();
+
+	if(!element.children.empty()) {
+		auto group = nodes.empty() ? nullptr : dynamic_cast<GroupNode *>(nodes.front().get());
+		if(group == nullptr) {
+			WARN("Only GroupNodes can have children.");
+		} else {
+			group->addChildren(element.children);
+		}
+	}
+	if(ctxt.elements.size() == 1) {
+		for(const auto & node : nodes) {
+			importContext.getRootNode()->addChild(node);
+		}
+	} else {
+		auto & parentChildren = ctxt.elements.back().children;
+		parentChildren.insert(parentChildren.end(), nodes.begin(), nodes.end());
+	}
+
+	if(importContext.getPendingMeshDataSize() > MAX_PENDING_MESH_DATA_SIZE)
+		importContext.finishPendingMeshes();
+	return true;
+}
+
+static bool streamingData(StreamingContext & ctxt, const std::string & /*tag*/, const std::string & data) {
+	if(!ctxt.elements.empty()) {
+		ctxt.elements.back().description->setString(Consts::DATA_BLOCK, data);
+	}
+	return true;
+}
+
+bool importScene(ImportContext & importContext, std::istream & in) {
+	if(!importContext.getRootNode()) {
+		WARN("No container!");
+		return false;
+	}
+	StreamingContext context(importContext);
+	using namespace std::placeholders;
+	Util::MicroXML::Reader::traverse(in,
+									 std::bind(streamingEnter, std::ref(context), _1, _2),
+									 std::bind(streamingLeave, std::ref(context), _1),
+									 std::bind(streamingData, std::ref(context), _1, _2));
+	importContext.executeFinalizingActions();
+	return context.sceneFound;
+}
+
 }
 }
 }
@@ -19,6 +19,7 @@ class GenericAttributeMap;
 namespace MinSG {
 namespace SceneManagement {
 typedef Util::GenericAttributeMap DescriptionMap;
+class ImportContext;
 namespace ReaderMinSG {
 
 /**
@@ -30,6 +31,23 @@ namespace ReaderMinSG {
  */
 const DescriptionMap * loadScene(std::istream & in);
 
+/**
+ * Import the nodes of a MinSG XML scene from a stream without creating the
+ * description of the whole scene. The description of a node is created while
+ * its element is read and is released as soon as the node has been created.
+ * The child nodes are created before their parent and are added to it
+ * afterwards, so only the descriptions of the currently open elements and of
+ * the prototypes in the definitions are kept. Data blocks of meshes are kept
+ * until they are decoded in parallel, which happens at the latest when they
+ * exceed 64 MiB. The created nodes are added to the root node of the import
+ * context.
+ *
+ * @param importContext Context that is used for the import procedure
+ * @param in Input stream containing the scene data
+ * @return true if a scene has been found
+ */
+bool importScene(ImportContext & importContext, std::istream & in);
+
 }
 }
 }
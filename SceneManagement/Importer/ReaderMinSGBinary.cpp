@@ -0,0 +1,262 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "ReaderMinSGBinary.h"
+#include "../BinarySceneFormat.h"
+#include "../SceneDescription.h"
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/Serialization/Serialization.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/FileUtils.h>
+#include <Util/Macros.h>
+#include <Util/References.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MINSG_READERMINSGBINARY_MMAP
+#endif
+
+namespace MinSG {
+namespace SceneManagement {
+namespace ReaderMinSGBinary {
+
+using namespace BinarySceneFormat;
+
+//! Read-only view of a file; the file is mapped into memory if possible.
+class FileView {
+		const uint8_t * mappedData;
+		std::size_t mappedSize;
+		std::vector<uint8_t> loadedData;
+	public:
+		explicit FileView(const Util::FileName & fileName) : mappedData(nullptr), mappedSize(0) {
+#ifdef MINSG_READERMINSGBINARY_MMAP
+			const int fd = ::open(fileName.getPath().c_str(), O_RDONLY);
+			if(fd >= 0) {
+				struct stat fileStat;
+				if(::fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+					void * address = ::mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+					if(address != MAP_FAILED) {
+						mappedData = static_cast<const uint8_t *>(address);
+						mappedSize = static_cast<std::size_t>(fileStat.st_size);
+						::madvise(address, mappedSize, MADV_SEQUENTIAL);
+					}
+				}
+				::close(fd);
+			}
+			if(mappedData != nullptr)
+				return;
+#endif
+			// files in other file systems (e.g. archives)
+			loadedData = Util::FileUtils::loadFile(fileName);
+		}
+		~FileView() {
+#ifdef MINSG_READERMINSGBINARY_MMAP
+			if(mappedData != nullptr)
+				::munmap(const_cast<uint8_t *>(mappedData), mappedSize);
+#endif
+		}
+		FileView(const FileView &) = delete;
+		FileView & operator=(const FileView &) = delete;
+
+		const uint8_t * data() const	{	return mappedData != nullptr ? mappedData : loadedData.data();	}
+		std::size_t size() const		{	return mappedData != nullptr ? mappedSize : loadedData.size();	}
+};
+
+//! Checked access to the tables of the scene data.
+struct SceneData {
+	const uint8_t * data;
+	std::size_t size;
+	Header header;
+
+	bool contains(uint64_t offset, uint64_t length) const {
+		return offset <= size && length <= size - offset;
+	}
+
+	//! Copy the @p index-th record of the table at @p tableOffset; the table has to be checked before.
+	template<typename T>
+	T getRecord(uint64_t tableOffset, uint32_t index) const {
+		T record;
+		std::memcpy(&record, data + tableOffset + static_cast<uint64_t>(index) * sizeof(T), sizeof(T));
+		return record;
+	}
+
+	bool getString(uint32_t index, std::string & result) const {
+		if(index >= header.stringCount)
+			return false;
+		const uint32_t begin = getRecord<uint32_t>(header.stringTableOffset, index);
+		const uint32_t end = getRecord<uint32_t>(header.stringTableOffset, index + 1);
+		const uint64_t charactersOffset = header.stringTableOffset + (static_cast<uint64_t>(header.stringCount) + 1) * sizeof(uint32_t);
+		if(begin > end || !contains(charactersOffset + begin, end - begin))
+			return false;
+		result.assign(reinterpret_cast<const char *>(data + charactersOffset + begin), end - begin);
+		return true;
+	}
+};
+
+//! Create a mesh from its record; the vertex and index data is copied directly from the scene data.
+static Rendering::Mesh * createMesh(const SceneData & scene, const Mesh & record) {
+	if(!scene.contains(record.layoutOffset, record.layoutSize) ||
+			!scene.contains(record.vertexDataOffset, record.vertexDataSize) ||
+			record.indexCount > scene.size / sizeof(uint32_t) || record.vertexDataSize > scene.size ||
+			!scene.contains(record.indexDataOffset, record.indexCount * sizeof(uint32_t))) {
+		WARN("Invalid mesh record.");
+		return nullptr;
+	}
+	const std::string layout(reinterpret_cast<const char *>(scene.data + record.layoutOffset), record.layoutSize);
+	Util::Reference<Rendering::Mesh> mesh = Rendering::Serialization::loadMesh("mmf", layout);
+	if(mesh.isNull()) {
+		WARN("Invalid vertex description.");
+		return nullptr;
+	}
+
+	const Rendering::VertexDescription vertexDescription = mesh->getVertexDescription();
+	if(record.vertexCount > std::numeric_limits<uint32_t>::max() || record.vertexCount * vertexDescription.getVertexSize() != record.vertexDataSize) {
+		WARN("The size of the vertex data does not match the vertex description.");
+		return nullptr;
+	}
+	Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+	vertexData.allocate(static_cast<uint32_t>(record.vertexCount), vertexDescription);
+	if(record.vertexDataSize > 0) {
+		std::copy(scene.data + record.vertexDataOffset, scene.data + record.vertexDataOffset + record.vertexDataSize, vertexData.data());
+		vertexData.markAsChanged();
+		vertexData.updateBoundingBox();
+	}
+
+	if(record.indexCount > 0) {
+		Rendering::MeshIndexData & indexData = mesh->openIndexData();
+		indexData.allocate(static_cast<uint32_t>(record.indexCount));
+		std::memcpy(indexData.data(), scene.data + record.indexDataOffset, record.indexCount * sizeof(uint32_t));
+		indexData.updateIndexRange();
+		if(indexData.getMaxIndex() >= record.vertexCount) {
+			WARN("An index exceeds the vertex data.");
+			return nullptr;
+		}
+		indexData.markAsChanged();
+	}
+	return mesh.detachAndDecrease();
+}
+
+//! (internal)
+static const DescriptionMap * createDescription(const SceneData & scene) {
+	const Header & header = scene.header;
+	if(header.elementCount == 0 ||
+			!scene.contains(header.stringTableOffset, (static_cast<uint64_t>(header.stringCount) + 1) * sizeof(uint32_t)) ||
+			!scene.contains(header.elementTableOffset, static_cast<uint64_t>(header.elementCount) * sizeof(Element)) ||
+			!scene.contains(header.attributeTableOffset, static_cast<uint64_t>(header.attributeCount) * sizeof(Attribute)) ||
+			!scene.contains(header.meshTableOffset, static_cast<uint64_t>(header.meshCount) * sizeof(Mesh))) {
+		WARN("Invalid binary scene: The tables exceed the data.");
+		return nullptr;
+	}
+
+	std::vector<Util::Reference<Rendering::Mesh>> meshes(header.meshCount);
+	std::vector<DescriptionMap *> elements;
+	elements.reserve(header.elementCount);
+	std::unique_ptr<DescriptionMap> sceneDescription;
+	std::string type, key, value;
+
+	for(uint32_t i = 0; i < header.elementCount; ++i) {
+		const auto element = scene.getRecord<Element>(header.elementTableOffset, i);
+		if(!scene.getString(element.type, type) ||
+				(i == 0) != (element.parent == NO_PARENT) || (i > 0 && element.parent >= i) ||
+				element.firstAttribute > header.attributeCount || element.attributeCount > header.attributeCount - element.firstAttribute) {
+			WARN("Invalid binary scene: Invalid element.");
+			return nullptr;
+		}
+
+		auto desc = new DescriptionMap;
+		desc->setString(Consts::TYPE, type);
+		if(i == 0) {
+			sceneDescription.reset(desc);
+		} else {
+			DescriptionMap * parent = elements[element.parent];
+			if(type == "defs") {
+				parent->setValue(Consts::DEFINITIONS, desc);
+			} else {
+				auto * children = dynamic_cast<DescriptionArray *>(parent->getValue(Consts::CHILDREN));
+				if(!children) {
+					children = new DescriptionArray;
+					parent->setValue(Consts::CHILDREN, children);
+				}
+				children->push_back(desc);
+			}
+		}
+		elements.push_back(desc);
+
+		for(uint32_t a = element.firstAttribute; a < element.firstAttribute + element.attributeCount; ++a) {
+			const auto attribute = scene.getRecord<Attribute>(header.attributeTableOffset, a);
+			if(!scene.getString(attribute.key, key)) {
+				WARN("Invalid binary scene: Invalid attribute.");
+				return nullptr;
+			}
+			if(attribute.valueType == VALUE_STRING) {
+				if(!scene.getString(attribute.value, value)) {
+					WARN("Invalid binary scene: Invalid attribute.");
+					return nullptr;
+				}
+				desc->setString(key, value);
+			} else if(attribute.valueType == VALUE_MESH && attribute.value < header.meshCount) {
+				Util::Reference<Rendering::Mesh> & mesh = meshes[attribute.value];
+				if(mesh.isNull()) {
+					mesh = createMesh(scene, scene.getRecord<Mesh>(header.meshTableOffset, attribute.value));
+					if(mesh.isNull())
+						return nullptr;
+				}
+				desc->setValue(key, new Rendering::Serialization::MeshWrapper_t(mesh.get()));
+			} else {
+				WARN("Invalid binary scene: Unknown value type.");
+				return nullptr;
+			}
+		}
+	}
+	return sceneDescription.release();
+}
+
+bool isBinaryScene(const uint8_t * data, std::size_t size) {
+	return size >= sizeof(MAGIC) && std::equal(MAGIC, MAGIC + sizeof(MAGIC), reinterpret_cast<const char *>(data));
+}
+
+const DescriptionMap * loadScene(const uint8_t * data, std::size_t size) {
+	if(!isBinaryScene(data, size) || size < sizeof(Header)) {
+		WARN("Invalid binary scene: Unknown format.");
+		return nullptr;
+	}
+	SceneData scene;
+	scene.data = data;
+	scene.size = size;
+	std::memcpy(&scene.header, data, sizeof(Header));
+	if(scene.header.version != VERSION) {
+		WARN("Invalid binary scene: Unsupported version.");
+		return nullptr;
+	}
+	return createDescription(scene);
+}
+
+const DescriptionMap * loadScene(const Util::FileName & fileName) {
+	const FileView file(fileName);
+	if(file.size() == 0) {
+		WARN(std::string("Could not load file: ") + fileName.toString());
+		return nullptr;
+	}
+	return loadScene(file.data(), file.size());
+}
+
+}
+}
+}
@@ -0,0 +1,52 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_SCENEMANAGEMENT_READERMINSGBINARY_H
+#define MINSG_SCENEMANAGEMENT_READERMINSGBINARY_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Util {
+class FileName;
+class GenericAttributeMap;
+}
+namespace MinSG {
+namespace SceneManagement {
+typedef Util::GenericAttributeMap DescriptionMap;
+namespace ReaderMinSGBinary {
+
+/**
+ * Load the description of a scene from binary MinSG scene data
+ * (\see BinarySceneFormat). The meshes are created directly from the vertex and
+ * index data and are stored as Rendering::Serialization::MeshWrapper_t.
+ *
+ * @param data Binary scene data
+ * @param size Size of the data in bytes
+ * @return Description of the loaded scene, or nullptr if the data is invalid
+ */
+const DescriptionMap * loadScene(const uint8_t * data, std::size_t size);
+
+/**
+ * Load the description of a scene from a binary MinSG scene file. Files in the
+ * local file system are mapped into memory, so that the vertex and index data is
+ * copied only once into the meshes; other files are read into memory first.
+ *
+ * @param fileName Path to a binary MinSG scene file
+ * @return Description of the loaded scene, or nullptr on failure
+ */
+const DescriptionMap * loadScene(const Util::FileName & fileName);
+
+//! Return true if the data begins with the magic number of binary MinSG scenes.
+bool isBinaryScene(const uint8_t * data, std::size_t size);
+
+}
+}
+}
+
+#endif /* MINSG_SCENEMANAGEMENT_READERMINSGBINARY_H */
@@ -0,0 +1,552 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "MeshEncoding.h"
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexAttributeIds.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/Serialization/Serialization.h>
+#include <Util/References.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace MinSG {
+namespace SceneManagement {
+namespace MeshEncoding {
+
+static const char MAGIC[4] = {'M', 'S', 'G', 'C'};
+static const uint8_t VERSION = 1;
+
+//! Encoding of a vertex attribute
+enum attributeEncoding_t : uint8_t {
+	ENCODING_RAW = 0,
+	ENCODING_QUANTIZED_POSITION = 1,
+	ENCODING_OCTAHEDRAL_NORMAL = 2,
+	ENCODING_UNORM8_COLOR = 3
+};
+
+// ----------- byte streams
+
+//! (internal) Appends values to a byte array.
+struct Writer {
+	std::vector<uint8_t> & data;
+	explicit Writer(std::vector<uint8_t> & _data) : data(_data) {}
+
+	template<typename value_t>
+	void write(const value_t & value) {
+		const std::size_t offset = data.size();
+		data.resize(offset + sizeof(value_t));
+		std::memcpy(data.data() + offset, &value, sizeof(value_t));
+	}
+	void writeBytes(const uint8_t * bytes, std::size_t size) {
+		data.insert(data.end(), bytes, bytes + size);
+	}
+	void writeVarInt(uint64_t value) {
+		while(value >= 0x80) {
+			data.push_back(static_cast<uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+		data.push_back(static_cast<uint8_t>(value));
+	}
+};
+
+//! (internal) Reads values from a byte array; all functions return false if the end is reached.
+struct Reader {
+	const uint8_t * position;
+	const uint8_t * end;
+	Reader(const uint8_t * data, std::size_t size) : position(data), end(data + size) {}
+
+	template<typename value_t>
+	bool read(value_t & value) {
+		if(static_cast<std::size_t>(end - position) < sizeof(value_t))
+			return false;
+		std::memcpy(&value, position, sizeof(value_t));
+		position += sizeof(value_t);
+		return true;
+	}
+	bool readBytes(std::size_t size, const uint8_t * & bytes) {
+		if(static_cast<std::size_t>(end - position) < size)
+			return false;
+		bytes = position;
+		position += size;
+		return true;
+	}
+	bool readVarInt(uint64_t & value) {
+		value = 0;
+		for(uint32_t shift = 0; shift < 64; shift += 7) {
+			if(position == end)
+				return false;
+			const uint8_t byte = *position++;
+			value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+			if((byte & 0x80) == 0)
+				return true;
+		}
+		return false;
+	}
+};
+
+static inline uint64_t zigZag(int64_t value) {
+	return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+static inline int64_t unZigZag(uint64_t value) {
+	return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+// ----------- general-purpose compression
+
+static const std::size_t MIN_MATCH = 4;
+static const std::size_t MAX_OFFSET = 0xffff;
+//! Upper bound of the ratio of decompressed to compressed size: a sequence of n bytes produces less than 255 * n bytes.
+static const std::size_t MAX_EXPANSION = 255;
+static const uint32_t HASH_BITS = 16;
+
+static inline uint32_t read32(const uint8_t * data) {
+	uint32_t value;
+	std::memcpy(&value, data, sizeof(uint32_t));
+	return value;
+}
+
+static inline uint32_t hash32(uint32_t value) {
+	return (value * 2654435761u) >> (32 - HASH_BITS);
+}
+
+static void writeLength(std::vector<uint8_t> & out, std::size_t length) {
+	while(length >= 255) {
+		out.push_back(255);
+		length -= 255;
+	}
+	out.push_back(static_cast<uint8_t>(length));
+}
+
+//! (internal) Append a sequence of literals followed by a match; a match length of zero ends the data.
+static void writeSequence(std::vector<uint8_t> & out, const uint8_t * literals, std::size_t literalCount, std::size_t offset, std::size_t matchLength) {
+	const std::size_t matchCode = matchLength == 0 ? 0 : matchLength - MIN_MATCH;
+	out.push_back(static_cast<uint8_t>((std::min<std::size_t>(literalCount, 15) << 4) | std::min<std::size_t>(matchCode, 15)));
+	if(literalCount >= 15)
+		writeLength(out, literalCount - 15);
+	out.insert(out.end(), literals, literals + literalCount);
+	if(matchLength == 0)
+		return;
+	out.push_back(static_cast<uint8_t>(offset & 0xff));
+	out.push_back(static_cast<uint8_t>(offset >> 8));
+	if(matchCode >= 15)
+		writeLength(out, matchCode - 15);
+}
+
+std::vector<uint8_t> compress(const uint8_t * data, std::size_t size) {
+	std::vector<uint8_t> out;
+	out.reserve(size / 2 + 16);
+	std::vector<uint32_t> table(static_cast<std::size_t>(1) << HASH_BITS, 0); // position + 1
+	std::size_t anchor = 0;
+	std::size_t position = 0;
+	while(size >= MIN_MATCH && position <= size - MIN_MATCH) {
+		const uint32_t value = read32(data + position);
+		uint32_t & entry = table[hash32(value)];
+		const std::size_t candidate = entry;
+		entry = static_cast<uint32_t>(position + 1);
+		if(candidate == 0 || position + 1 - candidate > MAX_OFFSET || read32(data + candidate - 1) != value) {
+			// skip faster through incompressible data
+			position += 1 + ((position - anchor) >> 6);
+			continue;
+		}
+		const std::size_t matchBegin = candidate - 1;
+		std::size_t matchLength = MIN_MATCH;
+		while(position + matchLength < size && data[matchBegin + matchLength] == data[position + matchLength])
+			++matchLength;
+		writeSequence(out, data + anchor, position - anchor, position - matchBegin, matchLength);
+		position += matchLength;
+		anchor = position;
+	}
+	writeSequence(out, data + anchor, size - anchor, 0, 0);
+	return out;
+}
+
+static bool readLength(Reader & reader, std::size_t & length) {
+	uint8_t byte;
+	do {
+		if(!reader.read(byte))
+			return false;
+		length += byte;
+	} while(byte == 255);
+	return true;
+}
+
+bool decompress(const uint8_t * data, std::size_t size, std::size_t uncompressedSize, std::vector<uint8_t> & result) {
+	// do not allocate memory for a size that cannot be produced by the data
+	if(uncompressedSize / MAX_EXPANSION > size)
+		return false;
+	result.resize(uncompressedSize);
+	uint8_t * out = result.data();
+	std::size_t written = 0;
+	Reader reader(data, size);
+	while(true) {
+		uint8_t token;
+		if(!reader.read(token))
+			return false;
+		std::size_t literalCount = token >> 4;
+		if(literalCount == 15 && !readLength(reader, literalCount))
+			return false;
+		const uint8_t * literals;
+		if(literalCount > uncompressedSize - written || !reader.readBytes(literalCount, literals))
+			return false;
+		if(literalCount > 0)
+			std::memcpy(out + written, literals, literalCount);
+		written += literalCount;
+		if(reader.position == reader.end)
+			return written == uncompressedSize;
+
+		uint8_t offsetLow, offsetHigh;
+		if(!reader.read(offsetLow) || !reader.read(offsetHigh))
+			return false;
+		const std::size_t offset = offsetLow | (static_cast<std::size_t>(offsetHigh) << 8);
+		std::size_t matchLength = token & 0x0f;
+		if(matchLength == 15 && !readLength(reader, matchLength))
+			return false;
+		matchLength += MIN_MATCH;
+		if(offset == 0 || offset > written || matchLength > uncompressedSize - written)
+			return false;
+		const uint8_t * match = out + written - offset;
+		if(offset >= matchLength) {
+			std::memcpy(out + written, match, matchLength);
+		} else { // the match overlaps the copied bytes
+			for(std::size_t i = 0; i < matchLength; ++i)
+				out[written + i] = match[i];
+		}
+		written += matchLength;
+	}
+}
+
+// ----------- vertex attributes
+
+//! (internal) Store the bytes of an attribute in planes.
+static void writeRawAttribute(Writer & writer, const uint8_t * vertices, uint32_t vertexCount, std::size_t vertexSize, std::size_t offset, std::size_t attributeSize) {
+	const std::size_t begin = writer.data.size();
+	writer.data.resize(begin + attributeSize * vertexCount);
+	uint8_t * planes = writer.data.data() + begin;
+	for(uint32_t v = 0; v < vertexCount; ++v) {
+		const uint8_t * vertex = vertices + v * vertexSize + offset;
+		for(std::size_t b = 0; b < attributeSize; ++b)
+			planes[b * vertexCount + v] = vertex[b];
+	}
+}
+
+static bool readRawAttribute(Reader & reader, uint8_t * vertices, uint32_t vertexCount, std::size_t vertexSize, std::size_t offset, std::size_t attributeSize) {
+	const uint8_t * planes;
+	if(!reader.readBytes(attributeSize * vertexCount, planes))
+		return false;
+	for(uint32_t v = 0; v < vertexCount; ++v) {
+		uint8_t * vertex = vertices + v * vertexSize + offset;
+		for(std::size_t b = 0; b < attributeSize; ++b)
+			vertex[b] = planes[b * vertexCount + v];
+	}
+	return true;
+}
+
+static inline float getFloat(const uint8_t * vertices, std::size_t index, std::size_t vertexSize, std::size_t offset, std::size_t component) {
+	float value;
+	std::memcpy(&value, vertices + index * vertexSize + offset + component * sizeof(float), sizeof(float));
+	return value;
+}
+
+static inline void setFloat(uint8_t * vertices, std::size_t index, std::size_t vertexSize, std::size_t offset, std::size_t component, float value) {
+	std::memcpy(vertices + index * vertexSize + offset + component * sizeof(float), &value, sizeof(float));
+}
+
+//! (internal) Store the components relative to their range with @p bits bits as deltas to the previous vertex.
+static bool writeQuantizedPositions(Writer & writer, const uint8_t * vertices, uint32_t vertexCount, std::size_t vertexSize,
+									std::size_t offset, uint32_t numValues, uint32_t bits) {
+	std::vector<float> minValues(numValues, std::numeric_limits<float>::max());
+	std::vector<float> maxValues(numValues, std::numeric_limits<float>::lowest());
+	for(uint32_t v = 0; v < vertexCount; ++v) {
+		for(uint32_t c = 0; c < numValues; ++c) {
+			const float value = getFloat(vertices, v, vertexSize, offset, c);
+			if(!std::isfinite(value))
+				return false;
+			minValues[c] = std::min(minValues[c], value);
+			maxValues[c] = std::max(maxValues[c], value);
+		}
+	}
+	const uint32_t maxQuantized = (1u << bits) - 1;
+	writer.write(static_cast<uint8_t>(ENCODING_QUANTIZED_POSITION));
+	writer.write(static_cast<uint8_t>(bits));
+	std::vector<double> scales(numValues);
+	for(uint32_t c = 0; c < numValues; ++c) {
+		const float step = vertexCount == 0 ? 0.0f : static_cast<float>((static_cast<double>(maxValues[c]) - minValues[c]) / maxQuantized);
+		writer.write(vertexCount == 0 ? 0.0f : minValues[c]);
+		writer.write(step);
+		scales[c] = step > 0.0f ? 1.0 / step : 0.0;
+	}
+	for(uint32_t c = 0; c < numValues; ++c) {
+		int64_t previous = 0;
+		for(uint32_t v = 0; v < vertexCount; ++v) {
+			const double relative = (static_cast<double>(getFloat(vertices, v, vertexSize, offset, c)) - minValues[c]) * scales[c];
+			const int64_t quantized = std::min<int64_t>(static_cast<int64_t>(relative + 0.5), maxQuantized);
+			writer.writeVarInt(zigZag(quantized - previous));
+			previous = quantized;
+		}
+	}
+	return true;
+}
+
+static bool readQuantizedPositions(Reader & reader, uint8_t * vertices, uint32_t vertexCount, std::size_t vertexSize, std::size_t offset, uint32_t numValues) {
+	uint8_t bits;
+	if(!reader.read(bits) || bits == 0 || bits > 24)
+		return false;
+	std::vector<float> minValues(numValues);
+	std::vector<float> steps(numValues);
+	for(uint32_t c = 0; c < numValues; ++c) {
+		if(!reader.read(minValues[c]) || !reader.read(steps[c]))
+			return false;
+	}
+	const int64_t maxQuantized = (static_cast<int64_t>(1) << bits) - 1;
+	for(uint32_t c = 0; c < numValues; ++c) {
+		int64_t quantized = 0;
+		for(uint32_t v = 0; v < vertexCount; ++v) {
+			uint64_t delta;
+			if(!reader.readVarInt(delta))
+				return false;
+			quantized += unZigZag(delta);
+			if(quantized < 0 || quantized > maxQuantized)
+				return false;
+			setFloat(vertices, v, vertexSize, offset, c, minValues[c] + static_cast<float>(quantized) * steps[c]);
+		}
+	}
+	return true;
+}
+
+static inline float signNotZero(float value) {
+	return value < 0.0f ? -1.0f : 1.0f;
+}
+
+static inline int16_t toSnorm16(float value) {
+	return static_cast<int16_t>(std::lround(std::max(-1.0f, std::min(1.0f, value)) * 32767.0f));
+}
+
+//! (internal) Store unit normals as octahedral coordinates; fails for normals that are not normalized.
+static bool writeOctahedralNormals(Writer & writer, const uint8_t * vertices, uint32_t vertexCount, std::size_t vertexSize, std::size_t offset) {
+	std::vector<int16_t> encoded(2 * static_cast<std::size_t>(vertexCount));
+	for(uint32_t v = 0; v < vertexCount; ++v) {
+		const float x = getFloat(vertices, v, vertexSize, offset, 0);
+		const float y = getFloat(vertices, v, vertexSize, offset, 1);
+		const float z = getFloat(vertices, v, vertexSize, offset, 2);
+		const float length = std::sqrt(x * x + y * y + z * z);
+		if(!std::isfinite(length) || std::abs(length - 1.0f) > 1.0e-3f)
+			return false;
+		const float l1 = std::abs(x) + std::abs(y) + std::abs(z);
+		float u = x / l1;
+		float w = y / l1;
+		if(z < 0.0f) {
+			const float foldedU = (1.0f - std::abs(w)) * signNotZero(u);
+			w = (1.0f - std::abs(u)) * signNotZero(w);
+			u = foldedU;
+		}
+		encoded[2 * v] = toSnorm16(u);
+		encoded[2 * v + 1] = toSnorm16(w);
+	}
+	writer.write(static_cast<uint8_t>(ENCODING_OCTAHEDRAL_NORMAL));
+	writeRawAttribute(writer, reinterpret_cast<const uint8_t *>(encoded.data()), vertexCount, 2 * sizeof(int16_t), 0, 2 * sizeof(int16_t));
+	return true;
+}
+
+static bool readOctahedralNormals(Reader & reader, uint8_t * vertices, uint32_t vertexCount, std::size_t vertexSize, std::size_t offset) {
+	std::vector<int16_t> encoded(2 * static_cast<std::size_t>(vertexCount));
+	if(!readRawAttribute(reader, reinterpret_cast<uint8_t *>(encoded.data()), vertexCount, 2 * sizeof(int16_t), 0, 2 * sizeof(int16_t)))
+		return false;
+	for(uint32_t v = 0; v < vertexCount; ++v) {
+		float x = std::max(-1.0f, static_cast<float>(encoded[2 * v]) / 32767.0f);
+		float y = std::max(-1.0f, static_cast<float>(encoded[2 * v + 1]) / 32767.0f);
+		const float z = 1.0f - std::abs(x) - std::abs(y);
+		if(z < 0.0f) {
+			const float unfoldedX = (1.0f - std::abs(y)) * signNotZero(x);
+			y = (1.0f - std::abs(x)) * signNotZero(y);
+			x = unfoldedX;
+		}
+		const float length = std::sqrt(x * x + y * y + z * z);
+		setFloat(vertices, v, vertexSize, offset, 0, x / length);
+		setFloat(vertices, v, vertexSize, offset, 1, y / length);
+		setFloat(vertices, v, vertexSize, offset, 2, z / length);
+	}
+	return true;
+}
+
+//! (internal) Store colors with eight bits per component; fails for values outside of [0,1].
+static bool writeColors(Writer & writer, const uint8_t * vertices, uint32_t vertexCount, std::size_t vertexSize, std::size_t offset, uint32_t numValues) {
+	std::vector<uint8_t> encoded(static_cast<std::size_t>(vertexCount) * numValues);
+	for(uint32_t v = 0; v < vertexCount; ++v) {
+		for(uint32_t c = 0; c < numValues; ++c) {
+			const float value = getFloat(vertices, v, vertexSize, offset, c);
+			if(!(value >= 0.0f && value <= 1.0f))
+				return false;
+			encoded[v * numValues + c] = static_cast<uint8_t>(std::lround(value * 255.0f));
+		}
+	}
+	writer.write(static_cast<uint8_t>(ENCODING_UNORM8_COLOR));
+	writeRawAttribute(writer, encoded.data(), vertexCount, numValues, 0, numValues);
+	return true;
+}
+
+static bool readColors(Reader & reader, uint8_t * vertices, uint32_t vertexCount, std::size_t vertexSize, std::size_t offset, uint32_t numValues) {
+	std::vector<uint8_t> encoded(static_cast<std::size_t>(vertexCount) * numValues);
+	if(!readRawAttribute(reader, encoded.data(), vertexCount, numValues, 0, numValues))
+		return false;
+	for(uint32_t v = 0; v < vertexCount; ++v) {
+		for(uint32_t c = 0; c < numValues; ++c)
+			setFloat(vertices, v, vertexSize, offset, c, static_cast<float>(encoded[v * numValues + c]) / 255.0f);
+	}
+	return true;
+}
+
+// ----------- meshes
+
+std::vector<uint8_t> encodeMesh(Rendering::Mesh * mesh, uint32_t positionBits) {
+	positionBits = std::min<uint32_t>(positionBits, 24);
+	std::vector<uint8_t> payload;
+	Writer writer(payload);
+
+	// vertex description, draw mode and index usage
+	{
+		Util::Reference<Rendering::Mesh> layoutMesh = new Rendering::Mesh(mesh->getVertexDescription(), 0, 0);
+		layoutMesh->setDrawMode(mesh->getDrawMode());
+		layoutMesh->setUseIndexData(mesh->isUsingIndexData());
+		std::ostringstream layoutStream;
+		if(!Rendering::Serialization::saveMesh(layoutMesh.get(), "mmf", layoutStream))
+			return std::vector<uint8_t>();
+		const std::string layout = layoutStream.str();
+		writer.write(static_cast<uint32_t>(layout.size()));
+		writer.writeBytes(reinterpret_cast<const uint8_t *>(layout.data()), layout.size());
+	}
+
+	const Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+	const Rendering::VertexDescription & vertexDescription = mesh->getVertexDescription();
+	const uint32_t vertexCount = vertexData.getVertexCount();
+	const std::size_t vertexSize = vertexDescription.getVertexSize();
+	const uint32_t indexCount = mesh->isUsingIndexData() ? mesh->openIndexData().getIndexCount() : 0;
+	writer.write(vertexCount);
+	writer.write(indexCount);
+
+	for(const auto & attribute : vertexDescription.getAttributes()) {
+		const uint32_t numValues = attribute.getNumValues();
+		const bool isFloat = attribute.getDataSize() == numValues * sizeof(float);
+		const std::size_t encodedBegin = payload.size();
+		if(positionBits > 0 && isFloat) {
+			bool encoded = false;
+			if(attribute.getNameId() == Rendering::VertexAttributeIds::POSITION)
+				encoded = writeQuantizedPositions(writer, vertexData.data(), vertexCount, vertexSize, attribute.getOffset(), numValues, positionBits);
+			else if(attribute.getNameId() == Rendering::VertexAttributeIds::NORMAL && numValues == 3)
+				encoded = writeOctahedralNormals(writer, vertexData.data(), vertexCount, vertexSize, attribute.getOffset());
+			else if(attribute.getNameId() == Rendering::VertexAttributeIds::COLOR)
+				encoded = writeColors(writer, vertexData.data(), vertexCount, vertexSize, attribute.getOffset(), numValues);
+			if(encoded)
+				continue;
+			payload.resize(encodedBegin);
+		}
+		writer.write(static_cast<uint8_t>(ENCODING_RAW));
+		writeRawAttribute(writer, vertexData.data(), vertexCount, vertexSize, attribute.getOffset(), attribute.getDataSize());
+	}
+
+	if(indexCount > 0) {
+		const uint32_t * indices = mesh->openIndexData().data();
+		int64_t previous = 0;
+		for(uint32_t i = 0; i < indexCount; ++i) {
+			writer.writeVarInt(zigZag(static_cast<int64_t>(indices[i]) - previous));
+			previous = indices[i];
+		}
+	}
+
+	std::vector<uint8_t> result(MAGIC, MAGIC + sizeof(MAGIC));
+	Writer resultWriter(result);
+	resultWriter.write(VERSION);
+	resultWriter.write(static_cast<uint32_t>(payload.size()));
+	const std::vector<uint8_t> compressedPayload = compress(payload.data(), payload.size());
+	resultWriter.writeBytes(compressedPayload.data(), compressedPayload.size());
+	return result;
+}
+
+Rendering::Mesh * decodeMesh(const uint8_t * data, std::size_t size) {
+	Reader header(data, size);
+	const uint8_t * magic;
+	uint8_t version;
+	uint32_t payloadSize;
+	if(!header.readBytes(sizeof(MAGIC), magic) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+			!header.read(version) || version != VERSION || !header.read(payloadSize))
+		return nullptr;
+	std::vector<uint8_t> payload;
+	if(!decompress(header.position, static_cast<std::size_t>(header.end - header.position), payloadSize, payload))
+		return nullptr;
+
+	Reader reader(payload.data(), payload.size());
+	uint32_t layoutSize;
+	const uint8_t * layout;
+	if(!reader.read(layoutSize) || !reader.readBytes(layoutSize, layout))
+		return nullptr;
+	Util::Reference<Rendering::Mesh> mesh = Rendering::Serialization::loadMesh("mmf", std::string(reinterpret_cast<const char *>(layout), layoutSize));
+	uint32_t vertexCount, indexCount;
+	if(mesh.isNull() || !reader.read(vertexCount) || !reader.read(indexCount))
+		return nullptr;
+
+	const Rendering::VertexDescription vertexDescription = mesh->getVertexDescription();
+	const std::size_t vertexSize = vertexDescription.getVertexSize();
+	// every vertex needs at least one byte per attribute
+	if(vertexCount > payload.size())
+		return nullptr;
+	Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+	vertexData.allocate(vertexCount, vertexDescription);
+	for(const auto & attribute : vertexDescription.getAttributes()) {
+		const uint32_t numValues = attribute.getNumValues();
+		const bool isFloat = attribute.getDataSize() == numValues * sizeof(float);
+		uint8_t encoding;
+		if(!reader.read(encoding))
+			return nullptr;
+		bool success = false;
+		if(encoding == ENCODING_RAW)
+			success = readRawAttribute(reader, vertexData.data(), vertexCount, vertexSize, attribute.getOffset(), attribute.getDataSize());
+		else if(encoding == ENCODING_QUANTIZED_POSITION && isFloat)
+			success = readQuantizedPositions(reader, vertexData.data(), vertexCount, vertexSize, attribute.getOffset(), numValues);
+		else if(encoding == ENCODING_OCTAHEDRAL_NORMAL && isFloat && numValues == 3)
+			success = readOctahedralNormals(reader, vertexData.data(), vertexCount, vertexSize, attribute.getOffset());
+		else if(encoding == ENCODING_UNORM8_COLOR && isFloat)
+			success = readColors(reader, vertexData.data(), vertexCount, vertexSize, attribute.getOffset(), numValues);
+		if(!success)
+			return nullptr;
+	}
+	vertexData.markAsChanged();
+	vertexData.updateBoundingBox();
+
+	if(indexCount > 0) {
+		// every index needs at least one byte
+		if(indexCount > static_cast<std::size_t>(reader.end - reader.position))
+			return nullptr;
+		Rendering::MeshIndexData & indexData = mesh->openIndexData();
+		indexData.allocate(indexCount);
+		uint32_t * indices = indexData.data();
+		int64_t index = 0;
+		for(uint32_t i = 0; i < indexCount; ++i) {
+			uint64_t delta;
+			if(!reader.readVarInt(delta))
+				return nullptr;
+			index += unZigZag(delta);
+			if(index < 0 || index >= static_cast<int64_t>(vertexCount))
+				return nullptr;
+			indices[i] = static_cast<uint32_t>(index);
+		}
+		indexData.updateIndexRange();
+		indexData.markAsChanged();
+	}
+	return mesh.detachAndDecrease();
+}
+
+}
+}
+}
@@ -0,0 +1,74 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_SCENEMANAGEMENT_MESHENCODING_H
+#define MINSG_SCENEMANAGEMENT_MESHENCODING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Rendering {
+class Mesh;
+}
+namespace MinSG {
+namespace SceneManagement {
+
+/**
+ * Compact encoding of meshes for the data blocks of MinSG XML files
+ * (\see EXPORT_OPTION_COMPRESS_MESHES, EXPORT_OPTION_QUANTIZE_MESHES).
+ *
+ * An encoded mesh consists of the magic bytes "MSGC", a version byte, the size
+ * of the payload (uint32_t), and the payload compressed with compress(). The
+ * payload contains the MMF data of an empty mesh with the vertex description,
+ * the draw mode and the index usage of the mesh, followed by the vertex data
+ * and the index data:
+ *  - Each vertex attribute is stored separately. Unless it is quantized, it is
+ *    stored losslessly with its bytes split into planes (all first bytes, all
+ *    second bytes, ...), which makes float data compressible.
+ *  - If quantization is enabled, float positions are stored relative to the
+ *    bounding box of the mesh with a configurable number of bits per component
+ *    (as variable-length deltas to the previous vertex), float normals with
+ *    three components are stored as two 16-bit octahedral coordinates, and
+ *    float colors in the range [0,1] are stored with eight bits per component.
+ *  - Indices are stored as variable-length deltas to the previous index.
+ *
+ * All values are stored in native byte order.
+ */
+namespace MeshEncoding {
+
+/**
+ * Encode a mesh.
+ *
+ * @param mesh The mesh to encode
+ * @param positionBits Number of bits per position component (1 to 24); if zero,
+ *	all vertex attributes are stored losslessly.
+ * @return The encoded mesh
+ */
+std::vector<uint8_t> encodeMesh(Rendering::Mesh * mesh, uint32_t positionBits);
+
+//! Decode a mesh created by encodeMesh(). Return nullptr if the data is invalid.
+Rendering::Mesh * decodeMesh(const uint8_t * data, std::size_t size);
+
+/**
+ * General-purpose compression of a byte array with a fast LZ77 variant: the
+ * data is split into sequences of literals and matches (up to 64 KiB back) that
+ * are found with a hash table of four-byte prefixes.
+ */
+std::vector<uint8_t> compress(const uint8_t * data, std::size_t size);
+
+/*! Decompress data created by compress(). Return false if the data is invalid or
+	the decompressed data does not have the expected size; an expected size that exceeds
+	the maximum expansion of the data is rejected before any memory is allocated.	*/
+bool decompress(const uint8_t * data, std::size_t size, std::size_t uncompressedSize, std::vector<uint8_t> & result);
+
+}
+}
+}
+
+#endif /* MINSG_SCENEMANAGEMENT_MESHENCODING_H */
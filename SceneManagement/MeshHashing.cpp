@@ -0,0 +1,90 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "MeshHashing.h"
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <cstddef>
+#include <cstring>
+
+namespace MinSG {
+namespace SceneManagement {
+namespace MeshHashing {
+
+static const uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+
+static inline uint64_t combine(uint64_t hash, uint64_t value) {
+	hash ^= value * PRIME_2;
+	hash = (hash << 31) | (hash >> 33);
+	return hash * PRIME_1;
+}
+
+uint64_t hashData(uint64_t hash, const uint8_t * data, std::size_t size) {
+	std::size_t i = 0;
+	for(; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+		uint64_t word;
+		std::memcpy(&word, data + i, sizeof(uint64_t));
+		hash = combine(hash, word);
+	}
+	if(i < size) {
+		uint64_t word = 0;
+		std::memcpy(&word, data + i, size - i);
+		hash = combine(hash, word);
+	}
+	return combine(hash, size);
+}
+
+uint64_t calculateHash(Rendering::Mesh * mesh) {
+	uint64_t hash = combine(PRIME_1, static_cast<uint64_t>(mesh->getDrawMode()));
+	hash = combine(hash, mesh->getVertexDescription().getVertexSize());
+
+	const Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+	hash = hashData(hash, vertexData.data(), vertexData.dataSize());
+	if(mesh->isUsingIndexData()) {
+		const Rendering::MeshIndexData & indexData = mesh->openIndexData();
+		hash = hashData(hash, reinterpret_cast<const uint8_t *>(indexData.data()), indexData.getIndexCount() * sizeof(uint32_t));
+	}
+
+	// final avalanche
+	hash ^= hash >> 33;
+	hash *= PRIME_2;
+	hash ^= hash >> 29;
+	hash *= PRIME_1;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+bool equalData(Rendering::Mesh * a, Rendering::Mesh * b) {
+	if(a == b)
+		return true;
+	if(a->getDrawMode() != b->getDrawMode() || a->isUsingIndexData() != b->isUsingIndexData() ||
+			!(a->getVertexDescription() == b->getVertexDescription()))
+		return false;
+
+	const Rendering::MeshVertexData & vertexDataA = a->openVertexData();
+	const Rendering::MeshVertexData & vertexDataB = b->openVertexData();
+	if(vertexDataA.dataSize() != vertexDataB.dataSize() ||
+			(vertexDataA.dataSize() > 0 && std::memcmp(vertexDataA.data(), vertexDataB.data(), vertexDataA.dataSize()) != 0))
+		return false;
+
+	if(a->isUsingIndexData()) {
+		const Rendering::MeshIndexData & indexDataA = a->openIndexData();
+		const Rendering::MeshIndexData & indexDataB = b->openIndexData();
+		if(indexDataA.getIndexCount() != indexDataB.getIndexCount() ||
+				(indexDataA.getIndexCount() > 0 && std::memcmp(indexDataA.data(), indexDataB.data(), indexDataA.getIndexCount() * sizeof(uint32_t)) != 0))
+			return false;
+	}
+	return true;
+}
+
+}
+}
+}
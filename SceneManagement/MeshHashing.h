@@ -0,0 +1,49 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_SCENEMANAGEMENT_MESHHASHING_H
+#define MINSG_SCENEMANAGEMENT_MESHHASHING_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Rendering {
+class Mesh;
+}
+namespace MinSG {
+namespace SceneManagement {
+
+/**
+ * Content hashing of meshes, used to share meshes with equal data during the
+ * import (IMPORT_OPTION_USE_MESH_HASHING_REGISTRY) and the export
+ * (EXPORT_OPTION_SHARE_EQUAL_MESHES) of scenes.
+ */
+namespace MeshHashing {
+
+/**
+ * Calculate a 64-bit hash of the vertex data and the index data of a mesh. The
+ * data is processed in words of eight bytes. Meshes with equal hashes are not
+ * necessarily equal; use equalData() to verify a match.
+ */
+uint64_t calculateHash(Rendering::Mesh * mesh);
+
+/**
+ * Continue the hash value @p hash with the given data. Used by calculateHash()
+ * and for the content hashes of scene files in the import cache
+ * (IMPORT_OPTION_USE_IMPORT_CACHE).
+ */
+uint64_t hashData(uint64_t hash, const uint8_t * data, std::size_t size);
+
+//! Return true if both meshes have the same vertex description, draw mode, vertex data and index data.
+bool equalData(Rendering::Mesh * a, Rendering::Mesh * b);
+
+}
+}
+}
+
+#endif /* MINSG_SCENEMANAGEMENT_MESHHASHING_H */
@@ -0,0 +1,286 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "MeshOptimization.h"
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexAttributeIds.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/MeshUtils/MeshUtils.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace MinSG {
+namespace SceneManagement {
+namespace MeshOptimization {
+
+static const uint32_t INVALID_VERTEX = std::numeric_limits<uint32_t>::max();
+
+//! Return true if the mesh consists of valid indexed triangles.
+static bool isIndexedTriangleMesh(Rendering::Mesh * mesh) {
+	if(mesh == nullptr || mesh->getDrawMode() != Rendering::Mesh::DRAW_TRIANGLES || !mesh->isUsingIndexData())
+		return false;
+	const Rendering::MeshIndexData & indexData = mesh->openIndexData();
+	const uint32_t indexCount = indexData.getIndexCount();
+	if(indexCount == 0 || indexCount % 3 != 0)
+		return false;
+	const uint32_t vertexCount = mesh->openVertexData().getVertexCount();
+	return *std::max_element(indexData.data(), indexData.data() + indexCount) < vertexCount;
+}
+
+//! Simulate a FIFO vertex cache and return the number of cache misses.
+static std::size_t countCacheMisses(const uint32_t * indices, std::size_t indexCount, uint32_t vertexCount, uint32_t cacheSize) {
+	// a vertex is in the cache if less than cacheSize misses have happened since it has been inserted
+	std::vector<std::size_t> insertionTime(vertexCount, 0);
+	std::size_t misses = 0;
+	for(std::size_t i = 0; i < indexCount; ++i) {
+		std::size_t & time = insertionTime[indices[i]];
+		if(time == 0 || misses - time >= cacheSize) {
+			++misses;
+			time = misses;
+		}
+	}
+	return misses;
+}
+
+float calculateACMR(Rendering::Mesh * mesh, uint32_t cacheSize/*=DEFAULT_CACHE_SIZE*/) {
+	if(!isIndexedTriangleMesh(mesh))
+		return 0.0f;
+	const Rendering::MeshIndexData & indexData = mesh->openIndexData();
+	const std::size_t misses = countCacheMisses(indexData.data(), indexData.getIndexCount(), mesh->openVertexData().getVertexCount(), cacheSize);
+	return static_cast<float>(misses) / static_cast<float>(indexData.getIndexCount() / 3);
+}
+
+/**
+ * Reorder the triangles with Tipsify. The triangles are appended to @p triangleOrder;
+ * @p clusterBegins receives the position of the first triangle of each cluster.
+ */
+static void tipsify(const uint32_t * indices, uint32_t triangleCount, uint32_t vertexCount, uint32_t cacheSize,
+					std::vector<uint32_t> & triangleOrder, std::vector<uint32_t> & clusterBegins) {
+	// triangles adjacent to each vertex (compressed row storage)
+	std::vector<uint32_t> liveTriangles(vertexCount, 0);
+	for(uint32_t i = 0; i < triangleCount * 3; ++i)
+		++liveTriangles[indices[i]];
+	std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+	for(uint32_t v = 0; v < vertexCount; ++v)
+		adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangles[v];
+	std::vector<uint32_t> adjacency(triangleCount * 3);
+	{
+		std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for(uint32_t i = 0; i < triangleCount * 3; ++i)
+			adjacency[fill[indices[i]]++] = i / 3;
+	}
+
+	std::vector<uint32_t> cacheTime(vertexCount, 0);
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<uint32_t> deadEnds;
+	std::vector<uint32_t> candidates;
+	uint32_t time = cacheSize + 1;
+	uint32_t cursor = 0;
+
+	triangleOrder.reserve(triangleCount);
+	uint32_t fanningVertex = 0;
+	while(liveTriangles[fanningVertex] == 0 && fanningVertex + 1 < vertexCount)
+		++fanningVertex;
+	clusterBegins.push_back(0);
+	while(fanningVertex != INVALID_VERTEX) {
+		candidates.clear();
+		for(uint32_t a = adjacencyOffsets[fanningVertex]; a < adjacencyOffsets[fanningVertex + 1]; ++a) {
+			const uint32_t triangle = adjacency[a];
+			if(emitted[triangle])
+				continue;
+			for(uint32_t c = 0; c < 3; ++c) {
+				const uint32_t v = indices[triangle * 3 + c];
+				deadEnds.push_back(v);
+				candidates.push_back(v);
+				--liveTriangles[v];
+				if(time - cacheTime[v] > cacheSize)
+					cacheTime[v] = time++;
+			}
+			emitted[triangle] = true;
+			triangleOrder.push_back(triangle);
+		}
+
+		// prefer the candidate that stays longest in the cache while all of its triangles are emitted
+		uint32_t next = INVALID_VERTEX;
+		int64_t bestPriority = -1;
+		for(const auto & v : candidates) {
+			if(liveTriangles[v] == 0)
+				continue;
+			int64_t priority = 0;
+			if(static_cast<int64_t>(time - cacheTime[v]) + 2 * static_cast<int64_t>(liveTriangles[v]) <= cacheSize)
+				priority = time - cacheTime[v];
+			if(priority > bestPriority) {
+				bestPriority = priority;
+				next = v;
+			}
+		}
+		if(next == INVALID_VERTEX) {
+			// dead end: continue with a recently used vertex or the next vertex with live triangles
+			while(!deadEnds.empty() && next == INVALID_VERTEX) {
+				if(liveTriangles[deadEnds.back()] > 0)
+					next = deadEnds.back();
+				deadEnds.pop_back();
+			}
+			while(next == INVALID_VERTEX && cursor < vertexCount) {
+				if(liveTriangles[cursor] > 0)
+					next = cursor;
+				++cursor;
+			}
+			if(next != INVALID_VERTEX && time - cacheTime[next] > cacheSize && triangleOrder.size() < triangleCount)
+				clusterBegins.push_back(static_cast<uint32_t>(triangleOrder.size()));
+		}
+		fanningVertex = next;
+	}
+}
+
+//! Return the offset of the float position attribute, or false if the mesh has none.
+static bool getPositionOffset(const Rendering::VertexDescription & vertexDescription, std::size_t & offset, uint32_t & numValues) {
+	for(const auto & attribute : vertexDescription.getAttributes()) {
+		if(attribute.getNameId() == Rendering::VertexAttributeIds::POSITION && attribute.getNumValues() >= 2 &&
+				attribute.getDataSize() == attribute.getNumValues() * sizeof(float)) {
+			offset = attribute.getOffset();
+			numValues = std::min<uint32_t>(attribute.getNumValues(), 3);
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Sort the clusters of @p triangleOrder by the orientation of the clusters relative
+ * to the center of the mesh; clusters facing outwards likely occlude the others.
+ */
+static void sortClustersForOverdraw(const uint32_t * indices, const uint8_t * vertices, std::size_t vertexSize, std::size_t positionOffset,
+									uint32_t numPositionValues, std::vector<uint32_t> & triangleOrder, const std::vector<uint32_t> & clusterBegins) {
+	if(clusterBegins.size() < 2)
+		return;
+	const auto getPosition = [&](uint32_t vertex, float position[3]) {
+		position[2] = 0.0f;
+		std::memcpy(position, vertices + vertex * vertexSize + positionOffset, numPositionValues * sizeof(float));
+	};
+
+	struct Cluster {
+		uint32_t begin;
+		uint32_t end;
+		double centroid[3];
+		double normal[3];
+		double area;
+		double sortKey;
+	};
+	std::vector<Cluster> clusters(clusterBegins.size());
+	double meshCentroid[3] = {0.0, 0.0, 0.0};
+	double meshArea = 0.0;
+	for(std::size_t c = 0; c < clusters.size(); ++c) {
+		Cluster & cluster = clusters[c];
+		cluster.begin = clusterBegins[c];
+		cluster.end = c + 1 < clusterBegins.size() ? clusterBegins[c + 1] : static_cast<uint32_t>(triangleOrder.size());
+		std::fill(cluster.centroid, cluster.centroid + 3, 0.0);
+		std::fill(cluster.normal, cluster.normal + 3, 0.0);
+		cluster.area = 0.0;
+		for(uint32_t t = cluster.begin; t < cluster.end; ++t) {
+			float p[3][3];
+			for(uint32_t v = 0; v < 3; ++v)
+				getPosition(indices[triangleOrder[t] * 3 + v], p[v]);
+			const double e1[3] = {p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2]};
+			const double e2[3] = {p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2]};
+			const double n[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+			// the length of the cross product is twice the area; the weight of degenerated triangles is not zero
+			const double area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]) * 0.5 + 1.0e-12;
+			for(uint32_t i = 0; i < 3; ++i) {
+				cluster.centroid[i] += area * (p[0][i] + p[1][i] + p[2][i]) / 3.0;
+				cluster.normal[i] += n[i];
+			}
+			cluster.area += area;
+		}
+		for(uint32_t i = 0; i < 3; ++i) {
+			meshCentroid[i] += cluster.centroid[i];
+			cluster.centroid[i] /= cluster.area;
+		}
+		meshArea += cluster.area;
+	}
+	for(auto & cluster : clusters) {
+		const double normalLength = std::sqrt(cluster.normal[0] * cluster.normal[0] + cluster.normal[1] * cluster.normal[1] + cluster.normal[2] * cluster.normal[2]);
+		cluster.sortKey = 0.0;
+		if(normalLength > 0.0) {
+			for(uint32_t i = 0; i < 3; ++i)
+				cluster.sortKey += (cluster.centroid[i] - meshCentroid[i] / meshArea) * cluster.normal[i] / normalLength;
+		}
+	}
+	std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster & a, const Cluster & b) {
+		return a.sortKey > b.sortKey;
+	});
+
+	std::vector<uint32_t> sortedOrder;
+	sortedOrder.reserve(triangleOrder.size());
+	for(const auto & cluster : clusters)
+		sortedOrder.insert(sortedOrder.end(), triangleOrder.begin() + cluster.begin, triangleOrder.begin() + cluster.end);
+	triangleOrder.swap(sortedOrder);
+}
+
+bool optimizeMesh(Rendering::Mesh * mesh, Result & result, uint32_t cacheSize/*=DEFAULT_CACHE_SIZE*/) {
+	if(!isIndexedTriangleMesh(mesh))
+		return false;
+	result.vertexCountBefore = mesh->openVertexData().getVertexCount();
+	result.acmrBefore = calculateACMR(mesh, cacheSize);
+
+	Rendering::MeshUtils::eliminateDuplicateVertices(mesh);
+
+	Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+	Rendering::MeshIndexData & indexData = mesh->openIndexData();
+	const Rendering::VertexDescription vertexDescription = mesh->getVertexDescription();
+	const std::size_t vertexSize = vertexDescription.getVertexSize();
+	const uint32_t vertexCount = vertexData.getVertexCount();
+	const uint32_t triangleCount = indexData.getIndexCount() / 3;
+	const std::vector<uint32_t> indices(indexData.data(), indexData.data() + indexData.getIndexCount());
+
+	// triangle order
+	std::vector<uint32_t> triangleOrder;
+	std::vector<uint32_t> clusterBegins;
+	tipsify(indices.data(), triangleCount, vertexCount, cacheSize, triangleOrder, clusterBegins);
+	std::size_t positionOffset;
+	uint32_t numPositionValues;
+	if(getPositionOffset(vertexDescription, positionOffset, numPositionValues))
+		sortClustersForOverdraw(indices.data(), vertexData.data(), vertexSize, positionOffset, numPositionValues, triangleOrder, clusterBegins);
+
+	// vertex order
+	std::vector<uint32_t> newIndices(vertexCount, INVALID_VERTEX);
+	uint32_t usedVertexCount = 0;
+	uint32_t * outIndex = indexData.data();
+	for(const auto & triangle : triangleOrder) {
+		for(uint32_t c = 0; c < 3; ++c) {
+			uint32_t & newIndex = newIndices[indices[triangle * 3 + c]];
+			if(newIndex == INVALID_VERTEX)
+				newIndex = usedVertexCount++;
+			*outIndex++ = newIndex;
+		}
+	}
+	indexData.updateIndexRange();
+	indexData.markAsChanged();
+
+	const std::vector<uint8_t> vertices(vertexData.data(), vertexData.data() + vertexCount * vertexSize);
+	vertexData.allocate(usedVertexCount, vertexDescription);
+	for(uint32_t v = 0; v < vertexCount; ++v) {
+		if(newIndices[v] != INVALID_VERTEX)
+			std::memcpy(vertexData.data() + newIndices[v] * vertexSize, vertices.data() + v * vertexSize, vertexSize);
+	}
+	vertexData.markAsChanged();
+	vertexData.updateBoundingBox();
+
+	result.vertexCountAfter = usedVertexCount;
+	result.acmrAfter = calculateACMR(mesh, cacheSize);
+	return true;
+}
+
+}
+}
+}
@@ -0,0 +1,75 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_SCENEMANAGEMENT_MESHOPTIMIZATION_H
+#define MINSG_SCENEMANAGEMENT_MESHOPTIMIZATION_H
+
+#include <cstdint>
+
+namespace Rendering {
+class Mesh;
+}
+namespace MinSG {
+namespace SceneManagement {
+
+/**
+ * Reordering of indexed triangle meshes for rendering throughput, used by the
+ * import option IMPORT_OPTION_OPTIMIZE_MESHES.
+ *
+ * The quality of the triangle order is measured by the average cache miss ratio
+ * (ACMR): the number of vertices that have to be transformed per triangle when
+ * using a post-transform vertex cache with FIFO replacement. It lies between
+ * about 0.5 for an optimal order of a regular grid and 3.0 if no vertex is reused.
+ */
+namespace MeshOptimization {
+
+//! Number of entries of the simulated post-transform vertex cache.
+static const uint32_t DEFAULT_CACHE_SIZE = 16;
+
+//! Effect of optimizeMesh() on one mesh.
+struct Result {
+	uint32_t vertexCountBefore;
+	uint32_t vertexCountAfter;
+	float acmrBefore;
+	float acmrAfter;
+	Result() : vertexCountBefore(0), vertexCountAfter(0), acmrBefore(0.0f), acmrAfter(0.0f) {}
+};
+
+/**
+ * Calculate the average cache miss ratio of the triangles of a mesh.
+ *
+ * @return The ACMR, or zero if the mesh does not consist of indexed triangles
+ */
+float calculateACMR(Rendering::Mesh * mesh, uint32_t cacheSize = DEFAULT_CACHE_SIZE);
+
+/**
+ * Optimize the vertex and index data of an indexed triangle mesh in place:
+ *  -# Vertices with equal data are merged (Rendering::MeshUtils::eliminateDuplicateVertices).
+ *  -# The triangles are reordered for the post-transform vertex cache with the
+ *     Tipsify algorithm (Sander et al.: "Fast Triangle Reordering for Vertex
+ *     Locality and Reduced Overdraw", 2007). Whenever the algorithm has to jump
+ *     to a vertex outside of the cache, a new cluster of triangles begins.
+ *  -# The clusters are sorted to reduce overdraw: clusters on the outside of the
+ *     mesh, facing away from its center, are drawn first.
+ *  -# The vertices are reordered by their first use in the index data, and
+ *     unused vertices are removed.
+ *
+ * The function only accesses the given mesh and may be called concurrently for
+ * different meshes. Meshes that do not consist of indexed triangles are not changed.
+ *
+ * @param mesh The mesh to optimize; its vertex and index data has to be available in main memory
+ * @param result Vertex counts and ACMR before and after the optimization
+ * @return true if the mesh has been optimized
+ */
+bool optimizeMesh(Rendering::Mesh * mesh, Result & result, uint32_t cacheSize = DEFAULT_CACHE_SIZE);
+
+}
+}
+}
+
+#endif /* MINSG_SCENEMANAGEMENT_MESHOPTIMIZATION_H */
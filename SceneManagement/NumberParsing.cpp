@@ -0,0 +1,109 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "NumberParsing.h"
+#include <cstdint>
+#include <cstring>
+#include <locale>
+#include <sstream>
+#include <string>
+
+namespace MinSG {
+namespace SceneManagement {
+namespace NumberParsing {
+
+static inline bool isDigit(char c) {
+	return c >= '0' && c <= '9';
+}
+
+/*! (internal) Convert the number in [@p begin, @p end) with a stream using the classic locale.
+	Used for the rare numbers that cannot be converted exactly by parseFloat().	*/
+static bool convertWithStream(const char * begin, const char * end, float & value) {
+	static thread_local std::istringstream stream;
+	static thread_local bool streamInitialized = false;
+	if(!streamInitialized) {
+		stream.imbue(std::locale::classic());
+		streamInitialized = true;
+	}
+	stream.clear();
+	stream.str(std::string(begin, end));
+	// fails for out of range values
+	return (stream >> value) && stream.peek() == std::char_traits<char>::eof();
+}
+
+/*! Numbers with up to 15 significant digits and small exponents are converted to the nearest double with
+	one division or multiplication. Rounding that double to float gives the nearest float, unless the double
+	lies exactly halfway between two floats; these numbers and all other numbers are converted by a stream.	*/
+const char * parseFloat(const char * cursor, const char * end, float & value) {
+	static const double powersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+										1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+	const char * const begin = cursor;
+	if(cursor == end)
+		return nullptr;
+	const bool negative = (*cursor == '-');
+	if(*cursor == '-' || *cursor == '+')
+		++cursor;
+
+	uint64_t mantissa = 0;
+	int significantDigits = 0;
+	int exponent = 0;
+	bool hasDigits = false;
+	for(; cursor != end && isDigit(*cursor); ++cursor) {
+		hasDigits = true;
+		mantissa = mantissa * 10 + static_cast<uint64_t>(*cursor - '0');
+		if(mantissa != 0)
+			++significantDigits;
+	}
+	if(cursor != end && *cursor == '.') {
+		for(++cursor; cursor != end && isDigit(*cursor); ++cursor) {
+			hasDigits = true;
+			mantissa = mantissa * 10 + static_cast<uint64_t>(*cursor - '0');
+			if(mantissa != 0)
+				++significantDigits;
+			--exponent;
+		}
+	}
+	if(!hasDigits)
+		return nullptr;
+	if(cursor != end && (*cursor == 'e' || *cursor == 'E')) {
+		const char * exponentCursor = cursor + 1;
+		const bool negativeExponent = (exponentCursor != end && *exponentCursor == '-');
+		if(exponentCursor != end && (*exponentCursor == '-' || *exponentCursor == '+'))
+			++exponentCursor;
+		int explicitExponent = 0;
+		const char * const exponentDigits = exponentCursor;
+		for(; exponentCursor != end && isDigit(*exponentCursor); ++exponentCursor) {
+			if(explicitExponent < 10000)
+				explicitExponent = explicitExponent * 10 + (*exponentCursor - '0');
+		}
+		if(exponentCursor != exponentDigits) {
+			exponent += negativeExponent ? -explicitExponent : explicitExponent;
+			cursor = exponentCursor;
+		}
+	}
+
+	if(significantDigits <= 15 && exponent >= -22 && exponent <= 22) {
+		double result = static_cast<double>(mantissa);
+		result = exponent < 0 ? result / powersOfTen[-exponent] : result * powersOfTen[exponent];
+		// the results are normal floats; a double has 29 more mantissa bits than a float
+		uint64_t bits;
+		std::memcpy(&bits, &result, sizeof(bits));
+		const uint64_t lowBitsMask = (UINT64_C(1) << 29) - 1;
+		if((bits & lowBitsMask) != (UINT64_C(1) << 28)) {
+			value = static_cast<float>(negative ? -result : result);
+			return cursor;
+		}
+	}
+
+	// rare cases (long mantissas, large exponents, halfway values)
+	return convertWithStream(begin, cursor, value) ? cursor : nullptr;
+}
+
+}
+}
+}
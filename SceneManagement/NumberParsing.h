@@ -0,0 +1,36 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_SCENEMANAGEMENT_NUMBERPARSING_H
+#define MINSG_SCENEMANAGEMENT_NUMBERPARSING_H
+
+namespace MinSG {
+namespace SceneManagement {
+
+/**
+ * Conversion of numbers in scene files. The conversion does not depend on the
+ * locale: the decimal point is always '.'.
+ */
+namespace NumberParsing {
+
+/**
+ * Parse the float beginning at @p cursor. The number is not required to end at
+ * @p end; the caller has to check the character behind the number.
+ * Numbers with up to 15 significant digits and small exponents are converted
+ * without allocating memory. The value is the float nearest to the number.
+ *
+ * @return Pointer behind the number, or nullptr if the range does not begin with
+ * a number or if the number is out of the range of float.
+ */
+const char * parseFloat(const char * cursor, const char * end, float & value);
+
+}
+}
+}
+
+#endif /* MINSG_SCENEMANAGEMENT_NUMBERPARSING_H */
@@ -0,0 +1,193 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "SceneChangeTracker.h"
+#include "../Core/Nodes/GeometryNode.h"
+#include "../Core/Nodes/GroupNode.h"
+#include "../Helper/StdNodeVisitors.h"
+#include <algorithm>
+#include <unordered_set>
+
+namespace MinSG {
+namespace SceneManagement {
+
+struct SceneChangeTracker::ChangeLog {
+	GroupNode * root;
+	const uint32_t partDepth;
+	bool allChanged;
+	bool rootChanged;
+	std::unordered_set<Node *> changedSubtrees;
+	std::vector<State *> changedStates;
+	std::vector<Rendering::Mesh *> changedMeshes;
+
+	ChangeLog(GroupNode * _root, uint32_t _partDepth) : root(_root), partDepth(_partDepth), allChanged(true), rootChanged(true) {}
+
+	//! Return the depth of the node below the root node, or -1 if the node is not contained in the scene.
+	int64_t getDepth(Node * node) const {
+		int64_t depth = 0;
+		for(; node != nullptr; node = node->getParent(), ++depth) {
+			if(node == root)
+				return depth;
+		}
+		return -1;
+	}
+
+	void markNode(Node * node) {
+		if(allChanged)
+			return;
+		int64_t depth = getDepth(node);
+		if(depth < 0)
+			return;
+		if(depth < partDepth) {
+			rootChanged = true;
+			return;
+		}
+		for(; depth > partDepth; --depth)
+			node = node->getParent();
+		changedSubtrees.insert(node);
+	}
+};
+
+//! (internal) Call @p func for every node at @p depth below @p node in depth-first order.
+template<typename func_t>
+static void forEachNodeAtDepth(Node * node, uint32_t depth, func_t func) {
+	if(depth == 0) {
+		func(node);
+		return;
+	}
+	for(const auto & child : getChildNodes(node))
+		forEachNodeAtDepth(child, depth - 1, func);
+}
+
+SceneChangeTracker::SceneChangeTracker(GroupNode * rootNode, uint32_t partDepth) :
+		root(rootNode), changeLog(new ChangeLog(rootNode, std::max(partDepth, 1u))) {
+	ChangeLog * log = changeLog.get();
+	transformationObserverId = root->addTransformationObserver([log](Node * node) {
+		log->markNode(node);
+	});
+	nodesAddedObserverId = root->addNodesAddedObserver([log](const std::vector<Node *> & addedNodes) {
+		for(const auto & node : addedNodes)
+			log->markNode(node);
+	});
+	nodesRemovedObserverId = root->addNodesRemovedObserver([log](GroupNode * parent, const std::vector<Node *> & removedNodes) {
+		for(const auto & node : removedNodes)
+			log->changedSubtrees.erase(node);
+		// removed subtrees only change the manifest
+		if(log->getDepth(parent) + 1 != log->partDepth)
+			log->markNode(parent);
+	});
+}
+
+SceneChangeTracker::~SceneChangeTracker() {
+	root->removeTransformationObserver(transformationObserverId);
+	root->removeNodeAddedObserver(nodesAddedObserverId);
+	root->removeNodeRemovedObserver(nodesRemovedObserverId);
+}
+
+GroupNode * SceneChangeTracker::getRoot() const {
+	return root.get();
+}
+
+uint32_t SceneChangeTracker::getPartDepth() const {
+	return changeLog->partDepth;
+}
+
+void SceneChangeTracker::markChanged(Node * node) {
+	changeLog->markNode(node);
+}
+
+void SceneChangeTracker::markChanged(State * state) {
+	if(!changeLog->allChanged)
+		changeLog->changedStates.push_back(state);
+}
+
+void SceneChangeTracker::markChanged(Rendering::Mesh * mesh) {
+	if(!changeLog->allChanged)
+		changeLog->changedMeshes.push_back(mesh);
+}
+
+void SceneChangeTracker::markAllChanged() {
+	clear();
+	changeLog->allChanged = true;
+	changeLog->rootChanged = true;
+}
+
+void SceneChangeTracker::resolvePendingChanges() {
+	ChangeLog & log = *changeLog.get();
+	if(log.changedStates.empty() && log.changedMeshes.empty())
+		return;
+
+	const auto usesChangedData = [&log](Node * node) {
+		if(node->hasStates()) {
+			for(const auto & state : node->getStates()) {
+				if(std::find(log.changedStates.begin(), log.changedStates.end(), state) != log.changedStates.end())
+					return true;
+			}
+		}
+		if(!log.changedMeshes.empty()) {
+			auto geoNode = dynamic_cast<GeometryNode *>(node);
+			if(geoNode != nullptr && std::find(log.changedMeshes.begin(), log.changedMeshes.end(), geoNode->getMesh()) != log.changedMeshes.end())
+				return true;
+		}
+		return false;
+	};
+
+	// the nodes of the root part
+	for(uint32_t depth = 0; depth < log.partDepth && !log.rootChanged; ++depth) {
+		forEachNodeAtDepth(root.get(), depth, [&](Node * node) {
+			if(usesChangedData(node))
+				log.rootChanged = true;
+		});
+	}
+	for(const auto & subtree : collectSubtrees()) {
+		if(log.changedSubtrees.count(subtree) != 0)
+			continue;
+		traverseTopDown(subtree, [&](Node * node) {
+			if(!usesChangedData(node))
+				return NodeVisitor::CONTINUE_TRAVERSAL;
+			log.changedSubtrees.insert(subtree);
+			return NodeVisitor::EXIT_TRAVERSAL;
+		});
+	}
+	log.changedStates.clear();
+	log.changedMeshes.clear();
+}
+
+std::vector<Node *> SceneChangeTracker::collectSubtrees() const {
+	std::vector<Node *> subtrees;
+	forEachNodeAtDepth(root.get(), changeLog->partDepth, [&subtrees](Node * node) {
+		subtrees.push_back(node);
+	});
+	return subtrees;
+}
+
+std::vector<Node *> SceneChangeTracker::collectChangedSubtrees() {
+	resolvePendingChanges();
+	std::vector<Node *> changedSubtrees;
+	for(const auto & subtree : collectSubtrees()) {
+		if(changeLog->allChanged || changeLog->changedSubtrees.count(subtree) != 0)
+			changedSubtrees.push_back(subtree);
+	}
+	return changedSubtrees;
+}
+
+bool SceneChangeTracker::isRootChanged() {
+	resolvePendingChanges();
+	return changeLog->rootChanged;
+}
+
+void SceneChangeTracker::clear() {
+	changeLog->allChanged = false;
+	changeLog->rootChanged = false;
+	changeLog->changedSubtrees.clear();
+	changeLog->changedStates.clear();
+	changeLog->changedMeshes.clear();
+}
+
+}
+}
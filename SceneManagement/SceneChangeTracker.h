@@ -0,0 +1,93 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_SCENEMANAGEMENT_SCENECHANGETRACKER_H
+#define MINSG_SCENEMANAGEMENT_SCENECHANGETRACKER_H
+
+#include "../Core/Nodes/Node.h"
+#include <Util/References.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Rendering {
+class Mesh;
+}
+namespace MinSG {
+class GroupNode;
+class State;
+
+namespace SceneManagement {
+
+/**
+ * Records which subtrees of a scene have changed, so that only those have to be
+ * saved again (\see saveMinSGSplitScene). The unit of change is a node at the part
+ * depth below the root node together with its subtree (with the default depth of
+ * one, the children of the root node). The root node and the nodes above the part
+ * depth form the root part; a change of one of them marks the root as changed.
+ * A larger part depth results in smaller subtrees for scenes with deep hierarchies.
+ *
+ * Transformations and added or removed nodes are recorded by observers registered
+ * at the root node, which are removed by the destructor. Changes that are not
+ * observable (attributes of nodes, states, and meshes) have to be announced by
+ * markChanged(). Changed states and meshes are resolved to the subtrees using them
+ * when the changes are collected, which only compares pointers of the subtrees that
+ * have not been changed otherwise.
+ *
+ * Initially, the whole scene is marked as changed. After loading a scene that
+ * corresponds to the saved files, call clear().
+ * \note If transformation updates are deferred (\see Node::setTransformationUpdatesDeferred),
+ *	transformations are recorded by Node::processPendingTransformations().
+ */
+class SceneChangeTracker {
+	public:
+		//! @param partDepth Depth of the root nodes of the subtrees below the root node (at least one)
+		explicit SceneChangeTracker(GroupNode * root, uint32_t partDepth = 1);
+		~SceneChangeTracker();
+
+		GroupNode * getRoot() const;
+		uint32_t getPartDepth() const;
+
+		/*! Mark the subtree containing the node as changed; marking the root node or a node
+			above the part depth only changes the root part.	*/
+		void markChanged(Node * node);
+		//! Mark all subtrees containing a node (or the root part) that uses the state as changed.
+		void markChanged(State * state);
+		//! Mark all subtrees containing a GeometryNode that uses the mesh as changed.
+		void markChanged(Rendering::Mesh * mesh);
+		//! Mark the root part and all subtrees as changed.
+		void markAllChanged();
+
+		//! Return the root nodes of all subtrees (the nodes at the part depth) in depth-first order.
+		std::vector<Node *> collectSubtrees() const;
+		/*! Return the root nodes of the subtrees that changed since the last call of clear(),
+			in depth-first order.	*/
+		std::vector<Node *> collectChangedSubtrees();
+		/*! Return true if the root node or a node above the part depth (without the
+			subtrees) changed since the last call of clear().	*/
+		bool isRootChanged();
+
+		//! Mark everything as unchanged (e.g. after the scene has been saved).
+		void clear();
+
+	private:
+		struct ChangeLog;
+		Util::Reference<GroupNode> root;
+		std::unique_ptr<ChangeLog> changeLog;
+		Node::observerId_t transformationObserverId;
+		Node::observerId_t nodesAddedObserverId;
+		Node::observerId_t nodesRemovedObserverId;
+
+		//! Resolve the changed states and meshes to the subtrees using them.
+		void resolvePendingChanges();
+};
+
+}
+}
+
+#endif /* MINSG_SCENEMANAGEMENT_SCENECHANGETRACKER_H */
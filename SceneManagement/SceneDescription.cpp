@@ -9,11 +9,52 @@
 	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
 */
 #include "SceneDescription.h"
+#include "NumberParsing.h"
 #include "../Core/NodeAttributeModifier.h"
 #include <Util/AttributeProvider.h>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
 
 namespace MinSG {
 namespace SceneManagement {
+
+std::string FloatValuesAttribute::toString() const {
+	std::ostringstream stream;
+	stream.imbue(std::locale::classic());
+	// enough digits to read the same floats again
+	stream.precision(std::numeric_limits<float>::max_digits10);
+	for(std::size_t i = 0; i < values.size(); ++i) {
+		if(i > 0)
+			stream << ' ';
+		stream << values[i];
+	}
+	return stream.str();
+}
+
+static bool isFloatSeparator(char c) {
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ',';
+}
+
+bool parseFloatValues(const std::string & str, std::vector<float> & values) {
+	values.clear();
+	const char * cursor = str.data();
+	const char * const end = cursor + str.size();
+	while(true) {
+		while(cursor != end && isFloatSeparator(*cursor))
+			++cursor;
+		if(cursor == end)
+			return true;
+		float value;
+		cursor = NumberParsing::parseFloat(cursor, end, value);
+		// fails for out of range values and trailing characters
+		if(cursor == nullptr || (cursor != end && !isFloatSeparator(*cursor)))
+			return false;
+		values.push_back(value);
+	}
+}
+
 namespace Consts {
 
 const Util::StringIdentifier DATA_BLOCK("_DataBlock_");
@@ -97,6 +138,7 @@ const Util::StringIdentifier ATTR_DATA_TYPE("type");
 const Util::StringIdentifier ATTR_DATA_FORMAT("format");
 const Util::StringIdentifier ATTR_DATA_ENCODING("encoding");
 cStr_t DATA_ENCODING_BASE64="base64";
+cStr_t DATA_ENCODING_COMPRESSED_MESH_BASE64="compressedMesh+base64";
 
 const Util::StringIdentifier ATTR_FLAG_CLOSED("closed");
 const Util::StringIdentifier ATTR_RENDERING_LAYERS("layers");
@@ -173,6 +215,8 @@ const Util::StringIdentifier ATTR_TEXTURE_TYPE("textureType");
 const Util::StringIdentifier ATTR_MESH_FILENAME("filename");
 const Util::StringIdentifier ATTR_MESH_BB("bb");
 const Util::StringIdentifier ATTR_MESH_DATA("data");
+const Util::StringIdentifier ATTR_MESH_ID("meshId");
+const Util::StringIdentifier ATTR_REFERENCED_MESH_ID("refMeshId");
 
 const Util::StringIdentifier ATTR_ATTRIBUTE_NAME("name");
 const Util::StringIdentifier ATTR_ATTRIBUTE_VALUE("value");
@@ -14,6 +14,8 @@
 
 #include <Util/GenericAttribute.h>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 namespace Util {
 class AttributeProvider;
@@ -29,6 +31,24 @@ typedef Util::GenericAttributeList DescriptionArray;
 typedef Util::WrapperAttribute<std::vector<float> > floatVecWrapper_t;
 typedef Util::WrapperAttribute<std::vector<uint32_t> > uint32VecWrapper_t;
 
+/*! Numbers of a description value that have been parsed when the description was read (\see ReaderMinSG).
+	The string representation contains the numbers separated by spaces, so that the value can still be
+	accessed with DescriptionMap::getString(...).	*/
+class FloatValuesAttribute : public Util::GenericAttribute {
+		std::vector<float> values;
+	public:
+		explicit FloatValuesAttribute(std::vector<float> _values) : Util::GenericAttribute(), values(std::move(_values)) {}
+		virtual ~FloatValuesAttribute() {}
+
+		FloatValuesAttribute * clone() const override	{	return new FloatValuesAttribute(values);	}
+		std::string toString() const override;
+		const std::vector<float> & getValues() const	{	return values;	}
+};
+
+/*! Parse numbers separated by white spaces or commas.
+	@return false if the string contains something else than numbers.	*/
+bool parseFloatValues(const std::string & str, std::vector<float> & values);
+
 namespace Consts {
 typedef const char * const cStr_t; // string constant
 
@@ -206,6 +226,8 @@ extern const Util::StringIdentifier ATTR_DATA_TYPE;
 extern const Util::StringIdentifier ATTR_DATA_ENCODING;
 extern const Util::StringIdentifier ATTR_DATA_FORMAT;
 extern cStr_t DATA_ENCODING_BASE64;
+//! Base64 encoded mesh data created by MeshEncoding::encodeMesh (\see EXPORT_OPTION_COMPRESS_MESHES)
+extern cStr_t DATA_ENCODING_COMPRESSED_MESH_BASE64;
 
 extern cStr_t DATA_TYPE_SHADER_UNIFORM;
 
@@ -220,6 +242,8 @@ extern const Util::StringIdentifier ATTR_TEXTURE_TYPE;
 extern const Util::StringIdentifier ATTR_MESH_FILENAME;
 extern const Util::StringIdentifier ATTR_MESH_BB;
 extern const Util::StringIdentifier ATTR_MESH_DATA;
+extern const Util::StringIdentifier ATTR_MESH_ID;
+extern const Util::StringIdentifier ATTR_REFERENCED_MESH_ID;
 
 // DATA_TYPE = DATA_TYPE_SHADER_UNIFORM
 extern const Util::StringIdentifier ATTR_SHADER_UNIFORM_NAME;
@@ -82,7 +82,8 @@ class TreeRegistry{
 
 //! [ctor]
 SceneManager::SceneManager() : Util::AttributeProvider(),
-		nodeRegistry(new TreeRegistry<Node>),stateRegistry(new TreeRegistry<State>) {
+		nodeRegistry(new TreeRegistry<Node>),stateRegistry(new TreeRegistry<State>),
+		nodeMemoryPoolsEnabled(false) {
 }
 
 //! [dtor]
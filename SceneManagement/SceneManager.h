@@ -158,6 +158,21 @@ class SceneManager : public Util::AttributeProvider {
 	private:
 		mutable Util::Reference<BehaviourManager> behaviourManager;
 		//@}
+
+	// ---------------------------------------------------------------------------------
+
+		/**
+		 * @name Node memory pools
+		 */
+		//@{
+	private:
+		bool nodeMemoryPoolsEnabled;
+	public:
+		/*!	If enabled, import contexts created for this SceneManager use IMPORT_OPTION_USE_NODE_MEMORY_POOLS,
+			so the imported nodes are allocated from the node memory pools. \see NodeMemoryPool	*/
+		void setNodeMemoryPoolsEnabled(bool b)						{	nodeMemoryPoolsEnabled = b;	}
+		bool areNodeMemoryPoolsEnabled() const						{	return nodeMemoryPoolsEnabled;	}
+		//@}
 };
 }
 }
@@ -0,0 +1,117 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include "SplitSceneFormat.h"
+#include "../Core/NodeAttributeModifier.h"
+#include <Util/IO/FileName.h>
+#include <Util/IO/FileUtils.h>
+#include <Util/StringIdentifier.h>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace MinSG {
+namespace SceneManagement {
+namespace SplitSceneFormat {
+
+//! (internal) Parse a decimal number; throws an exception if the string is no valid number.
+static uint32_t parseNumber(const std::string & str) {
+	if(str.empty() || str.find_first_not_of("0123456789") != std::string::npos)
+		throw std::invalid_argument("Invalid number: " + str);
+	const unsigned long value = std::stoul(str);
+	if(value > UINT32_MAX)
+		throw std::out_of_range("Number too large: " + str);
+	return static_cast<uint32_t>(value);
+}
+
+bool loadManifest(const Util::FileName & fileName, Manifest & manifest) {
+	if(!Util::FileUtils::isFile(fileName))
+		return false;
+	auto in = Util::FileUtils::openForReading(fileName);
+	if(!in)
+		return false;
+
+	std::string line;
+	if(!std::getline(*in, line) || line != std::string(MAGIC) + ' ' + std::to_string(VERSION))
+		return false;
+
+	// the value is the rest of the line, as file names may contain spaces
+	manifest = Manifest();
+	while(std::getline(*in, line)) {
+		if(line.empty())
+			continue;
+		const auto separator = line.find(' ');
+		if(separator == std::string::npos)
+			return false;
+		const std::string key = line.substr(0, separator);
+		const std::string value = line.substr(separator + 1);
+		try {
+			if(key == "next") {
+				manifest.nextFileNumber = parseNumber(value);
+			} else if(key == "depth") {
+				manifest.partDepth = parseNumber(value);
+			} else if(key == "root") {
+				manifest.rootFile = value;
+			} else if(key == "part") {
+				const auto pathEnd = value.find(' ');
+				if(pathEnd == std::string::npos)
+					return false;
+				Part part;
+				for(std::size_t begin = 0; begin <= pathEnd; ) {
+					auto end = value.find('/', begin);
+					if(end == std::string::npos || end > pathEnd)
+						end = pathEnd;
+					part.path.push_back(parseNumber(value.substr(begin, end - begin)));
+					begin = end + 1;
+				}
+				part.file = value.substr(pathEnd + 1);
+				manifest.parts.emplace_back(std::move(part));
+			} else {
+				return false;
+			}
+		} catch(const std::exception &) {
+			// invalid number
+			return false;
+		}
+	}
+	if(manifest.rootFile.empty() || manifest.partDepth == 0)
+		return false;
+	for(const auto & part : manifest.parts) {
+		if(part.path.size() != manifest.partDepth)
+			return false;
+	}
+	return true;
+}
+
+bool saveManifest(const Util::FileName & fileName, const Manifest & manifest) {
+	auto out = Util::FileUtils::openForWriting(fileName);
+	if(!out)
+		return false;
+	*out << MAGIC << ' ' << VERSION << '\n';
+	*out << "next " << manifest.nextFileNumber << '\n';
+	*out << "depth " << manifest.partDepth << '\n';
+	*out << "root " << manifest.rootFile << '\n';
+	for(const auto & part : manifest.parts) {
+		*out << "part ";
+		for(std::size_t i = 0; i < part.path.size(); ++i)
+			*out << (i == 0 ? "" : "/") << part.path[i];
+		*out << ' ' << part.file << '\n';
+	}
+	out->flush();
+	return out->good();
+}
+
+const Util::StringIdentifier & getPartFileAttribute() {
+	static const Util::StringIdentifier attribute(NodeAttributeModifier::create("splitScenePartFile", NodeAttributeModifier::PRIVATE_ATTRIBUTE));
+	return attribute;
+}
+
+}
+}
+}
@@ -0,0 +1,85 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef MINSG_SCENEMANAGEMENT_SPLITSCENEFORMAT_H
+#define MINSG_SCENEMANAGEMENT_SPLITSCENEFORMAT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Util {
+class FileName;
+class StringIdentifier;
+}
+namespace MinSG {
+namespace SceneManagement {
+
+/**
+ * Layout of split MinSG scenes, written by saveMinSGSplitScene() and read by
+ * loadMinSGSplitScene().
+ *
+ * A split scene consists of a manifest file and of the files it references,
+ * which are stored in the directory of the manifest:
+ *  - The root file: a MinSG XML file containing the root node and the nodes above
+ *    the parts (\see SceneChangeTracker::getPartDepth).
+ *  - One part file per node at the part depth: a binary MinSG scene file
+ *    (\see BinarySceneFormat) containing the subtree of the node.
+ *
+ * The manifest is a text file:
+ * @code
+ * MinSGSplitScene 1
+ * next <number of the next file to write>
+ * depth <part depth>
+ * root <name of the root file>
+ * part <path of the first part> <name of its part file>
+ * part <path of the second part> <name of its part file>
+ * ...
+ * @endcode
+ * The path of a part consists of the child indices from the root node to the root
+ * node of the part, separated by '/' (e.g. "3/0" for a part depth of two). The parts are listed in the
+ * order of a depth-first traversal, so that every part is the next child of its parent.
+ *
+ * Files are never overwritten: changed subtrees are written into new part files
+ * and the manifest is replaced afterwards. Files that are no longer referenced
+ * are removed after the manifest has been replaced.
+ */
+namespace SplitSceneFormat {
+
+static const char * const MAGIC = "MinSGSplitScene";
+static const uint32_t VERSION = 1;
+
+struct Part {
+	std::vector<uint32_t> path;
+	std::string file;
+};
+
+struct Manifest {
+	uint32_t nextFileNumber;
+	uint32_t partDepth;
+	std::string rootFile;
+	std::vector<Part> parts;
+
+	Manifest() : nextFileNumber(0), partDepth(1) {}
+};
+
+//! Read a manifest file. Return false if the file does not exist or is invalid.
+bool loadManifest(const Util::FileName & fileName, Manifest & manifest);
+
+//! Write a manifest file. Return false on failure.
+bool saveManifest(const Util::FileName & fileName, const Manifest & manifest);
+
+/*! Private node attribute of the root nodes of the parts containing the name
+	of the part file the subtree was loaded from or saved to.	*/
+const Util::StringIdentifier & getPartFileAttribute();
+
+}
+}
+}
+
+#endif /* MINSG_SCENEMANAGEMENT_SPLITSCENEFORMAT_H */
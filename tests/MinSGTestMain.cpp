@@ -22,15 +22,34 @@
 #include <string>
 
 extern int test_automatic();
+extern int test_binary_scene();
+extern int test_cache_object_heap();
+extern int test_compiled_scene();
+extern int test_compressed_memory();
 extern int test_cost_evaluator(Util::UI::Window *);
+extern int test_extent_allocator();
+extern int test_float_values();
+extern int test_frustum_batch();
+extern int test_import_cache();
 extern int test_large_scene(Util::UI::Window *, Util::UI::EventContext &);
 extern int test_load_scene(Util::UI::Window *, Util::UI::EventContext &);
+extern int test_mesh_encoding();
+extern int test_mesh_optimization();
+extern int test_mesh_sharing();
 extern int test_node_memory();
+extern int test_node_traversal();
 extern int test_OutOfCore();
+extern int test_parallel_culling();
+extern int test_parallel_mesh_decoding();
+extern int test_render_queue();
+extern int test_scene_state_buffer();
 extern int test_simple1(Util::UI::Window *, Util::UI::EventContext &);
 extern int test_spherical_sampling();
+extern int test_split_scene();
 extern int test_spherical_sampling_serialization();
 extern int test_statistics();
+extern int test_streaming_import();
+extern int test_dae_import();
 extern int test_valuated_region_node();
 extern int test_visibility_vector();
 
@@ -82,6 +101,25 @@ int main(int argc, char * argv[]) {
 		std::cout << "12 ... Test ValuatedRegionNode\n";
 		std::cout << "13 ... Test VisibilityVector\n";
 		std::cout << "14 ... Test Statistics\n";
+		std::cout << "15 ... Test RenderQueue\n";
+		std::cout << "16 ... Benchmark parallel frustum culling\n";
+		std::cout << "17 ... Benchmark batch box-frustum classification\n";
+		std::cout << "18 ... Test SceneStateBuffer\n";
+		std::cout << "19 ... Benchmark NodeTraversal\n";
+		std::cout << "20 ... Test binary MinSG scene files\n";
+		std::cout << "21 ... Test streaming MinSG scene import\n";
+		std::cout << "22 ... Test COLLADA import\n";
+		std::cout << "23 ... Test incremental split MinSG scene export\n";
+		std::cout << "24 ... Test compressed mesh encoding\n";
+		std::cout << "25 ... Test mesh optimization\n";
+		std::cout << "26 ... Benchmark OutOfCore priority heap\n";
+		std::cout << "27 ... Test CompiledScene\n";
+		std::cout << "28 ... Test parallel mesh decoding\n";
+		std::cout << "29 ... Test parsing of float values\n";
+		std::cout << "30 ... Test sharing of equal meshes\n";
+		std::cout << "31 ... Test import cache\n";
+		std::cout << "32 ... Test OutOfCore extent allocator\n";
+		std::cout << "33 ... Test OutOfCore compressed memory cache level\n";
 
 		std::cout << "Select test: ";
 		std::cin >> testNum;
@@ -135,6 +173,44 @@ int main(int argc, char * argv[]) {
 			return test_visibility_vector();
 		case 14:
 			return test_statistics();
+		case 15:
+			return test_render_queue();
+		case 16:
+			return test_parallel_culling();
+		case 17:
+			return test_frustum_batch();
+		case 18:
+			return test_scene_state_buffer();
+		case 19:
+			return test_node_traversal();
+		case 20:
+			return test_binary_scene();
+		case 21:
+			return test_streaming_import();
+		case 22:
+			return test_dae_import();
+		case 23:
+			return test_split_scene();
+		case 24:
+			return test_mesh_encoding();
+		case 25:
+			return test_mesh_optimization();
+		case 26:
+			return test_cache_object_heap();
+		case 27:
+			return test_compiled_scene();
+		case 28:
+			return test_parallel_mesh_decoding();
+		case 29:
+			return test_float_values();
+		case 30:
+			return test_mesh_sharing();
+		case 31:
+			return test_import_cache();
+		case 32:
+			return test_extent_allocator();
+		case 33:
+			return test_compressed_memory();
 		default:
 			std::cout << "FAILURE: Invalid test selected!\n";
 			return EXIT_FAILURE;
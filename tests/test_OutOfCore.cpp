@@ -6,15 +6,22 @@
 	You should have received a copy of the MPL along with this library; see the 
 	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
 */
+#include <Geometry/Angle.h>
 #include <Geometry/Box.h>
+#include <Geometry/Frustum.h>
+#include <Geometry/Vec3.h>
 #include <MinSG/Core/FrameContext.h>
 #include <MinSG/Ext/OutOfCore/CacheManager.h>
+#include <MinSG/Ext/OutOfCore/CacheLevelCompressedMemory.h>
 #include <MinSG/Ext/OutOfCore/CacheLevelFiles.h>
 #include <MinSG/Ext/OutOfCore/CacheLevelFileSystem.h>
 #include <MinSG/Ext/OutOfCore/CacheLevelMainMemory.h>
+#include <MinSG/Ext/OutOfCore/CacheLevelPackedFiles.h>
+#include <MinSG/Ext/OutOfCore/CacheObject.h>
 #include <MinSG/Ext/OutOfCore/CacheObjectPriority.h>
 #include <MinSG/Ext/OutOfCore/Definitions.h>
 #include <MinSG/Ext/OutOfCore/OutOfCore.h>
+#include <MinSG/Ext/OutOfCore/Prefetcher.h>
 #include <Rendering/Mesh/Mesh.h>
 #include <Rendering/Mesh/MeshIndexData.h>
 #include <Rendering/Mesh/MeshVertexData.h>
@@ -26,9 +33,11 @@
 #include <Util/StringUtils.h>
 #include <Util/Timer.h>
 #include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <cstdint>
 #include <ctime>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -74,6 +83,64 @@ int test_OutOfCore() {
 		return EXIT_FAILURE;
 	}
 
+	// Tests for MinSG::OutOfCore::Prefetcher
+	{
+		// Boxes in a ring around the camera. The boxes on the right side and
+		// the boxes on the left side are handled by different prefetchers.
+		MinSG::OutOfCore::CacheContext context;
+		MinSG::OutOfCore::Prefetcher rightPrefetcher(context);
+		MinSG::OutOfCore::Prefetcher leftPrefetcher(context);
+		std::vector<std::unique_ptr<MinSG::OutOfCore::CacheObject>> cacheObjects;
+		for(int_fast32_t degree = -170; degree < 180; degree += 10) {
+			const float radians = static_cast<float>(degree) * 3.14159265f / 180.0f;
+			const Geometry::Box box(Geometry::Vec3(20.0f * std::sin(radians), 0.0f, -20.0f * std::cos(radians)), 1.0f, 1.0f, 1.0f);
+			cacheObjects.emplace_back(new MinSG::OutOfCore::CacheObject(new Rendering::Mesh));
+			if(degree > 0) {
+				rightPrefetcher.addObject(cacheObjects.back().get(), box);
+			} else if(degree < 0) {
+				leftPrefetcher.addObject(cacheObjects.back().get(), box);
+			}
+		}
+
+		Geometry::Frustum frustum;
+		frustum.setFrustumFromAngles(Geometry::Angle::deg(-30.0f), Geometry::Angle::deg(30.0f),
+									 Geometry::Angle::deg(-30.0f), Geometry::Angle::deg(30.0f), 1.0f, 100.0f);
+		uint32_t frameNumber = 1;
+		// A stationary camera does not lead to prefetching.
+		for(; frameNumber < 4; ++frameNumber) {
+			frustum.setPosition(Geometry::Vec3(0.0f, 0.0f, 0.0f), Geometry::Vec3(0.0f, 0.0f, -1.0f), Geometry::Vec3(0.0f, 1.0f, 0.0f));
+			if(rightPrefetcher.prefetch(frustum, frameNumber) != 0 || leftPrefetcher.prefetch(frustum, frameNumber) != 0) {
+				return EXIT_FAILURE;
+			}
+		}
+		// Turning the camera to the right raises only boxes on the right side.
+		rightPrefetcher.setMaxObjectsPerFrame(3);
+		uint32_t rightPrefetched = 0;
+		for(uint_fast32_t step = 1; step <= 5; ++step, ++frameNumber) {
+			const float radians = static_cast<float>(5 * step) * 3.14159265f / 180.0f;
+			frustum.setPosition(Geometry::Vec3(0.0f, 0.0f, 0.0f), Geometry::Vec3(std::sin(radians), 0.0f, -std::cos(radians)), Geometry::Vec3(0.0f, 1.0f, 0.0f));
+			const uint32_t prefetched = rightPrefetcher.prefetch(frustum, frameNumber);
+			if(prefetched > 3 || leftPrefetcher.prefetch(frustum, frameNumber) != 0) {
+				return EXIT_FAILURE;
+			}
+			rightPrefetched += prefetched;
+		}
+		if(rightPrefetched == 0) {
+			return EXIT_FAILURE;
+		}
+		// Boxes moved behind the camera are not raised anymore.
+		for(std::size_t i = 0; i < cacheObjects.size(); ++i) {
+			rightPrefetcher.setBoundingBox(cacheObjects[i].get(), Geometry::Box(Geometry::Vec3(0.0f, 0.1f * static_cast<float>(i), 20.0f), 1.0f, 1.0f, 1.0f));
+		}
+		for(uint_fast32_t step = 6; step <= 8; ++step, ++frameNumber) {
+			const float radians = static_cast<float>(5 * step) * 3.14159265f / 180.0f;
+			frustum.setPosition(Geometry::Vec3(0.0f, 0.0f, 0.0f), Geometry::Vec3(std::sin(radians), 0.0f, -std::cos(radians)), Geometry::Vec3(0.0f, 1.0f, 0.0f));
+			if(rightPrefetcher.prefetch(frustum, frameNumber) != 0) {
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
 	std::default_random_engine engine;
 	std::uniform_int_distribution<std::size_t> vertexCountDist(10, 1000);
 	const uint32_t numMeshes = 30000;
@@ -105,6 +172,8 @@ int test_OutOfCore() {
 	MinSG::OutOfCore::CacheManager & manager = MinSG::OutOfCore::getCacheManager();
 	manager.addCacheLevel(MinSG::OutOfCore::CacheLevelType::FILE_SYSTEM, 0);
 	manager.addCacheLevel(MinSG::OutOfCore::CacheLevelType::FILES, 512 * kibibyte);
+	manager.addCacheLevel(MinSG::OutOfCore::CacheLevelType::PACKED_FILES, 384 * kibibyte);
+	manager.addCacheLevel(MinSG::OutOfCore::CacheLevelType::COMPRESSED_MEMORY, 128 * kibibyte);
 	manager.addCacheLevel(MinSG::OutOfCore::CacheLevelType::MAIN_MEMORY, 256 * kibibyte);
 	
 	Util::Timer addTimer;
@@ -18,6 +18,7 @@
 #include <MinSG/Ext/States/SkyboxState.h>
 #include <MinSG/Helper/Helper.h>
 
+#include <Geometry/Box.h>
 #include <Geometry/Vec3.h>
 
 #include <Rendering/Texture/TextureUtils.h>
@@ -27,9 +28,20 @@
 #include <cstdlib>
 #include <iostream>
 #include <random>
+#include <stdexcept>
+#include <vector>
 
 using namespace MinSG;
 
+//! ListNode that only accepts other ListNodes as children.
+class ListOnlyNode : public ListNode {
+	protected:
+		void validateChild(Node * child) const override {
+			if(dynamic_cast<ListNode *>(child) == nullptr)
+				throw std::invalid_argument("ListOnlyNode can only contain ListNodes");
+		}
+};
+
 // Prevent warning
 int test_automatic();
 
@@ -131,6 +143,155 @@ int test_automatic() {
 
 		std::cout << "done.\n";
 	}
+	{
+		std::cout << "Test deferred transformation updates ... ";
+
+		// Build two identical trees; the first one is updated immediately, the second one deferred.
+		Util::Reference<ListNode> roots[2] = {new ListNode, new ListNode};
+		std::vector<Node *> nodes[2];
+		for(uint_fast8_t t = 0; t < 2; ++t) {
+			ListNode * inner = new ListNode;
+			roots[t]->addChild(inner);
+			nodes[t].push_back(inner);
+			for(uint_fast8_t i = 0; i < 10; ++i) {
+				GeometryNode * leaf = new GeometryNode;
+				leaf->setFixedBB(Geometry::Box(-1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f));
+				inner->addChild(leaf);
+				nodes[t].push_back(leaf);
+			}
+			for(const auto & node : nodes[t])
+				node->getWorldBB();
+			roots[t]->getWorldBB();
+		}
+
+		for(uint_fast8_t step = 0; step < 2; ++step) {
+			for(uint_fast8_t t = 0; t < 2; ++t) {
+				Node::setTransformationUpdatesDeferred(t == 1);
+				for(size_t i = 0; i < nodes[t].size(); ++i)
+					nodes[t][i]->moveRel(Geometry::Vec3(static_cast<float>(i), 1.0f, -2.0f));
+			}
+			Node::processPendingTransformations();
+			if(!(roots[0]->getWorldBB() == roots[1]->getWorldBB())) {
+				std::cout << "Deferred updates result in a different bounding box." << std::endl;
+				return EXIT_FAILURE;
+			}
+			for(size_t i = 0; i < nodes[0].size(); ++i) {
+				if(!(nodes[0][i]->getWorldTransformationMatrix() == nodes[1][i]->getWorldTransformationMatrix())) {
+					std::cout << "Deferred updates result in a different world matrix." << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+		}
+
+		// A pending node that is destroyed before the processing must be skipped.
+		Node::setTransformationUpdatesDeferred(true);
+		nodes[1][1]->moveRel(Geometry::Vec3(0.0f, 5.0f, 0.0f));
+		nodes[1][2]->moveRel(Geometry::Vec3(0.0f, -5.0f, 0.0f));
+		MinSG::destroy(nodes[1][1]);
+		Node::processPendingTransformations();
+		nodes[1].erase(nodes[1].begin() + 1);
+		if((nodes[1][1]->getWorldOrigin() - nodes[0][2]->getWorldOrigin() - Geometry::Vec3(0.0f, -5.0f, 0.0f)).length() > 0.001f) {
+			std::cout << "Deferred update of a sibling of a destroyed node failed." << std::endl;
+			return EXIT_FAILURE;
+		}
+		Node::setTransformationUpdatesDeferred(false);
+
+		std::cout << "done.\n";
+	}
+	{
+		std::cout << "Test bulk insertion and removal ... ";
+
+		Util::Reference<ListNode> root = new ListNode;
+		ListNode * group = new ListNode;
+		root->addChild(group);
+
+		uint32_t singleAdded = 0, batchAdded = 0, singleRemoved = 0, batchRemoved = 0;
+		size_t lastBatchSize = 0;
+		root->addNodeAddedObserver([&singleAdded](Node *) { ++singleAdded; });
+		root->addNodesAddedObserver([&batchAdded, &lastBatchSize](const std::vector<Node *> & nodes) {
+			++batchAdded;
+			lastBatchSize = nodes.size();
+		});
+		root->addNodeRemovedObserver([&singleRemoved](GroupNode *, Node *) { ++singleRemoved; });
+		root->addNodesRemovedObserver([&batchRemoved, &lastBatchSize, group](GroupNode * parent, const std::vector<Node *> & nodes) {
+			if(parent == group)
+				++batchRemoved;
+			lastBatchSize = nodes.size();
+		});
+
+		std::vector<Util::Reference<Node>> children;
+		for(uint32_t i = 0; i < 100; ++i) {
+			GeometryNode * child = new GeometryNode;
+			child->setFixedBB(Geometry::Box(-1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f));
+			child->moveRel(Geometry::Vec3(static_cast<float>(i), 0.0f, 0.0f));
+			children.push_back(child);
+		}
+		group->getWorldBB();
+		group->addChildren(children);
+		if(group->countChildren() != 100 || children[42]->getParent() != group) {
+			std::cout << "The children have not been added." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(singleAdded != 100 || batchAdded != 1 || lastBatchSize != 100) {
+			std::cout << "Wrong number of observer calls for the insertion." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(!(root->getWorldBB() == Geometry::Box(-1.0f, 100.0f, -1.0f, 1.0f, -1.0f, 1.0f))) {
+			std::cout << "The bounding box has not been updated." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		const std::vector<Util::Reference<Node>> secondHalf(children.begin() + 50, children.end());
+		if(group->removeChildren(secondHalf) != 50 || group->countChildren() != 50 || secondHalf.front()->hasParent()) {
+			std::cout << "The children have not been removed." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(singleRemoved != 50 || batchRemoved != 1 || lastBatchSize != 50) {
+			std::cout << "Wrong number of observer calls for the removal." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(!(root->getWorldBB() == Geometry::Box(-1.0f, 50.0f, -1.0f, 1.0f, -1.0f, 1.0f))) {
+			std::cout << "The bounding box has not been updated." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(group->removeChildren(secondHalf) != 0 || batchRemoved != 1) {
+			std::cout << "Removing children of another node must fail." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		group->clearChildren();
+		if(group->hasChildren() || batchRemoved != 2 || singleRemoved != 100) {
+			std::cout << "clearChildren() has to remove all children at once." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		// A rejected child must not detach any of the other children.
+		ListNode * listChild = new ListNode;
+		group->addChildren(std::vector<Util::Reference<Node>>{listChild, children[0]});
+		Util::Reference<ListOnlyNode> listOnly = new ListOnlyNode;
+		bool rejected = false;
+		try {
+			listOnly->addChildren(std::vector<Util::Reference<Node>>{listChild, children[0]});
+		} catch(const std::invalid_argument &) {
+			rejected = true;
+		}
+		if(!rejected || listChild->getParent() != group || children[0]->getParent() != group || listOnly->hasChildren()) {
+			std::cout << "Rejected children must stay at their parents." << std::endl;
+			return EXIT_FAILURE;
+		}
+		listOnly->addChildren(std::vector<Util::Reference<Node>>{listChild});
+		if(listChild->getParent() != listOnly.get()) {
+			std::cout << "The accepted child has not been added." << std::endl;
+			return EXIT_FAILURE;
+		}
+		MinSG::destroy(listOnly.get());
+		listOnly = nullptr;
+
+		MinSG::destroy(root.get());
+		root = nullptr;
+
+		std::cout << "done.\n";
+	}
 
 	std::cout << "Create chess texture ... ";
 	Util::Reference<Rendering::Texture> t = Rendering::TextureUtils::createChessTexture(64, 64);
@@ -0,0 +1,138 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/ListNode.h>
+#include <MinSG/Helper/Helper.h>
+#include <MinSG/Helper/StdNodeVisitors.h>
+#include <MinSG/SceneManagement/ExportFunctions.h>
+#include <MinSG/SceneManagement/ImportFunctions.h>
+#include <MinSG/SceneManagement/SceneManager.h>
+#include <Geometry/Box.h>
+#include <Geometry/Vec3.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/MeshUtils/MeshBuilder.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/TemporaryDirectory.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <vector>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_binary_scene();
+
+static bool equalMeshes(Rendering::Mesh * a, Rendering::Mesh * b) {
+	if(a == nullptr || b == nullptr || !(a->getVertexDescription() == b->getVertexDescription()) ||
+			a->getDrawMode() != b->getDrawMode() || a->getVertexCount() != b->getVertexCount() || a->getIndexCount() != b->getIndexCount())
+		return false;
+	const Rendering::MeshVertexData & vertexDataA = a->openVertexData();
+	const Rendering::MeshVertexData & vertexDataB = b->openVertexData();
+	const Rendering::MeshIndexData & indexDataA = a->openIndexData();
+	const Rendering::MeshIndexData & indexDataB = b->openIndexData();
+	return std::equal(vertexDataA.data(), vertexDataA.data() + vertexDataA.dataSize(), vertexDataB.data()) &&
+			std::equal(indexDataA.data(), indexDataA.data() + indexDataA.getIndexCount(), indexDataB.data());
+}
+
+//! Check that the indices refer to existing vertices and that the stored index range is correct.
+static bool hasValidIndexRange(Rendering::Mesh * mesh) {
+	const Rendering::MeshIndexData & indexData = mesh->openIndexData();
+	if(indexData.getIndexCount() == 0)
+		return true;
+	const auto minMax = std::minmax_element(indexData.data(), indexData.data() + indexData.getIndexCount());
+	return *minMax.second < mesh->getVertexCount() && indexData.getMinIndex() == *minMax.first && indexData.getMaxIndex() == *minMax.second;
+}
+
+int test_binary_scene() {
+	std::cout << "Test binary MinSG scene files ... ";
+
+	Util::TemporaryDirectory tempDir("MinSGTest_BinaryScene");
+	Util::FileName binaryFile = tempDir.getPath();
+	binaryFile.setFile("test_binary_scene.msgb");
+	Util::FileName xmlFile = tempDir.getPath();
+	xmlFile.setFile("test_binary_scene.minsg");
+
+	SceneManagement::SceneManager sceneManager;
+
+	Rendering::VertexDescription vertexDesc;
+	vertexDesc.appendPosition3D();
+	vertexDesc.appendNormalFloat();
+	Util::Reference<Rendering::Mesh> boxMesh = Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc, Geometry::Box(Geometry::Vec3f(0.5f, 0.5f, 0.5f), 1));
+	Util::Reference<Rendering::Mesh> largeBoxMesh = Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc, Geometry::Box(Geometry::Vec3f(0.0f, 0.0f, 0.0f), 4));
+
+	// ----- EXPORT -----
+	const uint32_t count = 1000;
+	{
+		Util::Reference<ListNode> root = new ListNode;
+		for(uint32_t i = 0; i < count; ++i) {
+			GeometryNode * geoNode = new GeometryNode(i % 10 == 0 ? largeBoxMesh.get() : boxMesh.get());
+			geoNode->moveRel(Geometry::Vec3(static_cast<float>(i), 0, 0));
+			root->addChild(geoNode);
+		}
+		std::deque<Node *> nodes;
+		nodes.push_back(root.get());
+		SceneManagement::saveMinSGBinaryFile(sceneManager, binaryFile, nodes);
+		SceneManagement::saveMinSGFile(sceneManager, xmlFile, nodes);
+		MinSG::destroy(root.get());
+	}
+
+	// ----- IMPORT -----
+	Util::Timer timer;
+	timer.reset();
+	const auto xmlNodes = SceneManagement::loadMinSGFile(sceneManager, xmlFile);
+	const double xmlTime = timer.getMilliseconds();
+	timer.reset();
+	const auto binaryNodes = SceneManagement::loadMinSGFile(sceneManager, binaryFile);
+	const double binaryTime = timer.getMilliseconds();
+
+	if(binaryNodes.size() != 1 || xmlNodes.size() != 1) {
+		std::cout << "Wrong number of loaded nodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	const auto geoNodes = collectNodes<GeometryNode>(binaryNodes.front().get());
+	const auto xmlGeoNodes = collectNodes<GeometryNode>(xmlNodes.front().get());
+	if(geoNodes.size() != count || xmlGeoNodes.size() != count) {
+		std::cout << "Wrong number of GeometryNodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	for(uint32_t i = 0; i < count; ++i) {
+		GeometryNode * geoNode = geoNodes[i];
+		Rendering::Mesh * exportedMesh = i % 10 == 0 ? largeBoxMesh.get() : boxMesh.get();
+		if(!(geoNode->getRelOrigin() == xmlGeoNodes[i]->getRelOrigin()) || !equalMeshes(geoNode->getMesh(), exportedMesh)) {
+			std::cout << "The node " << i << " differs from the exported node." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(!hasValidIndexRange(geoNode->getMesh()) || !(geoNode->getMesh()->getBoundingBox() == exportedMesh->getBoundingBox())) {
+			std::cout << "The index range or the bounding box of the mesh of node " << i << " is wrong." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(!equalMeshes(xmlGeoNodes[i]->getMesh(), geoNode->getMesh())) {
+			std::cout << "The mesh of the XML node " << i << " differs from the exported mesh." << std::endl;
+			return EXIT_FAILURE;
+		}
+		// every mesh is stored and created only once
+		if(geoNode->getMesh() != geoNodes[i % 10 == 0 ? 0 : 1]->getMesh()) {
+			std::cout << "A mesh has been loaded several times." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	MinSG::destroy(binaryNodes.front().get());
+	MinSG::destroy(xmlNodes.front().get());
+
+	std::cout << "done (XML: " << xmlTime << " ms, binary: " << binaryTime << " ms).\n";
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Ext/OutOfCore/CacheObject.h>
+#include <MinSG/Ext/OutOfCore/CacheObjectHeap.h>
+#include <MinSG/Ext/OutOfCore/CacheObjectPriority.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Util/Timer.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Prevent warning
+int test_cache_object_heap();
+
+#ifdef MINSG_EXT_OUTOFCORE
+using MinSG::OutOfCore::CacheObject;
+using MinSG::OutOfCore::CacheObjectHeap;
+using MinSG::OutOfCore::CacheObjectPriority;
+#endif /* MINSG_EXT_OUTOFCORE */
+
+int test_cache_object_heap() {
+#ifdef MINSG_EXT_OUTOFCORE
+	std::cout << "Test OutOfCore priority heap ... ";
+
+	const uint32_t numObjects = 200000;
+	const uint32_t numFrames = 100;
+	const uint32_t displaysPerFrame = numObjects / 10;
+
+	std::default_random_engine engine;
+	std::vector<std::unique_ptr<CacheObject>> objects;
+	objects.reserve(numObjects);
+	std::vector<CacheObjectPriority> priorities;
+	priorities.reserve(numObjects);
+	std::vector<bool> removed(numObjects, false);
+	CacheObjectHeap mostImportantHeap(CacheObjectHeap::order_t::MOST_IMPORTANT_FIRST);
+	CacheObjectHeap leastImportantHeap(CacheObjectHeap::order_t::LEAST_IMPORTANT_FIRST);
+	std::uniform_int_distribution<uint32_t> countDist(0, 4);
+	for(uint_fast32_t i = 0; i < numObjects; ++i) {
+		objects.emplace_back(new CacheObject(new Rendering::Mesh));
+		priorities.emplace_back(0, 0, static_cast<uint16_t>(countDist(engine)));
+		mostImportantHeap.push(objects.back().get(), priorities.back());
+		leastImportantHeap.push(objects.back().get(), priorities.back());
+	}
+	const auto compare = [&objects, &priorities](uint32_t a, uint32_t b) {
+		return CacheObjectHeap::isMoreImportant(priorities[a], objects[a].get(), priorities[b], objects[b].get());
+	};
+	//! Return the index of the most important (or least important) cache object by a linear search.
+	const auto findExtreme = [&](bool mostImportant) {
+		uint32_t result = numObjects;
+		for(uint32_t i = 0; i < numObjects; ++i) {
+			if(!removed[i] && (result == numObjects || (mostImportant ? compare(i, result) : compare(result, i)))) {
+				result = i;
+			}
+		}
+		return result;
+	};
+
+	// Synthetic trace: in each frame, the cache objects near a moving camera are
+	// displayed, some of them several times, and a few get a new user priority.
+	// As in CacheContext, each cache object is updated only once per frame.
+	std::uniform_int_distribution<uint32_t> nearDist(0, numObjects / 4);
+	std::uniform_int_distribution<uint32_t> userDist(0, 99);
+	std::vector<std::vector<std::pair<uint32_t, CacheObjectPriority>>> trace(numFrames);
+	{
+		std::vector<CacheObjectPriority> framePriorities(priorities);
+		std::vector<uint32_t> lastFrame(numObjects, 0);
+		for(uint_fast32_t frame = 1; frame <= numFrames; ++frame) {
+			std::vector<uint32_t> displayed;
+			const uint32_t offset = frame * (numObjects / numFrames);
+			for(uint_fast32_t d = 0; d < displaysPerFrame; ++d) {
+				const uint32_t index = (offset + nearDist(engine)) % numObjects;
+				CacheObjectPriority & priority = framePriorities[index];
+				if(lastFrame[index] != frame) {
+					lastFrame[index] = frame;
+					displayed.push_back(index);
+					priority = CacheObjectPriority(userDist(engine) == 0 ? 10 : priority.getUserPriority(), frame, 1);
+				} else {
+					priority.setUsageCount(priority.getUsageCount() + 1);
+				}
+			}
+			for(const auto & index : displayed) {
+				trace[frame - 1].emplace_back(index, framePriorities[index]);
+			}
+		}
+	}
+
+	Util::Timer heapTimer;
+	heapTimer.reset();
+	for(const auto & frameUpdates : trace) {
+		for(const auto & update : frameUpdates) {
+			mostImportantHeap.update(objects[update.first].get(), update.second);
+			leastImportantHeap.update(objects[update.first].get(), update.second);
+		}
+	}
+	heapTimer.stop();
+
+	// Reference: sorted array that is updated by removing the updated cache
+	// objects, sorting them, and merging them back (as done before the heaps).
+	std::vector<uint32_t> sorted(numObjects);
+	for(uint32_t i = 0; i < numObjects; ++i) {
+		sorted[i] = i;
+	}
+	std::sort(sorted.begin(), sorted.end(), compare);
+	Util::Timer sortTimer;
+	sortTimer.reset();
+	std::vector<bool> updated(numObjects, false);
+	std::vector<uint32_t> updatedObjects;
+	for(const auto & frameUpdates : trace) {
+		updatedObjects.clear();
+		for(const auto & update : frameUpdates) {
+			priorities[update.first] = update.second;
+			updated[update.first] = true;
+			updatedObjects.push_back(update.first);
+		}
+		sorted.erase(std::remove_if(sorted.begin(), sorted.end(), [&updated](uint32_t index) {
+									return updated[index];
+								}), sorted.end());
+		std::sort(updatedObjects.begin(), updatedObjects.end(), compare);
+		const auto oldSize = sorted.size();
+		sorted.insert(sorted.end(), updatedObjects.begin(), updatedObjects.end());
+		std::inplace_merge(sorted.begin(), std::next(sorted.begin(), static_cast<std::ptrdiff_t>(oldSize)), sorted.end(), compare);
+		for(const auto & index : updatedObjects) {
+			updated[index] = false;
+		}
+	}
+	sortTimer.stop();
+
+	if(mostImportantHeap.top() != objects[sorted.front()].get() || leastImportantHeap.top() != objects[sorted.back()].get() ||
+			mostImportantHeap.top() != objects[findExtreme(true)].get() ||
+			leastImportantHeap.top() != objects[findExtreme(false)].get()) {
+		std::cout << "The heaps are not ordered correctly after the updates." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// The first cache objects of a heap are collected in sorted order.
+	std::vector<std::pair<CacheObjectPriority, CacheObject *>> topObjects;
+	leastImportantHeap.collectTopObjects(100, topObjects);
+	if(topObjects.size() != 100 || !std::equal(topObjects.cbegin(), topObjects.cend(), sorted.crbegin(),
+			[&objects](const std::pair<CacheObjectPriority, CacheObject *> & entry, uint32_t index) {
+				return entry.second == objects[index].get();
+			})) {
+		std::cout << "The first cache objects of the heap are not collected correctly." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Remove every third cache object.
+	for(uint_fast32_t i = 0; i < numObjects; i += 3) {
+		mostImportantHeap.erase(objects[i].get());
+		leastImportantHeap.erase(objects[i].get());
+		removed[i] = true;
+	}
+	const std::size_t remaining = numObjects - (numObjects + 2) / 3;
+	if(mostImportantHeap.size() != remaining || leastImportantHeap.size() != remaining ||
+			mostImportantHeap.top() != objects[findExtreme(true)].get() ||
+			leastImportantHeap.top() != objects[findExtreme(false)].get()) {
+		std::cout << "The heaps are not ordered correctly after removing cache objects." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Removing the top repeatedly results in the sorted order.
+	sorted.erase(std::remove_if(sorted.begin(), sorted.end(), [&removed](uint32_t index) {
+								return removed[index];
+							}), sorted.end());
+	for(const auto & index : sorted) {
+		if(mostImportantHeap.empty() || mostImportantHeap.top() != objects[index].get() ||
+				!(mostImportantHeap.topPriority() == priorities[index])) {
+			std::cout << "The heap does not return the cache objects in sorted order." << std::endl;
+			return EXIT_FAILURE;
+		}
+		mostImportantHeap.erase(mostImportantHeap.top());
+	}
+	if(!mostImportantHeap.empty()) {
+		std::cout << "The heap contains too many cache objects." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "done.\n";
+	std::cout << '\t' << numFrames << " frames with " << trace.front().size() << " updated of " << numObjects << " cache objects\n";
+	std::cout << "\tindexed heaps: " << heapTimer.getMilliseconds() / numFrames << " ms/frame\n";
+	std::cout << "\tsorting and merging: " << sortTimer.getMilliseconds() / numFrames << " ms/frame\n";
+	return EXIT_SUCCESS;
+#else /* MINSG_EXT_OUTOFCORE */
+	return EXIT_FAILURE;
+#endif /* MINSG_EXT_OUTOFCORE */
+}
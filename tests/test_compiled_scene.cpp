@@ -0,0 +1,216 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/CameraNode.h>
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/ListNode.h>
+#include <MinSG/Core/NodeVisitor.h>
+#include <MinSG/Core/RenderingLayer.h>
+#include <MinSG/Ext/CompiledScene/CompiledScene.h>
+#include <MinSG/Helper/Helper.h>
+#include <Geometry/Box.h>
+#include <Geometry/Frustum.h>
+#include <Geometry/Rect.h>
+#include <Geometry/Vec3.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/MeshUtils/MeshBuilder.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Prevent warning
+int test_compiled_scene();
+
+#ifdef MINSG_EXT_COMPILEDSCENE
+using namespace MinSG;
+
+//! Create a tree with @p branching children per inner node; the leaves are GeometryNodes sharing @p mesh.
+static void createTree(ListNode * parent, uint32_t branching, uint32_t depth, Rendering::Mesh * mesh, std::default_random_engine & engine) {
+	std::uniform_real_distribution<float> offsetDist(-50.0f, 50.0f);
+	for(uint32_t i = 0; i < branching; ++i) {
+		Node * child;
+		if(depth == 0) {
+			child = new GeometryNode(mesh);
+		} else {
+			ListNode * inner = new ListNode;
+			createTree(inner, branching, depth - 1, mesh, engine);
+			child = inner;
+		}
+		child->moveRel(Geometry::Vec3(offsetDist(engine), offsetDist(engine), offsetDist(engine)) / static_cast<float>(4 - std::min(depth, 3u)));
+		parent->addChild(child);
+	}
+}
+
+//! Collect the GeometryNodes in the frustum by a traversal of the scene graph, as CompiledScene::collectVisible() does on its arrays.
+static std::vector<Node *> collectReference(Node * root, const Geometry::Frustum & frustum, renderingLayerMask_t layers) {
+	struct Visitor : public NodeVisitor {
+		const Geometry::Frustum & frustum;
+		const renderingLayerMask_t layers;
+		std::vector<Node *> nodes;
+		uint32_t insideFrustum;
+		Visitor(const Geometry::Frustum & _frustum, renderingLayerMask_t _layers) : frustum(_frustum), layers(_layers), nodes(), insideFrustum(0) {}
+		virtual ~Visitor() = default;
+
+		NodeVisitor::status enter(Node * node) override {
+			if(!node->isActive() || !node->testRenderingLayer(layers))
+				return BREAK_TRAVERSAL;
+			if(insideFrustum > 0) {
+				++insideFrustum;
+			} else {
+				const auto result = frustum.isBoxInFrustum(node->getWorldBB());
+				if(result == Geometry::Frustum::intersection_t::OUTSIDE)
+					return BREAK_TRAVERSAL;
+				if(result == Geometry::Frustum::intersection_t::INSIDE)
+					++insideFrustum;
+			}
+			GeometryNode * geoNode = dynamic_cast<GeometryNode *>(node);
+			if(geoNode != nullptr && geoNode->hasMesh())
+				nodes.push_back(node);
+			return CONTINUE_TRAVERSAL;
+		}
+		NodeVisitor::status leave(Node *) override {
+			if(insideFrustum > 0)
+				--insideFrustum;
+			return CONTINUE_TRAVERSAL;
+		}
+	} visitor(frustum, layers);
+	root->traverse(visitor);
+	return visitor.nodes;
+}
+
+//! Return true if the compiled scene returns the same nodes in the same order as the traversal of the scene graph.
+static bool compareResults(CompiledScene & compiledScene, const Geometry::Frustum & frustum, renderingLayerMask_t layers) {
+	compiledScene.update();
+	std::vector<CompiledScene::index_t> visible;
+	compiledScene.collectVisible(frustum, layers, visible);
+	const std::vector<Node *> expected = collectReference(compiledScene.getRootNode(), frustum, layers);
+	if(visible.size() != expected.size())
+		return false;
+	for(size_t i = 0; i < visible.size(); ++i) {
+		if(compiledScene.getNode(visible[i]) != expected[i] ||
+				compiledScene.getMesh(visible[i]) != static_cast<GeometryNode *>(expected[i])->getMesh() ||
+				!(compiledScene.getWorldBB(visible[i]) == expected[i]->getWorldBB()))
+			return false;
+	}
+	return true;
+}
+#endif /* MINSG_EXT_COMPILEDSCENE */
+
+int test_compiled_scene() {
+#ifdef MINSG_EXT_COMPILEDSCENE
+	std::cout << "Test compiled scene ... ";
+
+	Rendering::VertexDescription vertexDesc;
+	vertexDesc.appendPosition3D();
+	vertexDesc.appendNormalFloat();
+	Util::Reference<Rendering::Mesh> boxMesh = Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc, Geometry::Box(Geometry::Vec3f(0.0f, 0.0f, 0.0f), 2));
+
+	std::default_random_engine engine;
+	Util::Reference<ListNode> root = new ListNode;
+	createTree(root.get(), 8, 4, boxMesh.get(), engine);
+
+	Util::Reference<CameraNode> camera = new CameraNode;
+	camera->setViewport(Geometry::Rect_i(0, 0, 1024, 768));
+	camera->setNearFar(0.1f, 300.0f);
+	camera->applyVerticalAngle(80);
+	camera->moveRel(Geometry::Vec3(0, 0, 150));
+	const Geometry::Frustum & frustum = camera->getFrustum();
+
+	ListNode * firstGroup = static_cast<ListNode *>(root->getChild(0));
+	ListNode * secondGroup = static_cast<ListNode *>(root->getChild(1));
+	ListNode * thirdGroup = static_cast<ListNode *>(root->getChild(2));
+	secondGroup->deactivate();
+	thirdGroup->setRenderingLayers(RENDERING_LAYER_BUILTIN_META_OBJ);
+
+	{
+		CompiledScene compiledScene(root.get());
+		if(!compareResults(compiledScene, frustum, RENDERING_LAYER_DEFAULT) ||
+				!compareResults(compiledScene, frustum, RENDERING_LAYER_DEFAULT | RENDERING_LAYER_BUILTIN_META_OBJ)) {
+			std::cout << "The compiled scene differs from the scene graph." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		// Timing of the culling
+		const uint32_t repetitions = 10;
+		Util::Timer timer;
+		timer.reset();
+		for(uint32_t r = 0; r < repetitions; ++r)
+			collectReference(root.get(), frustum, RENDERING_LAYER_DEFAULT);
+		const double traversalTime = timer.getMilliseconds() / repetitions;
+		std::vector<CompiledScene::index_t> visible;
+		timer.reset();
+		for(uint32_t r = 0; r < repetitions; ++r) {
+			visible.clear();
+			compiledScene.collectVisible(frustum, RENDERING_LAYER_DEFAULT, visible);
+		}
+		const double compiledTime = timer.getMilliseconds() / repetitions;
+
+		// Observed change: transformations
+		for(uint32_t i = 0; i < firstGroup->countChildren(); i += 2)
+			firstGroup->getChild(i)->moveRel(Geometry::Vec3(20.0f, 0.0f, 0.0f));
+		root->getChild(3)->moveRel(Geometry::Vec3(0.0f, -30.0f, 0.0f));
+		if(!compareResults(compiledScene, frustum, RENDERING_LAYER_DEFAULT)) {
+			std::cout << "The compiled scene is not updated after transformations." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		// Announced change: replaced mesh; the snapshot has to refer to the new mesh afterwards.
+		GeometryNode * leaf = static_cast<GeometryNode *>(static_cast<ListNode *>(static_cast<ListNode *>(static_cast<ListNode *>(firstGroup->getChild(1))->getChild(0))->getChild(0))->getChild(0));
+		{
+			Util::Reference<Rendering::Mesh> largeMesh = Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc, Geometry::Box(Geometry::Vec3f(0.0f, 0.0f, 0.0f), 40));
+			leaf->setMesh(largeMesh.get());
+		}
+		compiledScene.markDirty(leaf);
+		compiledScene.update();
+		if(compiledScene.getMesh(compiledScene.getIndex(leaf)) != leaf->getMesh() || !compareResults(compiledScene, frustum, RENDERING_LAYER_DEFAULT)) {
+			std::cout << "The compiled scene is not updated after replacing a mesh." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		// Announced changes: rendering layers and activation
+		thirdGroup->setRenderingLayers(RENDERING_LAYER_DEFAULT);
+		compiledScene.markDirty(thirdGroup);
+		if(!compareResults(compiledScene, frustum, RENDERING_LAYER_DEFAULT)) {
+			std::cout << "The compiled scene is not updated after changing the rendering layers." << std::endl;
+			return EXIT_FAILURE;
+		}
+		secondGroup->activate();
+		compiledScene.markDirty(secondGroup);
+		if(!compareResults(compiledScene, frustum, RENDERING_LAYER_DEFAULT)) {
+			std::cout << "The compiled scene is not updated after activating a node." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		// Observed change: structure
+		MinSG::destroy(root->getChild(4));
+		if(!compareResults(compiledScene, frustum, RENDERING_LAYER_DEFAULT)) {
+			std::cout << "The compiled scene is not updated after removing a node." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		std::cout << "\n\ttraversal: " << traversalTime << " ms, compiled: " << compiledTime << " ms, speedup " << traversalTime / compiledTime << "\n";
+	}
+	if(root->isTransformationObserved()) {
+		std::cout << "The observers of the compiled scene have not been removed." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	MinSG::destroy(root.get());
+	root = nullptr;
+
+	std::cout << "done.\n";
+	return EXIT_SUCCESS;
+#else /* MINSG_EXT_COMPILEDSCENE */
+	return EXIT_FAILURE;
+#endif /* MINSG_EXT_COMPILEDSCENE */
+}
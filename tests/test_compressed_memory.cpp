@@ -0,0 +1,188 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Ext/OutOfCore/CacheContext.h>
+#include <MinSG/Ext/OutOfCore/CacheLevelCompressedMemory.h>
+#include <MinSG/Ext/OutOfCore/CacheLevelFileSystem.h>
+#include <MinSG/Ext/OutOfCore/CacheObject.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/Serialization/Serialization.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/TemporaryDirectory.h>
+#include <Util/References.h>
+#include <Util/StringUtils.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// Prevent warning
+int test_compressed_memory();
+
+#ifdef MINSG_EXT_OUTOFCORE
+//! Create a grid of @p size x @p size vertices with positions and normals.
+static Rendering::Mesh * createGrid(uint32_t size, float height) {
+	Rendering::VertexDescription vertexDesc;
+	vertexDesc.appendPosition3D();
+	vertexDesc.appendNormalFloat();
+	auto mesh = new Rendering::Mesh(vertexDesc, size * size, 6 * (size - 1) * (size - 1));
+	Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+	float * vertex = reinterpret_cast<float *>(vertexData.data());
+	for(uint32_t z = 0; z < size; ++z) {
+		for(uint32_t x = 0; x < size; ++x) {
+			*vertex++ = 0.25f * static_cast<float>(x);
+			*vertex++ = height * static_cast<float>((x * z) % 7);
+			*vertex++ = 0.25f * static_cast<float>(z);
+			*vertex++ = 0.0f;
+			*vertex++ = 1.0f;
+			*vertex++ = 0.0f;
+		}
+	}
+	vertexData.updateBoundingBox();
+	vertexData.markAsChanged();
+	Rendering::MeshIndexData & indexData = mesh->openIndexData();
+	uint32_t * index = indexData.data();
+	for(uint32_t z = 0; z + 1 < size; ++z) {
+		for(uint32_t x = 0; x + 1 < size; ++x) {
+			const uint32_t corner = z * size + x;
+			*index++ = corner;
+			*index++ = corner + size;
+			*index++ = corner + 1;
+			*index++ = corner + 1;
+			*index++ = corner + size;
+			*index++ = corner + size + 1;
+		}
+	}
+	indexData.markAsChanged();
+	return mesh;
+}
+
+//! Compare the decoded mesh with the original mesh. The vertex attributes may differ by @p tolerance.
+static bool equalMeshes(Rendering::Mesh * decoded, Rendering::Mesh * original, float tolerance) {
+	const Rendering::MeshVertexData & vertexDataA = decoded->_getVertexData();
+	const Rendering::MeshVertexData & vertexDataB = original->_getVertexData();
+	const Rendering::MeshIndexData & indexDataA = decoded->_getIndexData();
+	const Rendering::MeshIndexData & indexDataB = original->_getIndexData();
+	if(!vertexDataA.hasLocalData() || !indexDataA.hasLocalData() || !(vertexDataA.getVertexDescription() == vertexDataB.getVertexDescription()) ||
+			vertexDataA.getVertexCount() != vertexDataB.getVertexCount() || indexDataA.getIndexCount() != indexDataB.getIndexCount() ||
+			decoded->getDrawMode() != original->getDrawMode()) {
+		return false;
+	}
+	const float * floatsA = reinterpret_cast<const float *>(vertexDataA.data());
+	const float * floatsB = reinterpret_cast<const float *>(vertexDataB.data());
+	for(std::size_t i = 0; i < vertexDataB.dataSize() / sizeof(float); ++i) {
+		if(std::abs(floatsA[i] - floatsB[i]) > tolerance) {
+			return false;
+		}
+	}
+	for(uint32_t i = 0; i < indexDataB.getIndexCount(); ++i) {
+		if(indexDataA.data()[i] != indexDataB.data()[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+#endif /* MINSG_EXT_OUTOFCORE */
+
+int test_compressed_memory() {
+#ifdef MINSG_EXT_OUTOFCORE
+	using namespace MinSG::OutOfCore;
+	std::cout << "Test OutOfCore compressed memory cache level ... ";
+
+	Util::TemporaryDirectory tempDir("MinSGTest_CompressedMemory");
+	const uint32_t numMeshes = 20;
+	std::vector<Util::Reference<Rendering::Mesh>> originals;
+	for(uint32_t i = 0; i < numMeshes; ++i) {
+		originals.emplace_back(createGrid(16 + i, 0.1f * static_cast<float>(i % 4)));
+		Rendering::Serialization::saveMesh(originals.back().get(), Util::FileName(tempDir.getPath().getDir() + Util::StringUtils::toString<uint32_t>(i) + ".mmf"));
+	}
+
+	double losslessRatio = 0.0;
+	// Lossless encoding, and quantization of the positions with 16 bits (quantization step 6e-5 for the largest grid)
+	for(const uint32_t positionBits : {0u, 16u}) {
+		const float tolerance = positionBits == 0 ? 0.0f : 1.0e-3f;
+		CacheContext context;
+		CacheLevelFileSystem fileSystemLevel(context);
+		CacheLevelCompressedMemory compressedLevel(1024 * 1024, context, positionBits);
+		fileSystemLevel.setUpper(&compressedLevel);
+
+		std::vector<std::unique_ptr<CacheObject>> objects;
+		for(uint32_t i = 0; i < numMeshes; ++i) {
+			auto mesh = new Rendering::Mesh;
+			mesh->_getVertexData()._setBoundingBox(originals[i]->getBoundingBox());
+			mesh->setFileName(Util::FileName(tempDir.getPath().getDir() + Util::StringUtils::toString<uint32_t>(i) + ".mmf"));
+			objects.emplace_back(new CacheObject(mesh));
+			fileSystemLevel.addCacheObject(objects.back().get());
+			context.addObject(objects.back().get());
+		}
+
+		// The first load reads the files and encodes the meshes.
+		for(const auto & object : objects) {
+			if(!compressedLevel.loadCacheObject(object.get())) {
+				std::cout << "A cache object has not been loaded from the file system." << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		if(compressedLevel.getNumObjects() != numMeshes || compressedLevel.getDecompressedObjects() != 0 ||
+				compressedLevel.getPositionBits() != positionBits) {
+			std::cout << "The cache objects have not been stored in the compressed memory cache level." << std::endl;
+			return EXIT_FAILURE;
+		}
+		const double ratio = compressedLevel.getCompressionRatio();
+		if(ratio <= 1.0 || (positionBits != 0 && ratio <= losslessRatio)) {
+			std::cout << "The meshes have not been compressed (ratio " << ratio << ")." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(positionBits == 0) {
+			losslessRatio = ratio;
+		}
+
+		// The second load decodes the stored meshes.
+		for(uint32_t i = 0; i < numMeshes; ++i) {
+			CacheObject * object = objects[i].get();
+			Util::Reference<Rendering::Mesh> emptyMesh = new Rendering::Mesh;
+			context.setContent(object, emptyMesh.get());
+			Rendering::Mesh * content = context.getContent(object);
+			if(!compressedLevel.loadCacheObject(object) || !equalMeshes(content, originals[i].get(), tolerance)) {
+				std::cout << "The decoded mesh " << i << " differs from the original mesh (position bits " << positionBits << ")." << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		if(compressedLevel.getDecompressedObjects() != numMeshes || compressedLevel.getDecompressionTime() < 0.0) {
+			std::cout << "Wrong decompression statistics." << std::endl;
+			return EXIT_FAILURE;
+		}
+		compressedLevel.resetDecompressionStatistics();
+		if(compressedLevel.getDecompressedObjects() != 0 || compressedLevel.getDecompressionTime() != 0.0 ||
+				compressedLevel.getCompressionRatio() != ratio) {
+			std::cout << "The decompression statistics have not been reset." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		// Removing the cache objects releases the encoded meshes.
+		for(const auto & object : objects) {
+			compressedLevel.removeCacheObject(object.get());
+		}
+		if(compressedLevel.getNumObjects() != 0 || compressedLevel.getUsedMemory() != 0 || compressedLevel.getCompressionRatio() != 1.0) {
+			std::cout << "The encoded meshes have not been released." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::cout << "done (lossless compression ratio: " << losslessRatio << ").\n";
+	return EXIT_SUCCESS;
+#else /* MINSG_EXT_OUTOFCORE */
+	return EXIT_FAILURE;
+#endif /* MINSG_EXT_OUTOFCORE */
+}
@@ -0,0 +1,127 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/GroupNode.h>
+#include <MinSG/Helper/Helper.h>
+#include <MinSG/Helper/StdNodeVisitors.h>
+#include <MinSG/SceneManagement/ImportFunctions.h>
+#include <MinSG/SceneManagement/SceneManager.h>
+#include <Geometry/Box.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/FileUtils.h>
+#include <Util/IO/TemporaryDirectory.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_dae_import();
+
+/*! Write a COLLADA file containing a grid of @p size x @p size cells in the x-z-plane. The cells of even
+	rows are quads, the cells of odd rows are split into two triangles; all of them are stored in one polylist. */
+static void writeGrid(std::ostream & out, uint32_t size) {
+	const uint32_t vertexCount = (size + 1) * (size + 1);
+	out << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+		<< "<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+		<< "<asset><up_axis>Y_UP</up_axis></asset>\n"
+		<< "<library_geometries><geometry id=\"grid\"><mesh>\n";
+
+	out << "<source id=\"grid-positions\"><float_array id=\"grid-positions-array\" count=\"" << 3 * vertexCount << "\">";
+	out << std::setprecision(std::numeric_limits<float>::max_digits10);
+	for(uint32_t z = 0; z <= size; ++z) {
+		for(uint32_t x = 0; x <= size; ++x)
+			out << static_cast<float>(x) * 0.1f << ' ' << 0.001f * static_cast<float>((x * z) % 7) << ' ' << static_cast<float>(z) * 0.1f << '\n';
+	}
+	out << "</float_array>\n<technique_common><accessor source=\"#grid-positions-array\" count=\"" << vertexCount << "\" stride=\"3\">"
+		<< "<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/></accessor></technique_common></source>\n";
+
+	out << "<source id=\"grid-normals\"><float_array id=\"grid-normals-array\" count=\"3\">0 1 0</float_array>\n"
+		<< "<technique_common><accessor source=\"#grid-normals-array\" count=\"1\" stride=\"3\">"
+		<< "<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/></accessor></technique_common></source>\n";
+	out << "<vertices id=\"grid-vertices\"><input semantic=\"POSITION\" source=\"#grid-positions\"/></vertices>\n";
+
+	const uint32_t polygonCount = size * size + (size / 2) * size;
+	out << "<polylist count=\"" << polygonCount << "\"><input semantic=\"VERTEX\" source=\"#grid-vertices\" offset=\"0\"/>"
+		<< "<input semantic=\"NORMAL\" source=\"#grid-normals\" offset=\"1\"/>\n<vcount>";
+	for(uint32_t z = 0; z < size; ++z) {
+		for(uint32_t x = 0; x < size; ++x)
+			out << (z % 2 == 0 ? "4 " : "3 3 ");
+	}
+	out << "</vcount>\n<p>";
+	for(uint32_t z = 0; z < size; ++z) {
+		for(uint32_t x = 0; x < size; ++x) {
+			const uint32_t v0 = z * (size + 1) + x;
+			const uint32_t v1 = v0 + 1;
+			const uint32_t v2 = v0 + size + 2;
+			const uint32_t v3 = v0 + size + 1;
+			if(z % 2 == 0)
+				out << v0 << " 0 " << v1 << " 0 " << v2 << " 0 " << v3 << " 0\n";
+			else
+				out << v0 << " 0 " << v1 << " 0 " << v2 << " 0 " << v2 << " 0 " << v3 << " 0 " << v0 << " 0\n";
+		}
+	}
+	out << "</p></polylist>\n</mesh></geometry></library_geometries>\n"
+		<< "<library_visual_scenes><visual_scene id=\"scene\"><node id=\"gridNode\"><instance_geometry url=\"#grid\"/></node></visual_scene></library_visual_scenes>\n"
+		<< "<scene><instance_visual_scene url=\"#scene\"/></scene>\n"
+		<< "</COLLADA>\n";
+}
+
+int test_dae_import() {
+	std::cout << "Test COLLADA import ... ";
+
+	Util::TemporaryDirectory tempDir("MinSGTest_DAEImport");
+	Util::FileName daeFile = tempDir.getPath();
+	daeFile.setFile("test_dae_import.dae");
+
+	// large enough to split the arrays into several chunks
+	const uint32_t size = 400;
+	{
+		std::ofstream out(daeFile.getPath().c_str());
+		writeGrid(out, size);
+	}
+	const double fileSize = static_cast<double>(Util::FileUtils::fileSize(daeFile));
+
+	SceneManagement::SceneManager sceneManager;
+	Util::Timer timer;
+	timer.reset();
+	Util::Reference<GroupNode> scene = SceneManagement::loadCOLLADA(sceneManager, daeFile);
+	const double seconds = timer.getSeconds();
+	if(scene.isNull()) {
+		std::cout << "Loading the file failed." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	const auto geoNodes = collectNodes<GeometryNode>(scene.get());
+	if(geoNodes.size() != 1 || geoNodes.front()->getMesh() == nullptr) {
+		std::cout << "Wrong number of GeometryNodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	Rendering::Mesh * mesh = geoNodes.front()->getMesh();
+	if(mesh->getVertexCount() != (size + 1) * (size + 1) || mesh->getIndexCount() != 6 * size * size) {
+		std::cout << "Wrong mesh size (vertices: " << mesh->getVertexCount() << ", indices: " << mesh->getIndexCount() << ")." << std::endl;
+		return EXIT_FAILURE;
+	}
+	const Geometry::Box bb = mesh->getBoundingBox();
+	if(std::abs(bb.getExtentX() - static_cast<float>(size) * 0.1f) > 1.0e-3f || std::abs(bb.getExtentZ() - static_cast<float>(size) * 0.1f) > 1.0e-3f) {
+		std::cout << "Wrong bounding box." << std::endl;
+		return EXIT_FAILURE;
+	}
+	MinSG::destroy(scene.get());
+
+	std::cout << "done (" << fileSize / (1024.0 * 1024.0) / seconds << " MB/s).\n";
+	return EXIT_SUCCESS;
+}
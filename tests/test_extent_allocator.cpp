@@ -0,0 +1,161 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Ext/OutOfCore/ExtentAllocator.h>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Prevent warning
+int test_extent_allocator();
+
+#ifdef MINSG_EXT_OUTOFCORE
+using MinSG::OutOfCore::ExtentAllocator;
+
+static bool isExtent(const ExtentAllocator::Extent & extent, uint32_t slab, uint64_t offset) {
+	return extent.slab == slab && extent.offset == offset;
+}
+#endif /* MINSG_EXT_OUTOFCORE */
+
+int test_extent_allocator() {
+#ifdef MINSG_EXT_OUTOFCORE
+	std::cout << "Test OutOfCore extent allocator ... ";
+
+	{	// best fit
+		ExtentAllocator allocator(1000);
+		const auto a = allocator.allocate(100);
+		const auto b = allocator.allocate(300);
+		const auto c = allocator.allocate(100);
+		const auto d = allocator.allocate(50);
+		const auto e = allocator.allocate(100);
+		if(!isExtent(a, 0, 0) || !isExtent(b, 0, 100) || !isExtent(c, 0, 400) || !isExtent(d, 0, 500) || !isExtent(e, 0, 550)) {
+			std::cout << "The extents are not allocated consecutively." << std::endl;
+			return EXIT_FAILURE;
+		}
+		// free extents of 300, 50 and the remaining 350 bytes at the end
+		allocator.free(b, 300);
+		allocator.free(d, 50);
+		if(allocator.getNumFreeExtents() != 3 || !allocator.isConsistent()) {
+			std::cout << "Wrong free extents after freeing." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(!isExtent(allocator.allocate(40), 0, 500) || !isExtent(allocator.allocate(320), 0, 650) || !isExtent(allocator.allocate(200), 0, 100)) {
+			std::cout << "The smallest sufficient free extent has not been chosen." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(!allocator.isConsistent() || allocator.getSlabUsage(0) != 860 || allocator.getNumSlabs() != 1) {
+			std::cout << "Wrong usage after best-fit allocations." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	{	// merging of adjacent free extents
+		ExtentAllocator allocator(1000);
+		std::vector<ExtentAllocator::Extent> extents;
+		for(uint32_t i = 0; i < 10; ++i) {
+			extents.push_back(allocator.allocate(100));
+		}
+		// free every second extent, then the remaining ones in between
+		for(uint32_t i = 1; i < 10; i += 2) {
+			allocator.free(extents[i], 100);
+		}
+		if(allocator.getNumFreeExtents() != 5 || !allocator.isConsistent()) {
+			std::cout << "Non-adjacent free extents have been merged." << std::endl;
+			return EXIT_FAILURE;
+		}
+		for(uint32_t i = 2; i < 10; i += 2) {
+			allocator.free(extents[i], 100);
+		}
+		if(allocator.getNumFreeExtents() != 1 || !allocator.isConsistent() || allocator.overlapsFreeExtent(extents[0], 100) ||
+				!allocator.overlapsFreeExtent(extents[1], 100)) {
+			std::cout << "Adjacent free extents have not been merged." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(!isExtent(allocator.allocate(900), 0, 100)) {
+			std::cout << "The merged free extent has not been reused." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	{	// growth with new slabs and removal of empty slabs
+		ExtentAllocator allocator(1000);
+		const auto a = allocator.allocate(800);
+		const auto b = allocator.allocate(800);
+		const auto c = allocator.allocate(2500);
+		if(!isExtent(a, 0, 0) || !isExtent(b, 1, 0) || !isExtent(c, 2, 0) || allocator.getNumSlabs() != 3 ||
+				allocator.getSlabSize(1) != 1000 || allocator.getSlabSize(2) != 2500 || !allocator.isConsistent()) {
+			std::cout << "No new slabs have been added." << std::endl;
+			return EXIT_FAILURE;
+		}
+		// the free space of existing slabs is used before adding a slab
+		if(!isExtent(allocator.allocate(150), 0, 800) || !isExtent(allocator.allocate(180), 1, 800) || allocator.getNumSlabs() != 3) {
+			std::cout << "The free space of existing slabs has not been used." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(!allocator.free(c, 2500) || allocator.getSlabSize(2) != 0 || allocator.getNumSlabs() != 2 || !allocator.isConsistent()) {
+			std::cout << "The empty slab has not been removed." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(allocator.free(a, 800) || allocator.getSlabSize(0) != 1000) {
+			std::cout << "The first slab has been removed." << std::endl;
+			return EXIT_FAILURE;
+		}
+		// the entry of the removed slab is reused
+		const auto d = allocator.allocate(1000);
+		if(!isExtent(d, 2, 0) || allocator.getSlabSize(2) != 1000 || allocator.getNumSlabs() != 3 || !allocator.isConsistent()) {
+			std::cout << "The entry of the removed slab has not been reused." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	{	// random allocations
+		ExtentAllocator allocator(1 << 16);
+		std::default_random_engine engine;
+		std::uniform_int_distribution<uint64_t> sizeDist(1, 1 << 12);
+		std::vector<std::pair<ExtentAllocator::Extent, uint64_t>> allocated;
+		for(uint32_t step = 0; step < 20000; ++step) {
+			if(allocated.empty() || engine() % 5 < 3) {
+				const uint64_t size = sizeDist(engine);
+				const auto extent = allocator.allocate(size);
+				if(extent.offset + size > allocator.getSlabSize(extent.slab) || allocator.overlapsFreeExtent(extent, size)) {
+					std::cout << "An invalid extent has been allocated." << std::endl;
+					return EXIT_FAILURE;
+				}
+				allocated.emplace_back(extent, size);
+			} else {
+				const std::size_t index = engine() % allocated.size();
+				const auto entry = allocated[index];
+				allocated[index] = allocated.back();
+				allocated.pop_back();
+				const bool removed = allocator.free(entry.first, entry.second);
+				if(removed != (allocator.getSlabSize(entry.first.slab) == 0)) {
+					std::cout << "Wrong result of freeing an extent." << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+			if(step % 1000 == 0 && !allocator.isConsistent()) {
+				std::cout << "The allocator is inconsistent." << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		while(!allocated.empty()) {
+			allocator.free(allocated.back().first, allocated.back().second);
+			allocated.pop_back();
+		}
+		if(allocator.getNumSlabs() != 1 || allocator.getSlabUsage(0) != 0 || allocator.getNumFreeExtents() != 1 || !allocator.isConsistent()) {
+			std::cout << "The slabs have not been freed." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::cout << "done.\n";
+	return EXIT_SUCCESS;
+#else /* MINSG_EXT_OUTOFCORE */
+	return EXIT_FAILURE;
+#endif /* MINSG_EXT_OUTOFCORE */
+}
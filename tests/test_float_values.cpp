@@ -0,0 +1,131 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/SceneManagement/Importer/ImporterTools.h>
+#include <MinSG/SceneManagement/NumberParsing.h>
+#include <MinSG/SceneManagement/SceneDescription.h>
+#include <Util/GenericAttribute.h>
+#include <Util/StringIdentifier.h>
+#include <cstdlib>
+#include <iostream>
+#include <locale>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace MinSG::SceneManagement;
+
+// Prevent warning
+int test_float_values();
+
+//! Return true if the float values are parsed and written correctly.
+static bool testFloatValues() {
+	{	// the string representation is exact
+		const std::vector<float> values{0.1f, -1.0e-7f, 3.4e38f, 42.0f};
+		const FloatValuesAttribute attribute(values);
+		std::vector<float> parsedValues;
+		if(!parseFloatValues(attribute.toString(), parsedValues) || parsedValues != values) {
+			std::cout << "The string representation of float values is not exact." << std::endl;
+			return false;
+		}
+	}
+	{	// separators
+		std::vector<float> values;
+		if(!parseFloatValues(" 0.5,1e-3\t-2\n", values) || values != std::vector<float>{0.5f, 1.0e-3f, -2.0f}) {
+			std::cout << "Float values with separators are not parsed correctly." << std::endl;
+			return false;
+		}
+		if(!parseFloatValues("", values) || !values.empty()) {
+			std::cout << "An empty string is not parsed correctly." << std::endl;
+			return false;
+		}
+	}
+	{	// invalid values
+		std::vector<float> values;
+		if(parseFloatValues("1.5x", values) || parseFloatValues("1 two", values) || parseFloatValues("1e39", values)) {
+			std::cout << "Invalid float values are accepted." << std::endl;
+			return false;
+		}
+	}
+	{	// numbers inside of a range; long mantissas and large exponents
+		const std::string text("1.5;0.100000000000000005551115123125782702118;-2.5e30;.25e;nan");
+		const char * const end = text.data() + text.size();
+		std::vector<float> values;
+		const char * cursor = text.data();
+		float value;
+		while((cursor = NumberParsing::parseFloat(cursor, end, value)) != nullptr) {
+			values.push_back(value);
+			if(cursor == end || *cursor != ';')
+				break;
+			++cursor;
+		}
+		if(values != std::vector<float>{1.5f, 0.1f, -2.5e30f, 0.25f} || cursor == nullptr || *cursor != 'e' ||
+				NumberParsing::parseFloat(end - 3, end, value) != nullptr) {
+			std::cout << "Numbers in a range are not parsed correctly." << std::endl;
+			return false;
+		}
+	}
+	{	// getFloatValues uses parsed values and strings
+		static const Util::StringIdentifier parsedKey("parsed");
+		static const Util::StringIdentifier stringKey("string");
+		static const Util::StringIdentifier missingKey("missing");
+		DescriptionMap description;
+		description.setValue(parsedKey, new FloatValuesAttribute(std::vector<float>{1.0f, 2.0f}));
+		description.setString(stringKey, "0.25 4");
+		std::vector<float> values;
+		ImporterTools::getFloatValues(description, parsedKey, values);
+		if(values != std::vector<float>{1.0f, 2.0f}) {
+			std::cout << "Parsed float values are not returned." << std::endl;
+			return false;
+		}
+		ImporterTools::getFloatValues(description, stringKey, values);
+		if(values != std::vector<float>{0.25f, 4.0f}) {
+			std::cout << "Float values of a string are not parsed." << std::endl;
+			return false;
+		}
+		ImporterTools::getFloatValues(description, missingKey, values);
+		if(!values.empty()) {
+			std::cout << "Float values are returned for a missing key." << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+int test_float_values() {
+	std::cout << "Test parsing of float values ... ";
+
+	if(!testFloatValues())
+		return EXIT_FAILURE;
+
+	// The values have to be independent of the decimal point of the current locale.
+	const char * const commaLocales[] = {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR"};
+	const char * commaLocale = nullptr;
+	std::locale previousLocale;
+	for(const auto & localeName : commaLocales) {
+		try {
+			// also sets the locale of the C library
+			previousLocale = std::locale::global(std::locale(localeName));
+			commaLocale = localeName;
+			break;
+		} catch(const std::runtime_error &) {
+			// locale is not available
+		}
+	}
+	if(commaLocale != nullptr) {
+		const bool success = testFloatValues();
+		std::locale::global(previousLocale);
+		if(!success) {
+			std::cout << "(locale " << commaLocale << ")" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::cout << "done" << (commaLocale == nullptr ? " (no locale with decimal comma available)" : "") << ".\n";
+	return EXIT_SUCCESS;
+}
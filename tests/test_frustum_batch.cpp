@@ -0,0 +1,115 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/CameraNode.h>
+#include <MinSG/Helper/FrustumBatchTest.h>
+#include <Geometry/Angle.h>
+#include <Geometry/Box.h>
+#include <Geometry/Frustum.h>
+#include <Geometry/Rect.h>
+#include <Geometry/Vec3.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_frustum_batch();
+
+static Geometry::Box createCube(const Geometry::Vec3 & center, float halfSize) {
+	return Geometry::Box(center.getX() - halfSize, center.getX() + halfSize,
+						center.getY() - halfSize, center.getY() + halfSize,
+						center.getZ() - halfSize, center.getZ() + halfSize);
+}
+
+int test_frustum_batch() {
+	std::cout << "Test batch box-frustum classification ... ";
+
+	Util::Reference<CameraNode> camera = new CameraNode;
+	camera->setViewport(Geometry::Rect_i(0, 0, 1024, 768));
+	camera->setNearFar(0.1f, 200.0f);
+	camera->applyVerticalAngle(60);
+	camera->moveRel(Geometry::Vec3(10, 5, 100));
+	camera->rotateLocal(Geometry::Angle::deg(30), Geometry::Vec3(0, 1, 0));
+	const Geometry::Frustum & frustum = camera->getFrustum();
+	const FrustumPlanes planes = FrustumPlanes::fromFrustum(frustum);
+
+	std::default_random_engine engine;
+	std::uniform_real_distribution<float> posDist(-200.0f, 200.0f);
+	std::uniform_real_distribution<float> sizeDist(0.05f, 5.0f);
+	const size_t count = 100003; // not a multiple of the SIMD width
+	BoxBatch batch;
+	batch.reserve(count);
+	std::vector<Geometry::Box> boxes;
+	boxes.reserve(count);
+	for(size_t i = 0; i < count; ++i) {
+		const Geometry::Vec3 center(posDist(engine), posDist(engine), posDist(engine));
+		boxes.push_back(createCube(center, sizeDist(engine)));
+		batch.push_back(boxes.back());
+	}
+
+	// a small box in front of the camera and a box behind the camera
+	{
+		BoxBatch special;
+		special.push_back(createCube(frustum.getPos() + frustum.getDir() * 50.0f, 0.5f));
+		special.push_back(createCube(frustum.getPos() - frustum.getDir() * 50.0f, 0.5f));
+		std::vector<uint8_t> results;
+		classifyBoxes(planes, special, results);
+		if(results[0] != BOX_INSIDE || results[1] != BOX_OUTSIDE) {
+			std::cout << "Wrong classification of the boxes in front of and behind the camera." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	// reference: scalar kernel
+	std::vector<uint8_t> reference(count);
+	classifyBoxes(planes, batch.getArrays(), count, reference.data(), simdInstructionSet_t::SCALAR);
+	for(size_t i = 0; i < count; ++i) {
+		const auto result = frustum.isBoxInFrustum(boxes[i]);
+		if((reference[i] == BOX_INSIDE && result == Geometry::Frustum::intersection_t::OUTSIDE)
+				|| (reference[i] == BOX_OUTSIDE && result == Geometry::Frustum::intersection_t::INSIDE)) {
+			std::cout << "The classification contradicts Frustum::isBoxInFrustum." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::cout << '\n';
+	const simdInstructionSet_t instructionSets[] = {simdInstructionSet_t::SCALAR, simdInstructionSet_t::SSE, simdInstructionSet_t::AVX2};
+	const char * names[] = {"scalar", "SSE", "AVX2"};
+	const uint32_t repetitions = 50;
+	std::vector<uint8_t> results(count);
+	Util::Timer timer;
+	for(uint_fast8_t s = 0; s < 3; ++s) {
+		if(!isInstructionSetSupported(instructionSets[s])) {
+			std::cout << '\t' << names[s] << ": not supported\n";
+			continue;
+		}
+		timer.reset();
+		for(uint32_t r = 0; r < repetitions; ++r)
+			classifyBoxes(planes, batch.getArrays(), count, results.data(), instructionSets[s]);
+		const double seconds = timer.getSeconds();
+		std::cout << '\t' << names[s] << ": " << (count * repetitions / seconds) / 1.0e6 << " M boxes/s\n";
+		if(results != reference) {
+			std::cout << "The " << names[s] << " kernel differs from the scalar kernel." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	timer.reset();
+	for(uint32_t r = 0; r < repetitions; ++r) {
+		for(size_t i = 0; i < count; ++i)
+			results[i] = static_cast<uint8_t>(frustum.isBoxInFrustum(boxes[i]));
+	}
+	std::cout << "\tFrustum::isBoxInFrustum: " << (count * repetitions / timer.getSeconds()) / 1.0e6 << " M boxes/s\n";
+
+	std::cout << "done.\n";
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,160 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/ListNode.h>
+#include <MinSG/Helper/Helper.h>
+#include <MinSG/Helper/StdNodeVisitors.h>
+#include <MinSG/SceneManagement/ExportFunctions.h>
+#include <MinSG/SceneManagement/ImportFunctions.h>
+#include <MinSG/SceneManagement/SceneManager.h>
+#include <Geometry/Box.h>
+#include <Geometry/Vec3.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/MeshUtils/MeshBuilder.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/FileUtils.h>
+#include <Util/IO/TemporaryDirectory.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_import_cache();
+
+static bool equalMeshes(Rendering::Mesh * a, Rendering::Mesh * b) {
+	if(a == nullptr || b == nullptr || !(a->getVertexDescription() == b->getVertexDescription()) ||
+			a->getDrawMode() != b->getDrawMode() || a->getVertexCount() != b->getVertexCount() || a->getIndexCount() != b->getIndexCount())
+		return false;
+	const Rendering::MeshVertexData & vertexDataA = a->openVertexData();
+	const Rendering::MeshVertexData & vertexDataB = b->openVertexData();
+	const Rendering::MeshIndexData & indexDataA = a->openIndexData();
+	const Rendering::MeshIndexData & indexDataB = b->openIndexData();
+	return std::equal(vertexDataA.data(), vertexDataA.data() + vertexDataA.dataSize(), vertexDataB.data()) &&
+			std::equal(indexDataA.data(), indexDataA.data() + indexDataA.getIndexCount(), indexDataB.data());
+}
+
+//! Save a list node with @p count GeometryNodes to the given file.
+static void saveScene(SceneManagement::SceneManager & sceneManager, const Util::FileName & fileName, uint32_t count, Rendering::Mesh * mesh, bool binary) {
+	Util::Reference<ListNode> root = new ListNode;
+	for(uint32_t i = 0; i < count; ++i) {
+		GeometryNode * geoNode = new GeometryNode(mesh);
+		geoNode->moveRel(Geometry::Vec3(static_cast<float>(i), 0, 0));
+		root->addChild(geoNode);
+	}
+	std::deque<Node *> nodes;
+	nodes.push_back(root.get());
+	if(binary)
+		SceneManagement::saveMinSGBinaryFile(sceneManager, fileName, nodes);
+	else
+		SceneManagement::saveMinSGFile(sceneManager, fileName, nodes);
+	MinSG::destroy(root.get());
+}
+
+int test_import_cache() {
+	std::cout << "Test import cache ... ";
+
+	Util::TemporaryDirectory tempDir("MinSGTest_ImportCache");
+	Util::FileName xmlFile = tempDir.getPath();
+	xmlFile.setFile("test_import_cache.minsg");
+
+	SceneManagement::SceneManager sceneManager;
+
+	Rendering::VertexDescription vertexDesc;
+	vertexDesc.appendPosition3D();
+	vertexDesc.appendNormalFloat();
+	Util::Reference<Rendering::Mesh> boxMesh = Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc, Geometry::Box(Geometry::Vec3f(0.5f, 0.5f, 0.5f), 1));
+
+	const uint32_t count = 1000;
+	saveScene(sceneManager, xmlFile, count, boxMesh.get(), false);
+
+	SceneManagement::setImportCacheDirectory(Util::FileName::createDirName(tempDir.getPath().getDir() + "cache"));
+	const auto cacheFile = SceneManagement::getImportCacheFile(xmlFile, SceneManagement::IMPORT_OPTION_USE_IMPORT_CACHE);
+
+	// the first import creates the cache file
+	Util::Timer timer;
+	timer.reset();
+	const auto nodes = SceneManagement::loadMinSGFile(sceneManager, xmlFile, SceneManagement::IMPORT_OPTION_USE_IMPORT_CACHE);
+	const double xmlTime = timer.getMilliseconds();
+	if(!Util::FileUtils::isFile(cacheFile)) {
+		std::cout << "The import cache file has not been created." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// the second import restores the nodes from the cache file
+	timer.reset();
+	const auto cachedNodes = SceneManagement::loadMinSGFile(sceneManager, xmlFile, SceneManagement::IMPORT_OPTION_USE_IMPORT_CACHE);
+	const double cacheTime = timer.getMilliseconds();
+	if(nodes.size() != 1 || cachedNodes.size() != 1) {
+		std::cout << "Wrong number of loaded nodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	const auto geoNodes = collectNodes<GeometryNode>(nodes.front().get());
+	const auto cachedGeoNodes = collectNodes<GeometryNode>(cachedNodes.front().get());
+	if(geoNodes.size() != count || cachedGeoNodes.size() != count) {
+		std::cout << "Wrong number of GeometryNodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	for(uint32_t i = 0; i < count; ++i) {
+		if(!(cachedGeoNodes[i]->getRelOrigin() == geoNodes[i]->getRelOrigin()) || !equalMeshes(cachedGeoNodes[i]->getMesh(), geoNodes[i]->getMesh()) ||
+				!equalMeshes(cachedGeoNodes[i]->getMesh(), boxMesh.get())) {
+			std::cout << "The node " << i << " restored from the import cache differs from the imported node." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	MinSG::destroy(nodes.front().get());
+	MinSG::destroy(cachedNodes.front().get());
+
+	// the nodes are restored from the cache file without reading the scene file
+	saveScene(sceneManager, cacheFile, 1, boxMesh.get(), true);
+	{
+		const auto replacedNodes = SceneManagement::loadMinSGFile(sceneManager, xmlFile, SceneManagement::IMPORT_OPTION_USE_IMPORT_CACHE);
+		if(replacedNodes.size() != 1 || collectNodes<GeometryNode>(replacedNodes.front().get()).size() != 1) {
+			std::cout << "The nodes have not been restored from the import cache." << std::endl;
+			return EXIT_FAILURE;
+		}
+		MinSG::destroy(replacedNodes.front().get());
+	}
+
+	// writing the same content again keeps the cache file
+	Util::FileUtils::saveFile(xmlFile, Util::FileUtils::loadFile(xmlFile));
+	if(SceneManagement::getImportCacheFile(xmlFile, SceneManagement::IMPORT_OPTION_USE_IMPORT_CACHE).getPath() != cacheFile.getPath()) {
+		std::cout << "The import cache file has been changed without changing the content of the scene file." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// changing the scene file invalidates the cache file
+	saveScene(sceneManager, xmlFile, count / 2, boxMesh.get(), false);
+	const auto changedCacheFile = SceneManagement::getImportCacheFile(xmlFile, SceneManagement::IMPORT_OPTION_USE_IMPORT_CACHE);
+	if(changedCacheFile.getPath() == cacheFile.getPath()) {
+		std::cout << "The import cache file has not been changed with the scene file." << std::endl;
+		return EXIT_FAILURE;
+	}
+	{
+		const auto changedNodes = SceneManagement::loadMinSGFile(sceneManager, xmlFile, SceneManagement::IMPORT_OPTION_USE_IMPORT_CACHE);
+		if(changedNodes.size() != 1 || collectNodes<GeometryNode>(changedNodes.front().get()).size() != count / 2 ||
+				!Util::FileUtils::isFile(changedCacheFile)) {
+			std::cout << "The changed scene file has not been imported." << std::endl;
+			return EXIT_FAILURE;
+		}
+		MinSG::destroy(changedNodes.front().get());
+	}
+
+	SceneManagement::setImportCacheDirectory(Util::FileName());
+
+	std::cout << "done (XML: " << xmlTime << " ms, import cache: " << cacheTime << " ms).\n";
+	return EXIT_SUCCESS;
+}
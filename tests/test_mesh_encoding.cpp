@@ -0,0 +1,200 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Helper/Helper.h>
+#include <MinSG/SceneManagement/ExportFunctions.h>
+#include <MinSG/SceneManagement/ImportFunctions.h>
+#include <MinSG/SceneManagement/MeshEncoding.h>
+#include <MinSG/SceneManagement/MeshHashing.h>
+#include <MinSG/SceneManagement/SceneManager.h>
+#include <Geometry/Box.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/FileUtils.h>
+#include <Util/IO/TemporaryDirectory.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_mesh_encoding();
+
+//! Create a height field of @p size x @p size vertices with positions and normals.
+static Rendering::Mesh * createHeightField(uint32_t size) {
+	Rendering::VertexDescription vertexDesc;
+	vertexDesc.appendPosition3D();
+	vertexDesc.appendNormalFloat();
+	Util::Reference<Rendering::Mesh> mesh = new Rendering::Mesh(vertexDesc, size * size, 6 * (size - 1) * (size - 1));
+
+	Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+	const std::size_t vertexSize = vertexDesc.getVertexSize();
+	for(uint32_t z = 0; z < size; ++z) {
+		for(uint32_t x = 0; x < size; ++x) {
+			const float fx = static_cast<float>(x) * 0.1f;
+			const float fz = static_cast<float>(z) * 0.1f;
+			float nx = -std::cos(fx) * std::cos(fz);
+			float ny = 1.0f;
+			float nz = std::sin(fx) * std::sin(fz);
+			const float length = std::sqrt(nx * nx + ny * ny + nz * nz);
+			const float vertex[6] = {fx, std::sin(fx) * std::cos(fz), fz, nx / length, ny / length, nz / length};
+			std::memcpy(vertexData.data() + (z * size + x) * vertexSize, vertex, sizeof(vertex));
+		}
+	}
+	vertexData.markAsChanged();
+	vertexData.updateBoundingBox();
+
+	Rendering::MeshIndexData & indexData = mesh->openIndexData();
+	uint32_t * indices = indexData.data();
+	for(uint32_t z = 0; z + 1 < size; ++z) {
+		for(uint32_t x = 0; x + 1 < size; ++x) {
+			const uint32_t v = z * size + x;
+			const uint32_t quad[6] = {v, v + size, v + 1, v + 1, v + size, v + size + 1};
+			std::memcpy(indices, quad, sizeof(quad));
+			indices += 6;
+		}
+	}
+	indexData.markAsChanged();
+	return mesh.detachAndDecrease();
+}
+
+//! Return true if the indices are smaller than the number of vertices and the stored index range is correct.
+static bool hasValidIndexRange(Rendering::Mesh * mesh) {
+	const Rendering::MeshIndexData & indexData = mesh->openIndexData();
+	if(indexData.getIndexCount() == 0)
+		return true;
+	const auto minMax = std::minmax_element(indexData.data(), indexData.data() + indexData.getIndexCount());
+	return *minMax.second < mesh->getVertexCount() && indexData.getMinIndex() == *minMax.first && indexData.getMaxIndex() == *minMax.second;
+}
+
+/*! Return true if the quantized mesh has the same indices as the height field and its positions
+	and normals differ only by the quantization error.	*/
+static bool hasSimilarVertices(Rendering::Mesh * mesh, Rendering::Mesh * quantizedMesh) {
+	if(quantizedMesh->getVertexCount() != mesh->getVertexCount() || quantizedMesh->getIndexCount() != mesh->getIndexCount() ||
+			!(quantizedMesh->getVertexDescription() == mesh->getVertexDescription()) ||
+			std::memcmp(quantizedMesh->openIndexData().data(), mesh->openIndexData().data(), mesh->getIndexCount() * sizeof(uint32_t)) != 0)
+		return false;
+	const Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+	const Rendering::MeshVertexData & quantizedVertexData = quantizedMesh->openVertexData();
+	const std::size_t vertexSize = mesh->getVertexDescription().getVertexSize();
+	for(uint32_t v = 0; v < mesh->getVertexCount(); ++v) {
+		float vertex[6];
+		float quantizedVertex[6];
+		std::memcpy(vertex, vertexData.data() + v * vertexSize, sizeof(vertex));
+		std::memcpy(quantizedVertex, quantizedVertexData.data() + v * vertexSize, sizeof(quantizedVertex));
+		// 16 bits per position component for an extent of 20 units; 16-bit octahedral normals
+		for(uint32_t i = 0; i < 6; ++i) {
+			if(std::abs(vertex[i] - quantizedVertex[i]) > 1.0e-3f)
+				return false;
+		}
+	}
+	return true;
+}
+
+int test_mesh_encoding() {
+	std::cout << "Test compressed mesh encoding ... ";
+
+	{	// general-purpose compression
+		std::mt19937 engine(42);
+		std::vector<uint8_t> data(100000);
+		for(std::size_t i = 0; i < data.size(); ++i)
+			data[i] = i % 3 == 0 ? static_cast<uint8_t>(engine()) : static_cast<uint8_t>(i / 1000);
+		const auto compressed = SceneManagement::MeshEncoding::compress(data.data(), data.size());
+		std::vector<uint8_t> decompressed;
+		if(!SceneManagement::MeshEncoding::decompress(compressed.data(), compressed.size(), data.size(), decompressed) || decompressed != data) {
+			std::cout << "Compression round trip failed." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(SceneManagement::MeshEncoding::decompress(compressed.data(), compressed.size() / 2, data.size(), decompressed)) {
+			std::cout << "Truncated data has not been detected." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	Util::TemporaryDirectory tempDir("MinSGTest_MeshEncoding");
+	SceneManagement::SceneManager sceneManager;
+
+	Util::Reference<Rendering::Mesh> mesh = createHeightField(200);
+	Util::Reference<GeometryNode> geoNode = new GeometryNode(mesh);
+	const std::deque<Node *> nodes(1, geoNode.get());
+
+	struct Variant {
+		const char * fileName;
+		SceneManagement::exportOption_t exportOptions;
+		double size;
+		double loadTime;
+	};
+	std::vector<Variant> variants = {
+		{"plain.minsg", SceneManagement::EXPORT_OPTION_NONE, 0, 0},
+		{"compressed.minsg", SceneManagement::EXPORT_OPTION_COMPRESS_MESHES, 0, 0},
+		{"quantized.minsg", SceneManagement::EXPORT_OPTION_QUANTIZE_MESHES, 0, 0}
+	};
+	for(auto & variant : variants) {
+		Util::FileName sceneFile = tempDir.getPath();
+		sceneFile.setFile(variant.fileName);
+		SceneManagement::saveMinSGFile(sceneManager, sceneFile, nodes, variant.exportOptions);
+		variant.size = static_cast<double>(Util::FileUtils::fileSize(sceneFile));
+
+		Util::Timer timer;
+		timer.reset();
+		const auto loadedNodes = SceneManagement::loadMinSGFile(sceneManager, sceneFile);
+		variant.loadTime = timer.getMilliseconds();
+		auto loadedGeoNode = loadedNodes.size() == 1 ? dynamic_cast<GeometryNode *>(loadedNodes.front().get()) : nullptr;
+		if(loadedGeoNode == nullptr || loadedGeoNode->getMesh() == nullptr) {
+			std::cout << "Loading " << variant.fileName << " failed." << std::endl;
+			return EXIT_FAILURE;
+		}
+		Rendering::Mesh * loadedMesh = loadedGeoNode->getMesh();
+		if(variant.exportOptions != SceneManagement::EXPORT_OPTION_QUANTIZE_MESHES) {
+			if(!SceneManagement::MeshHashing::equalData(mesh.get(), loadedMesh)) {
+				std::cout << "The mesh of " << variant.fileName << " differs." << std::endl;
+				return EXIT_FAILURE;
+			}
+		} else if(!hasSimilarVertices(mesh.get(), loadedMesh)) {
+			std::cout << "The quantized mesh differs too much." << std::endl;
+			return EXIT_FAILURE;
+		}
+		const Geometry::Box box = mesh->getBoundingBox();
+		const Geometry::Box loadedBox = loadedMesh->getBoundingBox();
+		for(uint8_t i = 0; i < 3; ++i) {
+			const auto dim = static_cast<Geometry::dimension_t>(i);
+			if(std::abs(box.getMin(dim) - loadedBox.getMin(dim)) > 1.0e-3f || std::abs(box.getMax(dim) - loadedBox.getMax(dim)) > 1.0e-3f) {
+				std::cout << "The bounding box of the mesh of " << variant.fileName << " is wrong." << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		if(!hasValidIndexRange(loadedMesh)) {
+			std::cout << "The index range of the mesh of " << variant.fileName << " is wrong." << std::endl;
+			return EXIT_FAILURE;
+		}
+		MinSG::destroy(loadedGeoNode);
+	}
+
+	if(variants[1].size >= variants[0].size || variants[2].size * 4 > variants[0].size) {
+		std::cout << "The encoded meshes are too large (" << variants[0].size << ", " << variants[1].size << ", " << variants[2].size << " bytes)." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "done (";
+	for(std::size_t i = 0; i < variants.size(); ++i)
+		std::cout << (i > 0 ? ", " : "") << variants[i].fileName << ": " << variants[i].size / 1024.0 << " KiB in " << variants[i].loadTime << " ms";
+	std::cout << ").\n";
+	return EXIT_SUCCESS;
+}
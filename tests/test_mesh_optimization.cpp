@@ -0,0 +1,188 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Helper/Helper.h>
+#include <MinSG/SceneManagement/ExportFunctions.h>
+#include <MinSG/SceneManagement/ImportFunctions.h>
+#include <MinSG/SceneManagement/Importer/ImportContext.h>
+#include <MinSG/SceneManagement/MeshOptimization.h>
+#include <MinSG/SceneManagement/SceneManager.h>
+#include <Geometry/Box.h>
+#include <Geometry/Vec3.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/TemporaryDirectory.h>
+#include <Util/References.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_mesh_optimization();
+
+/*! Create a height field of @p size x @p size vertices, where every quad has its own four
+	vertices and the triangles are in random order.	*/
+static Rendering::Mesh * createUnorderedHeightField(uint32_t size) {
+	Rendering::VertexDescription vertexDesc;
+	vertexDesc.appendPosition3D();
+	vertexDesc.appendNormalFloat();
+	const uint32_t quadCount = (size - 1) * (size - 1);
+	Util::Reference<Rendering::Mesh> mesh = new Rendering::Mesh(vertexDesc, 4 * quadCount, 6 * quadCount);
+
+	Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+	std::vector<uint32_t> triangles;
+	triangles.reserve(6 * quadCount);
+	uint32_t vertex = 0;
+	for(uint32_t z = 0; z + 1 < size; ++z) {
+		for(uint32_t x = 0; x + 1 < size; ++x) {
+			for(uint32_t corner = 0; corner < 4; ++corner) {
+				const float fx = static_cast<float>(x + corner % 2) * 0.1f;
+				const float fz = static_cast<float>(z + corner / 2) * 0.1f;
+				const float data[6] = {fx, std::sin(fx) * std::cos(fz), fz, 0.0f, 1.0f, 0.0f};
+				std::memcpy(vertexData.data() + (vertex + corner) * sizeof(data), data, sizeof(data));
+			}
+			const uint32_t quad[6] = {vertex, vertex + 2, vertex + 1, vertex + 1, vertex + 2, vertex + 3};
+			triangles.insert(triangles.end(), quad, quad + 6);
+			vertex += 4;
+		}
+	}
+	vertexData.markAsChanged();
+	vertexData.updateBoundingBox();
+
+	std::vector<uint32_t> order(2 * quadCount);
+	for(uint32_t i = 0; i < order.size(); ++i)
+		order[i] = i;
+	std::shuffle(order.begin(), order.end(), std::mt19937(42));
+	Rendering::MeshIndexData & indexData = mesh->openIndexData();
+	for(uint32_t i = 0; i < order.size(); ++i)
+		std::copy(triangles.begin() + order[i] * 3, triangles.begin() + order[i] * 3 + 3, indexData.data() + i * 3);
+	indexData.markAsChanged();
+	return mesh.detachAndDecrease();
+}
+
+//! Return true if the indices are smaller than the number of vertices and the stored index range is correct.
+static bool hasValidIndexRange(Rendering::Mesh * mesh) {
+	const Rendering::MeshIndexData & indexData = mesh->openIndexData();
+	if(indexData.getIndexCount() == 0)
+		return true;
+	const auto minMax = std::minmax_element(indexData.data(), indexData.data() + indexData.getIndexCount());
+	return *minMax.second < mesh->getVertexCount() && indexData.getMinIndex() == *minMax.first && indexData.getMaxIndex() == *minMax.second;
+}
+
+//! Return true if the stored bounding box of the mesh matches the positions of its vertices.
+static bool hasValidBoundingBox(Rendering::Mesh * mesh) {
+	const Rendering::MeshVertexData & vertexData = mesh->openVertexData();
+	const std::size_t vertexSize = mesh->getVertexDescription().getVertexSize();
+	Geometry::Box box;
+	box.invalidate();
+	for(uint32_t v = 0; v < mesh->getVertexCount(); ++v) {
+		float position[3];
+		std::memcpy(position, vertexData.data() + v * vertexSize, sizeof(position));
+		box.include(Geometry::Vec3(position[0], position[1], position[2]));
+	}
+	return box == mesh->getBoundingBox();
+}
+
+int test_mesh_optimization() {
+	std::cout << "Test mesh optimization ... ";
+
+	Util::TemporaryDirectory tempDir("MinSGTest_MeshOptimization");
+	Util::FileName sceneFile = tempDir.getPath();
+	sceneFile.setFile("unordered.minsg");
+	Util::FileName optimizedFile = tempDir.getPath();
+	optimizedFile.setFile("optimized.minsg");
+
+	SceneManagement::SceneManager sceneManager;
+
+	const uint32_t size = 100;
+	Util::Reference<Rendering::Mesh> mesh = createUnorderedHeightField(size);
+	const float originalACMR = SceneManagement::MeshOptimization::calculateACMR(mesh.get());
+	Util::Reference<GeometryNode> geoNode = new GeometryNode(mesh);
+	SceneManagement::saveMinSGFile(sceneManager, sceneFile, std::deque<Node *>(1, geoNode.get()));
+
+	auto importContext = SceneManagement::createImportContext(sceneManager, SceneManagement::IMPORT_OPTION_OPTIMIZE_MESHES);
+	const auto loadedNodes = SceneManagement::loadMinSGFile(importContext, sceneFile);
+	auto loadedGeoNode = loadedNodes.size() == 1 ? dynamic_cast<GeometryNode *>(loadedNodes.front().get()) : nullptr;
+	if(loadedGeoNode == nullptr || loadedGeoNode->getMesh() == nullptr || importContext.getOptimizedMeshes().size() != 1 ||
+			importContext.getOptimizedMeshes().front().mesh.get() != loadedGeoNode->getMesh()) {
+		std::cout << "The mesh has not been optimized." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Rendering::Mesh * optimizedMesh = loadedGeoNode->getMesh();
+	const auto & result = importContext.getOptimizedMeshes().front().result;
+	if(result.vertexCountBefore != mesh->getVertexCount() || result.vertexCountAfter != size * size ||
+			optimizedMesh->getVertexCount() != size * size || optimizedMesh->getIndexCount() != mesh->getIndexCount() ||
+			!(optimizedMesh->getBoundingBox() == mesh->getBoundingBox())) {
+		std::cout << "The duplicate vertices have not been merged correctly." << std::endl;
+		return EXIT_FAILURE;
+	}
+	if(!hasValidIndexRange(optimizedMesh) || !hasValidBoundingBox(optimizedMesh)) {
+		std::cout << "The index range or the bounding box of the optimized mesh is wrong." << std::endl;
+		return EXIT_FAILURE;
+	}
+	// a regular grid can reach an ACMR below 0.7 with a cache of 16 entries
+	if(std::abs(result.acmrBefore - originalACMR) > 1.0e-5f || result.acmrAfter > 0.7f ||
+			std::abs(SceneManagement::MeshOptimization::calculateACMR(optimizedMesh) - result.acmrAfter) > 1.0e-5f) {
+		std::cout << "Wrong ACMR: " << result.acmrBefore << " -> " << result.acmrAfter << std::endl;
+		return EXIT_FAILURE;
+	}
+	{	// vertex fetch order: the vertices are used in ascending order
+		const Rendering::MeshIndexData & indexData = optimizedMesh->openIndexData();
+		const uint32_t * indices = indexData.data();
+		uint32_t nextVertex = 0;
+		for(uint32_t i = 0; i < indexData.getIndexCount(); ++i) {
+			if(indices[i] > nextVertex) {
+				std::cout << "The vertices are not ordered by their first use." << std::endl;
+				return EXIT_FAILURE;
+			}
+			if(indices[i] == nextVertex)
+				++nextVertex;
+		}
+	}
+
+	// the optimized mesh is stored when exporting
+	SceneManagement::saveMinSGFile(sceneManager, optimizedFile, std::deque<Node *>(1, loadedGeoNode));
+	const auto reloadedNodes = SceneManagement::loadMinSGFile(sceneManager, optimizedFile);
+	auto reloadedGeoNode = reloadedNodes.size() == 1 ? dynamic_cast<GeometryNode *>(reloadedNodes.front().get()) : nullptr;
+	if(reloadedGeoNode == nullptr || reloadedGeoNode->getMesh() == nullptr ||
+			reloadedGeoNode->getMesh()->getVertexCount() != size * size ||
+			std::abs(SceneManagement::MeshOptimization::calculateACMR(reloadedGeoNode->getMesh()) - result.acmrAfter) > 1.0e-5f ||
+			!hasValidIndexRange(reloadedGeoNode->getMesh()) || !hasValidBoundingBox(reloadedGeoNode->getMesh())) {
+		std::cout << "The optimized mesh has not been exported." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// a further import with the same context only optimizes the new mesh
+	const auto secondNodes = SceneManagement::loadMinSGFile(importContext, sceneFile);
+	auto secondGeoNode = secondNodes.size() == 1 ? dynamic_cast<GeometryNode *>(secondNodes.front().get()) : nullptr;
+	if(secondGeoNode == nullptr || secondGeoNode->getMesh() == optimizedMesh || importContext.getOptimizedMeshes().size() != 2 ||
+			importContext.getOptimizedMeshes().back().mesh.get() != secondGeoNode->getMesh()) {
+		std::cout << "The mesh of the second import has not been optimized." << std::endl;
+		return EXIT_FAILURE;
+	}
+	MinSG::destroy(secondGeoNode);
+
+	MinSG::destroy(reloadedGeoNode);
+	MinSG::destroy(loadedGeoNode);
+	MinSG::destroy(geoNode.get());
+
+	std::cout << "done (ACMR " << result.acmrBefore << " -> " << result.acmrAfter << ").\n";
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/ListNode.h>
+#include <MinSG/Helper/Helper.h>
+#include <MinSG/Helper/StdNodeVisitors.h>
+#include <MinSG/SceneManagement/ExportFunctions.h>
+#include <MinSG/SceneManagement/ImportFunctions.h>
+#include <MinSG/SceneManagement/MeshHashing.h>
+#include <MinSG/SceneManagement/SceneManager.h>
+#include <Geometry/Box.h>
+#include <Geometry/Vec3.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/MeshUtils/MeshBuilder.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/FileUtils.h>
+#include <Util/IO/TemporaryDirectory.h>
+#include <Util/References.h>
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_mesh_sharing();
+
+static bool equalMeshes(Rendering::Mesh * a, Rendering::Mesh * b) {
+	if(a == nullptr || b == nullptr || !(a->getVertexDescription() == b->getVertexDescription()) ||
+			a->getDrawMode() != b->getDrawMode() || a->getVertexCount() != b->getVertexCount() || a->getIndexCount() != b->getIndexCount())
+		return false;
+	const Rendering::MeshVertexData & vertexDataA = a->openVertexData();
+	const Rendering::MeshVertexData & vertexDataB = b->openVertexData();
+	const Rendering::MeshIndexData & indexDataA = a->openIndexData();
+	const Rendering::MeshIndexData & indexDataB = b->openIndexData();
+	return std::equal(vertexDataA.data(), vertexDataA.data() + vertexDataA.dataSize(), vertexDataB.data()) &&
+			std::equal(indexDataA.data(), indexDataA.data() + indexDataA.getIndexCount(), indexDataB.data());
+}
+
+int test_mesh_sharing() {
+	std::cout << "Test sharing of equal meshes ... ";
+
+	Util::TemporaryDirectory tempDir("MinSGTest_MeshSharing");
+	Util::FileName binaryFile = tempDir.getPath();
+	binaryFile.setFile("test_mesh_sharing.msgb");
+	Util::FileName xmlFile = tempDir.getPath();
+	xmlFile.setFile("test_mesh_sharing.minsg");
+	Util::FileName sharedBinaryFile = tempDir.getPath();
+	sharedBinaryFile.setFile("test_mesh_sharing_shared.msgb");
+	Util::FileName sharedXmlFile = tempDir.getPath();
+	sharedXmlFile.setFile("test_mesh_sharing_shared.minsg");
+
+	SceneManagement::SceneManager sceneManager;
+
+	Rendering::VertexDescription vertexDesc;
+	vertexDesc.appendPosition3D();
+	vertexDesc.appendNormalFloat();
+	Util::Reference<Rendering::Mesh> boxMesh = Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc, Geometry::Box(Geometry::Vec3f(0.5f, 0.5f, 0.5f), 1));
+	Util::Reference<Rendering::Mesh> largeBoxMesh = Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc, Geometry::Box(Geometry::Vec3f(0.0f, 0.0f, 0.0f), 4));
+
+	{	// content hashes
+		Util::Reference<Rendering::Mesh> boxMeshCopy = Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc, Geometry::Box(Geometry::Vec3f(0.5f, 0.5f, 0.5f), 1));
+		if(SceneManagement::MeshHashing::calculateHash(boxMesh.get()) != SceneManagement::MeshHashing::calculateHash(boxMeshCopy.get()) ||
+				!SceneManagement::MeshHashing::equalData(boxMesh.get(), boxMeshCopy.get()) ||
+				SceneManagement::MeshHashing::calculateHash(boxMesh.get()) == SceneManagement::MeshHashing::calculateHash(largeBoxMesh.get()) ||
+				SceneManagement::MeshHashing::equalData(boxMesh.get(), largeBoxMesh.get())) {
+			std::cout << "Wrong mesh content hash." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	// ----- EXPORT -----
+	// every node has its own copy of the mesh data
+	const uint32_t count = 1000;
+	{
+		Util::Reference<ListNode> root = new ListNode;
+		for(uint32_t i = 0; i < count; ++i) {
+			GeometryNode * geoNode = new GeometryNode((i % 10 == 0 ? largeBoxMesh : boxMesh)->clone());
+			geoNode->moveRel(Geometry::Vec3(static_cast<float>(i), 0, 0));
+			root->addChild(geoNode);
+		}
+		std::deque<Node *> nodes;
+		nodes.push_back(root.get());
+		SceneManagement::saveMinSGBinaryFile(sceneManager, binaryFile, nodes);
+		SceneManagement::saveMinSGFile(sceneManager, xmlFile, nodes);
+		SceneManagement::saveMinSGBinaryFile(sceneManager, sharedBinaryFile, nodes, SceneManagement::EXPORT_OPTION_SHARE_EQUAL_MESHES);
+		SceneManagement::saveMinSGFile(sceneManager, sharedXmlFile, nodes, SceneManagement::EXPORT_OPTION_SHARE_EQUAL_MESHES);
+		MinSG::destroy(root.get());
+	}
+	if(Util::FileUtils::fileSize(sharedXmlFile) * 2 > Util::FileUtils::fileSize(xmlFile) ||
+			Util::FileUtils::fileSize(sharedBinaryFile) * 2 > Util::FileUtils::fileSize(binaryFile)) {
+		std::cout << "The equal meshes have not been shared during the export." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// ----- IMPORT -----
+	const auto sharedXmlNodes = SceneManagement::loadMinSGFile(sceneManager, sharedXmlFile);
+	const auto sharedBinaryNodes = SceneManagement::loadMinSGFile(sceneManager, sharedBinaryFile);
+	if(sharedXmlNodes.size() != 1 || sharedBinaryNodes.size() != 1) {
+		std::cout << "Wrong number of loaded nodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	const auto sharedXmlGeoNodes = collectNodes<GeometryNode>(sharedXmlNodes.front().get());
+	const auto sharedBinaryGeoNodes = collectNodes<GeometryNode>(sharedBinaryNodes.front().get());
+	if(sharedXmlGeoNodes.size() != count || sharedBinaryGeoNodes.size() != count) {
+		std::cout << "Wrong number of GeometryNodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	for(uint32_t i = 0; i < count; ++i) {
+		Rendering::Mesh * exportedMesh = i % 10 == 0 ? largeBoxMesh.get() : boxMesh.get();
+		if(!(sharedXmlGeoNodes[i]->getRelOrigin() == Geometry::Vec3(static_cast<float>(i), 0, 0)) ||
+				!(sharedBinaryGeoNodes[i]->getRelOrigin() == Geometry::Vec3(static_cast<float>(i), 0, 0))) {
+			std::cout << "The node " << i << " differs from the exported node." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(!equalMeshes(sharedXmlGeoNodes[i]->getMesh(), exportedMesh) || !equalMeshes(sharedBinaryGeoNodes[i]->getMesh(), exportedMesh)) {
+			std::cout << "The shared mesh of the node " << i << " differs from the exported mesh." << std::endl;
+			return EXIT_FAILURE;
+		}
+		// every mesh is stored and created only once
+		if(sharedXmlGeoNodes[i]->getMesh() != sharedXmlGeoNodes[i % 10 == 0 ? 0 : 1]->getMesh() ||
+				sharedBinaryGeoNodes[i]->getMesh() != sharedBinaryGeoNodes[i % 10 == 0 ? 0 : 1]->getMesh()) {
+			std::cout << "A shared mesh has been loaded several times." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	MinSG::destroy(sharedXmlNodes.front().get());
+	MinSG::destroy(sharedBinaryNodes.front().get());
+
+	std::cout << "done (XML: " << Util::FileUtils::fileSize(xmlFile) << " -> " << Util::FileUtils::fileSize(sharedXmlFile) << " bytes, "
+				<< "binary: " << Util::FileUtils::fileSize(binaryFile) << " -> " << Util::FileUtils::fileSize(sharedBinaryFile) << " bytes).\n";
+	return EXIT_SUCCESS;
+}
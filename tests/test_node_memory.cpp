@@ -11,10 +11,13 @@
 #include <MinSG/Core/Nodes/Node.h>
 #include <MinSG/Core/States/MaterialState.h>
 #include <MinSG/Core/FrameContext.h>
+#include <MinSG/Core/NodeMemoryPool.h>
 #include <MinSG/Core/RenderParam.h>
 #include <MinSG/Helper/Helper.h>
 #include <MinSG/Helper/StdNodeVisitors.h>
 #include <MinSG/SceneManagement/SceneManager.h>
+#include <Geometry/Box.h>
+#include <Geometry/Matrix4x4.h>
 #include <Geometry/Vec3.h>
 #include <Rendering/Mesh/Mesh.h>
 #include <Rendering/MeshUtils/MeshBuilder.h>
@@ -34,7 +37,67 @@
 
 using namespace MinSG;
 
+/**
+ * Create a tree of transformed GeometryNodes and ListNodes and output the
+ * number of bytes and heap allocations per node.
+ * @return @c false if the memory usage reported by the nodes or the pools is wrong.
+ */
+static bool measureNodeCreation(bool usePools, uint32_t count) {
+	const NodeMemoryPool::Scope poolScope(usePools);
+	const double memoryBefore = Util::Utils::getResidentSetMemorySize();
+	const auto statsBefore = NodeMemoryPool::getStatistics();
+
+	Util::Reference<ListNode> root = new ListNode;
+	ListNode * inner = nullptr;
+	for(uint32_t i = 0; i < count; ++i) {
+		if(i % 100 == 0) {
+			inner = new ListNode;
+			root->addChild(inner);
+		}
+		GeometryNode * geoNode = new GeometryNode;
+		geoNode->moveRel(Geometry::Vec3(i, 0, 0)); // creates the relative transformation
+		inner->addChild(geoNode);
+		geoNode->getWorldBB(); // creates the world location
+	}
+	const uint32_t nodeCount = count + count / 100 + 1;
+
+	const auto stats = NodeMemoryPool::getStatistics();
+	const double bytesPerNode = (Util::Utils::getResidentSetMemorySize() - memoryBefore) / nodeCount;
+	const double allocationsPerNode = static_cast<double>(stats.heapAllocations - statsBefore.heapAllocations) / nodeCount;
+	std::cerr << (usePools ? "with" : "without") << " pools: "
+				<< Util::StringUtils::toFormattedString(bytesPerNode) << " bytes per node, "
+				<< allocationsPerNode << " allocations per node";
+	if(usePools)
+		std::cerr << ", pool occupancy " << stats.usedBytes << " / " << stats.reservedBytes << " bytes";
+	std::cerr << "\n";
+
+	// The memory usage of a node includes the headers of its blocks.
+	const Node * geoNode = inner->getChild(0);
+	const size_t minimumUsage = sizeof(GeometryNode) + 2 * sizeof(Geometry::Matrix4x4) + sizeof(Geometry::Box);
+	bool success = geoNode->getMemoryUsage() > minimumUsage;
+	if(!success)
+		std::cout << "The memory usage of a node is too small.\n";
+	if(usePools && (stats.usedBlocks - statsBefore.usedBlocks < 3 * count || stats.heapAllocations - statsBefore.heapAllocations != stats.chunkCount - statsBefore.chunkCount)) {
+		std::cout << "The pools have not been used for all nodes.\n";
+		success = false;
+	}
+
+	MinSG::destroy(root.get());
+	root = nullptr;
+	if(usePools) {
+		const auto statsAfter = NodeMemoryPool::getStatistics();
+		if(statsAfter.usedBlocks != statsBefore.usedBlocks || statsAfter.chunkCount == 0) {
+			std::cout << "The pools have not been emptied correctly.\n";
+			success = false;
+		}
+	}
+	return success;
+}
+
 int test_node_memory() {
+	if(!measureNodeCreation(false, 100000) || !measureNodeCreation(true, 100000))
+		return EXIT_FAILURE;
+
 	MinSG::FrameContext fc;
 	
 	Util::Reference<Rendering::Mesh> icosahedron = Rendering::MeshUtils::PlatonicSolids::createIcosahedron();
@@ -0,0 +1,188 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/ListNode.h>
+#include <MinSG/Core/NodeVisitor.h>
+#include <MinSG/Helper/Helper.h>
+#include <MinSG/Helper/NodeTraversal.h>
+#include <MinSG/Helper/StdNodeVisitors.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_node_traversal();
+
+static void createTree(ListNode * parent, uint32_t branching, uint32_t depth) {
+	std::vector<Util::Reference<Node>> children;
+	for(uint32_t i = 0; i < branching; ++i) {
+		if(depth == 0) {
+			children.push_back(new GeometryNode);
+		} else {
+			ListNode * inner = new ListNode;
+			createTree(inner, branching, depth - 1);
+			children.push_back(inner);
+		}
+	}
+	parent->addChildren(children);
+}
+
+//! Records the nodes in the order of a NodeVisitor traversal; the subtree of every third group is skipped.
+struct RecordingVisitor : public NodeVisitor {
+	std::vector<Node *> & entered;
+	std::vector<Node *> & left;
+	uint32_t groupCount;
+	RecordingVisitor(std::vector<Node *> & _entered, std::vector<Node *> & _left) : entered(_entered), left(_left), groupCount(0) {}
+	virtual ~RecordingVisitor() {}
+	NodeVisitor::status enter(Node * node) override {
+		entered.push_back(node);
+		if(dynamic_cast<GroupNode *>(node) != nullptr && (++groupCount % 3) == 0)
+			return BREAK_TRAVERSAL;
+		return CONTINUE_TRAVERSAL;
+	}
+	NodeVisitor::status leave(Node * node) override {
+		left.push_back(node);
+		return CONTINUE_TRAVERSAL;
+	}
+};
+
+int test_node_traversal() {
+	std::cout << "Test NodeTraversal ... ";
+
+	// same order and semantics as NodeVisitor
+	{
+		Util::Reference<ListNode> root = new ListNode;
+		createTree(root.get(), 3, 4);
+		std::vector<Node *> expectedEntered, expectedLeft, entered, left;
+		RecordingVisitor visitor(expectedEntered, expectedLeft);
+		root->traverse(visitor);
+		uint32_t groupCount = 0;
+		NodeTraversal::traverse(root.get(),
+								[&](Node * node) {
+									entered.push_back(node);
+									if(dynamic_cast<GroupNode *>(node) != nullptr && (++groupCount % 3) == 0)
+										return NodeVisitor::BREAK_TRAVERSAL;
+									return NodeVisitor::CONTINUE_TRAVERSAL;
+								},
+								[&](Node * node) {
+									left.push_back(node);
+									return NodeVisitor::CONTINUE_TRAVERSAL;
+								});
+		if(entered != expectedEntered || left != expectedLeft) {
+			std::cout << "The traversal order differs from Node::traverse()." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		// early exit
+		size_t count = 0;
+		const auto result = NodeTraversal::traverseTopDown(root.get(), [&count](Node *) {
+			return ++count == 10 ? NodeVisitor::EXIT_TRAVERSAL : NodeVisitor::CONTINUE_TRAVERSAL;
+		});
+		if(result != NodeVisitor::EXIT_TRAVERSAL || count != 10) {
+			std::cout << "The traversal has not been stopped." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		std::vector<Node *> bottomUp;
+		NodeTraversal::forEachNodeBottomUp<GeometryNode>(root.get(), [&bottomUp](GeometryNode * node) { bottomUp.push_back(node); });
+		std::vector<Node *> expectedBottomUp;
+		forEachNodeBottomUp<GeometryNode>(root.get(), [&expectedBottomUp](GeometryNode * node) { expectedBottomUp.push_back(node); });
+		if(bottomUp.size() != 81 || bottomUp != expectedBottomUp) {
+			std::cout << "Wrong bottom-up traversal." << std::endl;
+			return EXIT_FAILURE;
+		}
+		MinSG::destroy(root.get());
+	}
+
+	// deep hierarchy
+	{
+		const uint32_t depth = 5000;
+		Util::Reference<ListNode> root = new ListNode;
+		ListNode * current = root.get();
+		for(uint32_t i = 0; i < depth; ++i) {
+			ListNode * child = new ListNode;
+			current->addChild(child);
+			current = child;
+		}
+		size_t count = 0;
+		NodeTraversal::forEachNodeTopDown(root.get(), [&count](Node *) { ++count; });
+		if(count != depth + 1) {
+			std::cout << "Wrong number of nodes in the deep hierarchy." << std::endl;
+			return EXIT_FAILURE;
+		}
+		// release the chain bottom-up to avoid a deep recursion of destructors
+		while(current != root.get()) {
+			ListNode * parent = static_cast<ListNode *>(current->getParent());
+			current->removeFromParent();
+			current = parent;
+		}
+	}
+
+	// benchmark on a tree with 10^6 leaves
+	Util::Reference<ListNode> root = new ListNode;
+	createTree(root.get(), 10, 5);
+	const uint32_t repetitions = 5;
+	Util::Timer timer;
+	size_t expected = 0;
+
+	struct CountingVisitor : public NodeVisitor {
+		size_t count = 0;
+		virtual ~CountingVisitor() {}
+		NodeVisitor::status enter(Node *) override {
+			++count;
+			return CONTINUE_TRAVERSAL;
+		}
+	};
+	timer.reset();
+	for(uint32_t r = 0; r < repetitions; ++r) {
+		CountingVisitor visitor;
+		root->traverse(visitor);
+		expected = visitor.count;
+	}
+	const double visitorTime = timer.getMilliseconds() / repetitions;
+
+	size_t count = 0;
+	timer.reset();
+	for(uint32_t r = 0; r < repetitions; ++r) {
+		count = 0;
+		forEachNodeTopDown(root.get(), [&count](Node *) { ++count; });
+	}
+	const double functionTime = timer.getMilliseconds() / repetitions;
+	if(count != expected) {
+		std::cout << "forEachNodeTopDown visits a wrong number of nodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	NodeTraversal::Stack stack;
+	timer.reset();
+	for(uint32_t r = 0; r < repetitions; ++r) {
+		count = 0;
+		NodeTraversal::forEachNodeTopDown(root.get(), [&count](Node *) { ++count; }, stack);
+	}
+	const double templateTime = timer.getMilliseconds() / repetitions;
+	if(count != expected) {
+		std::cout << "NodeTraversal::forEachNodeTopDown visits a wrong number of nodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "\n\t" << expected << " nodes\n";
+	std::cout << "\tNodeVisitor (recursive):        " << visitorTime << " ms\n";
+	std::cout << "\tforEachNodeTopDown (std::function): " << functionTime << " ms\n";
+	std::cout << "\tNodeTraversal (template, reused stack): " << templateTime << " ms\n";
+
+	MinSG::destroy(root.get());
+	root = nullptr;
+
+	std::cout << "done.\n";
+	return EXIT_SUCCESS;
+}
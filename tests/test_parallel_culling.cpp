@@ -0,0 +1,114 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/CameraNode.h>
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/ListNode.h>
+#include <MinSG/Helper/Helper.h>
+#include <MinSG/Helper/ParallelCulling.h>
+#include <MinSG/Helper/StdNodeVisitors.h>
+#include <Geometry/Box.h>
+#include <Geometry/Rect.h>
+#include <Geometry/Frustum.h>
+#include <Geometry/Vec3.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_parallel_culling();
+
+//! Create a tree with @p branching children per inner node; the leaves are GeometryNodes with unit boxes.
+static void createTree(ListNode * parent, uint32_t branching, uint32_t depth, std::default_random_engine & engine) {
+	std::uniform_real_distribution<float> offsetDist(-50.0f, 50.0f);
+	for(uint32_t i = 0; i < branching; ++i) {
+		Node * child;
+		if(depth == 0) {
+			GeometryNode * leaf = new GeometryNode;
+			leaf->setFixedBB(Geometry::Box(-1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f));
+			child = leaf;
+		} else {
+			ListNode * inner = new ListNode;
+			createTree(inner, branching, depth - 1, engine);
+			child = inner;
+		}
+		child->moveRel(Geometry::Vec3(offsetDist(engine), offsetDist(engine), offsetDist(engine)) / static_cast<float>(4 - std::min(depth, 3u)));
+		parent->addChild(child);
+	}
+}
+
+int test_parallel_culling() {
+	std::cout << "Test parallel frustum culling ... ";
+
+	std::default_random_engine engine;
+	Util::Reference<ListNode> root = new ListNode;
+	createTree(root.get(), 8, 5, engine);
+
+	Util::Reference<CameraNode> camera = new CameraNode;
+	camera->setViewport(Geometry::Rect_i(0, 0, 1024, 768));
+	camera->setNearFar(0.1f, 300.0f);
+	camera->applyVerticalAngle(80);
+	camera->moveRel(Geometry::Vec3(0, 0, 150));
+	const Geometry::Frustum & frustum = camera->getFrustum();
+
+	const uint32_t repetitions = 10;
+	Util::Timer timer;
+
+	// reference: sequential visitor; the first run validates the world matrices and boxes
+	std::deque<GeometryNode *> expected = collectNodesInFrustum<GeometryNode>(root.get(), frustum);
+	timer.reset();
+	for(uint32_t r = 0; r < repetitions; ++r)
+		expected = collectNodesInFrustum<GeometryNode>(root.get(), frustum);
+	const double sequentialTime = timer.getMilliseconds() / repetitions;
+	if(expected.empty() || expected.size() == collectNodes<GeometryNode>(root.get()).size()) {
+		std::cout << "The frustum has to cull a part of the scene." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "\n\tsequential: " << sequentialTime << " ms (" << expected.size() << " nodes)\n";
+	for(uint32_t splitDepth = 0; splitDepth <= 4; splitDepth += 2) {
+		ParallelCullingParameters parameters;
+		parameters.splitDepth = splitDepth;
+		std::vector<GeometryNode *> visible;
+		timer.reset();
+		for(uint32_t r = 0; r < repetitions; ++r)
+			visible = collectNodesInFrustumParallel<GeometryNode>(root.get(), frustum, parameters);
+		const double parallelTime = timer.getMilliseconds() / repetitions;
+		std::cout << "\tparallel (split depth " << splitDepth << "): " << parallelTime << " ms, speedup " << sequentialTime / parallelTime << "\n";
+		if(visible.size() != expected.size() || !std::equal(visible.begin(), visible.end(), expected.begin())) {
+			std::cout << "The parallel result differs from the sequential result." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	ParallelCullingParameters parameters;
+	parameters.sortFrontToBack = true;
+	const auto sorted = collectNodesInFrustumParallel<GeometryNode>(root.get(), frustum, parameters);
+	if(sorted.size() != expected.size()) {
+		std::cout << "Sorting changed the number of nodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	for(size_t i = 1; i < sorted.size(); ++i) {
+		if(sorted[i - 1]->getWorldBB().getDistanceSquared(frustum.getPos()) > sorted[i]->getWorldBB().getDistanceSquared(frustum.getPos())) {
+			std::cout << "The result is not sorted front to back." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	MinSG::destroy(root.get());
+	root = nullptr;
+
+	std::cout << "done.\n";
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/ListNode.h>
+#include <MinSG/Helper/Helper.h>
+#include <MinSG/Helper/StdNodeVisitors.h>
+#include <MinSG/SceneManagement/ExportFunctions.h>
+#include <MinSG/SceneManagement/ImportFunctions.h>
+#include <MinSG/SceneManagement/SceneManager.h>
+#include <Geometry/Box.h>
+#include <Geometry/Vec3.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/MeshIndexData.h>
+#include <Rendering/Mesh/MeshVertexData.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/MeshUtils/MeshBuilder.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/TemporaryDirectory.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_parallel_mesh_decoding();
+
+static bool equalMeshes(Rendering::Mesh * a, Rendering::Mesh * b) {
+	if(a == nullptr || b == nullptr || !(a->getVertexDescription() == b->getVertexDescription()) ||
+			a->getDrawMode() != b->getDrawMode() || a->getVertexCount() != b->getVertexCount() || a->getIndexCount() != b->getIndexCount())
+		return false;
+	const Rendering::MeshVertexData & vertexDataA = a->openVertexData();
+	const Rendering::MeshVertexData & vertexDataB = b->openVertexData();
+	const Rendering::MeshIndexData & indexDataA = a->openIndexData();
+	const Rendering::MeshIndexData & indexDataB = b->openIndexData();
+	return std::equal(vertexDataA.data(), vertexDataA.data() + vertexDataA.dataSize(), vertexDataB.data()) &&
+			std::equal(indexDataA.data(), indexDataA.data() + indexDataA.getIndexCount(), indexDataB.data());
+}
+
+int test_parallel_mesh_decoding() {
+	std::cout << "Test parallel mesh decoding ... ";
+
+	Util::TemporaryDirectory tempDir("MinSGTest_ParallelMeshDecoding");
+	Util::FileName xmlFile = tempDir.getPath();
+	xmlFile.setFile("test_parallel_mesh_decoding.minsg");
+
+	SceneManagement::SceneManager sceneManager;
+
+	Rendering::VertexDescription vertexDesc;
+	vertexDesc.appendPosition3D();
+	vertexDesc.appendNormalFloat();
+	Util::Reference<Rendering::Mesh> boxMesh = Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc, Geometry::Box(Geometry::Vec3f(0.5f, 0.5f, 0.5f), 1));
+	Util::Reference<Rendering::Mesh> largeBoxMesh = Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc, Geometry::Box(Geometry::Vec3f(0.0f, 0.0f, 0.0f), 4));
+
+	// every node has its own copy of the mesh data, which is stored as Base64 encoded block
+	const uint32_t count = 1000;
+	{
+		Util::Reference<ListNode> root = new ListNode;
+		for(uint32_t i = 0; i < count; ++i) {
+			GeometryNode * geoNode = new GeometryNode((i % 10 == 0 ? largeBoxMesh : boxMesh)->clone());
+			geoNode->moveRel(Geometry::Vec3(static_cast<float>(i), 0, 0));
+			root->addChild(geoNode);
+		}
+		std::deque<Node *> nodes;
+		nodes.push_back(root.get());
+		SceneManagement::saveMinSGFile(sceneManager, xmlFile, nodes);
+		MinSG::destroy(root.get());
+	}
+
+	Util::Timer timer;
+	timer.reset();
+	const auto loadedNodes = SceneManagement::loadMinSGFile(sceneManager, xmlFile);
+	const double loadTime = timer.getMilliseconds();
+	// the registry has to keep the first mesh of each kind, although the meshes are decoded in parallel
+	const auto hashedNodes = SceneManagement::loadMinSGFile(sceneManager, xmlFile, SceneManagement::IMPORT_OPTION_USE_MESH_HASHING_REGISTRY);
+	if(loadedNodes.size() != 1 || hashedNodes.size() != 1) {
+		std::cout << "Wrong number of loaded nodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	const auto geoNodes = collectNodes<GeometryNode>(loadedNodes.front().get());
+	const auto hashedGeoNodes = collectNodes<GeometryNode>(hashedNodes.front().get());
+	if(geoNodes.size() != count || hashedGeoNodes.size() != count) {
+		std::cout << "Wrong number of GeometryNodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	for(uint32_t i = 0; i < count; ++i) {
+		Rendering::Mesh * exportedMesh = i % 10 == 0 ? largeBoxMesh.get() : boxMesh.get();
+		// the meshes are assigned in the order of the nodes
+		if(!(geoNodes[i]->getRelOrigin() == Geometry::Vec3(static_cast<float>(i), 0, 0)) || !equalMeshes(geoNodes[i]->getMesh(), exportedMesh) ||
+				!equalMeshes(hashedGeoNodes[i]->getMesh(), exportedMesh)) {
+			std::cout << "The mesh of node " << i << " differs from the exported mesh." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(geoNodes[i]->getMesh() == geoNodes[i % 10 == 0 ? 0 : 1]->getMesh() && i > 1) {
+			std::cout << "Meshes have been shared without a registry." << std::endl;
+			return EXIT_FAILURE;
+		}
+		if(hashedGeoNodes[i]->getMesh() != hashedGeoNodes[i % 10 == 0 ? 0 : 1]->getMesh()) {
+			std::cout << "The mesh hashing registry has not shared the mesh of node " << i << "." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	MinSG::destroy(loadedNodes.front().get());
+	MinSG::destroy(hashedNodes.front().get());
+
+	std::cout << "done (" << loadTime << " ms).\n";
+	return EXIT_SUCCESS;
+}
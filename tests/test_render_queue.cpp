@@ -0,0 +1,85 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/ListNode.h>
+#include <MinSG/Core/States/MaterialState.h>
+#include <MinSG/Core/States/TextureState.h>
+#include <MinSG/Core/RenderQueue.h>
+#include <Geometry/Matrix4x4.h>
+#include <Util/References.h>
+#include <cstdlib>
+#include <iostream>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_render_queue();
+
+int test_render_queue() {
+	std::cout << "Test RenderQueue ... ";
+
+	Util::Reference<ListNode> root = new ListNode;
+	Util::Reference<MaterialState> materials[3] = {new MaterialState, new MaterialState, new MaterialState};
+	Util::Reference<TextureState> textures[2] = {new TextureState, new TextureState};
+
+	// Record the items like a traversal would do: the texture and the material change for every leaf.
+	const uint32_t itemCount = 60;
+	RenderQueue queue;
+	for(uint32_t i = 0; i < itemCount; ++i) {
+		GeometryNode * leaf = new GeometryNode;
+		root->addChild(leaf);
+		queue.pushState(textures[i % 2].get(), root.get());
+		queue.pushState(materials[i % 3].get(), leaf);
+		queue.addItem(nullptr, Geometry::Matrix4x4(), leaf, static_cast<float>(itemCount - i));
+		if(queue.popState(textures[i % 2].get(), root.get())) {
+			std::cout << "Only the topmost state may be popped." << std::endl;
+			return EXIT_FAILURE;
+		}
+		queue.popState(materials[i % 3].get(), leaf);
+		queue.popState(textures[i % 2].get(), root.get());
+	}
+	if(queue.getItemCount() != itemCount || queue.getStateStackSize() != 0) {
+		std::cout << "Wrong number of recorded items." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Unsorted, both states change between all items.
+	const size_t unsortedTransitions = queue.countStateTransitions();
+	if(unsortedTransitions != 2 + (itemCount - 1) * 4 + 2) {
+		std::cout << "Wrong number of state transitions before sorting: " << unsortedTransitions << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	queue.sort();
+
+	// Sorted, there is one run for each combination of texture and material.
+	const size_t sortedTransitions = queue.countStateTransitions();
+	if(sortedTransitions != 16) {
+		std::cout << "Wrong number of state transitions after sorting: " << sortedTransitions << std::endl;
+		return EXIT_FAILURE;
+	}
+	for(size_t i = 1; i < queue.getItemCount(); ++i) {
+		const auto & previous = queue.getSignature(queue.getItem(i - 1).signatureIndex);
+		const auto & current = queue.getSignature(queue.getItem(i).signatureIndex);
+		if(previous[0].state == current[0].state && previous[1].state == current[1].state
+				&& queue.getItem(i - 1).depth > queue.getItem(i).depth) {
+			std::cout << "Items with equal states are not sorted front to back." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	queue.clear();
+	if(!queue.empty() || queue.getSignatureCount() != 0 || queue.countStateTransitions() != 0) {
+		std::cout << "The queue is not empty after clear()." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "done (" << unsortedTransitions << " -> " << sortedTransitions << " state changes).\n";
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,126 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/ListNode.h>
+#include <MinSG/Core/SceneStateBuffer.h>
+#include <MinSG/Helper/Helper.h>
+#include <Geometry/SRT.h>
+#include <Geometry/Vec3.h>
+#include <Util/References.h>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_scene_state_buffer();
+
+int test_scene_state_buffer() {
+	std::cout << "Test SceneStateBuffer ... ";
+
+	Util::Reference<ListNode> root = new ListNode;
+	std::vector<Node *> nodes;
+	for(uint32_t i = 0; i < 64; ++i) {
+		GeometryNode * node = new GeometryNode;
+		root->addChild(node);
+		nodes.push_back(node);
+	}
+
+	SceneStateBuffer buffer;
+
+	// without a running simulation step, the nodes are modified directly
+	SceneStateBuffer::writeRelTransformation(nodes[0], Geometry::SRT(Geometry::Vec3(1, 2, 3), Geometry::Vec3(0, 0, 1), Geometry::Vec3(0, 1, 0)));
+	if(!(nodes[0]->getRelOrigin() == Geometry::Vec3(1, 2, 3)) || buffer.swap() != 0) {
+		std::cout << "A write without a simulation step has to modify the node." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	buffer.track(nodes[0]);
+	{
+		SceneStateBuffer::UpdateScope update(buffer);
+		const Geometry::SRT * srt = buffer.getRelTransformation(nodes[0]);
+		if(srt == nullptr || !(srt->getTranslation() == Geometry::Vec3(1, 2, 3)) || buffer.getRelTransformation(nodes[1]) != nullptr) {
+			std::cout << "The tracked transformation is not available." << std::endl;
+			return EXIT_FAILURE;
+		}
+		SceneStateBuffer::writeRelTransformation(nodes[0], Geometry::SRT());
+		SceneStateBuffer::writeActive(nodes[1], false);
+	}
+	if(!(nodes[0]->getRelOrigin() == Geometry::Vec3(1, 2, 3)) || !nodes[1]->isActive()) {
+		std::cout << "The nodes must not be modified before the swap." << std::endl;
+		return EXIT_FAILURE;
+	}
+	if(buffer.swap() != 2 || !(nodes[0]->getRelOrigin() == Geometry::Vec3(0, 0, 0)) || nodes[1]->isActive()) {
+		std::cout << "The swap has to apply the written states." << std::endl;
+		return EXIT_FAILURE;
+	}
+	nodes[1]->activate();
+
+	// simulation on a worker thread: every step moves all nodes to the same position
+	const uint32_t stepCount = 2000;
+	std::atomic<bool> finished(false);
+	std::thread simulation([&]() {
+		for(uint32_t step = 1; step <= stepCount; ++step) {
+			SceneStateBuffer::UpdateScope update(buffer);
+			for(auto & node : nodes)
+				SceneStateBuffer::writeRelTransformation(node, Geometry::SRT(Geometry::Vec3(static_cast<float>(step), 0, 0), Geometry::Vec3(0, 0, 1), Geometry::Vec3(0, 1, 0)));
+		}
+		finished = true;
+	});
+	uint32_t swaps = 0;
+	bool consistent = true;
+	while(!finished) {
+		if(buffer.swap() > 0)
+			++swaps;
+		// read the world matrices like a renderer does
+		root->getWorldBB();
+		for(auto & node : nodes)
+			consistent = consistent && node->getWorldOrigin() == nodes.front()->getWorldOrigin();
+	}
+	simulation.join();
+	buffer.swap();
+	if(!consistent) {
+		std::cout << "The render thread has seen an incomplete simulation step." << std::endl;
+		return EXIT_FAILURE;
+	}
+	for(auto & node : nodes) {
+		if(!(node->getRelOrigin() == Geometry::Vec3(static_cast<float>(stepCount), 0, 0))) {
+			std::cout << "The last simulation step has not been applied." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	buffer.untrack(nodes[0]);
+	if(buffer.getRelTransformation(nodes[0]) != nullptr) {
+		std::cout << "The node has not been removed from the buffer." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// a destroyed node is removed from the buffer
+	{
+		SceneStateBuffer::UpdateScope update(buffer);
+		SceneStateBuffer::writeRelTransformation(nodes[2], Geometry::SRT());
+		SceneStateBuffer::writeActive(nodes[3], false);
+	}
+	MinSG::destroy(nodes[2]);
+	nodes.erase(nodes.begin() + 2);
+	if(buffer.swap() != 1 || nodes[2]->isActive()) {
+		std::cout << "The states of a destroyed node have not been removed." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	MinSG::destroy(root.get());
+	root = nullptr;
+
+	std::cout << "done (" << swaps << " swaps during " << stepCount << " simulation steps).\n";
+	return EXIT_SUCCESS;
+}
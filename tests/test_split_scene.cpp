@@ -0,0 +1,277 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/ListNode.h>
+#include <MinSG/Helper/Helper.h>
+#include <MinSG/Helper/StdNodeVisitors.h>
+#include <MinSG/SceneManagement/ExportFunctions.h>
+#include <MinSG/SceneManagement/ImportFunctions.h>
+#include <MinSG/SceneManagement/SceneChangeTracker.h>
+#include <MinSG/SceneManagement/SceneManager.h>
+#include <MinSG/SceneManagement/SplitSceneFormat.h>
+#include <Geometry/Box.h>
+#include <Geometry/Vec3.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/MeshUtils/MeshBuilder.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/FileUtils.h>
+#include <Util/IO/TemporaryDirectory.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_split_scene();
+
+//! Return the number of parts whose file differs between both manifests.
+static std::size_t countChangedParts(const SceneManagement::SplitSceneFormat::Manifest & a, const SceneManagement::SplitSceneFormat::Manifest & b) {
+	std::size_t count = 0;
+	for(std::size_t i = 0; i < b.parts.size(); ++i) {
+		if(i >= a.parts.size() || a.parts[i].file != b.parts[i].file)
+			++count;
+	}
+	return count;
+}
+
+//! Return true if the manifest with the given lines after the header is rejected.
+static bool isManifestRejected(const Util::FileName & fileName, const std::string & lines) {
+	{
+		auto out = Util::FileUtils::openForWriting(fileName);
+		*out << SceneManagement::SplitSceneFormat::MAGIC << ' ' << SceneManagement::SplitSceneFormat::VERSION << '\n' << lines;
+	}
+	SceneManagement::SplitSceneFormat::Manifest manifest;
+	return !SceneManagement::SplitSceneFormat::loadManifest(fileName, manifest);
+}
+
+//! Test a scene whose parts are the nodes at depth two.
+static bool testDeepParts(SceneManagement::SceneManager & sceneManager, const Util::FileName & sceneFile, const Rendering::VertexDescription & vertexDesc) {
+	// 4 groups with 5 subgroups of 10 GeometryNodes each
+	Util::Reference<ListNode> root = new ListNode;
+	Util::Reference<Rendering::Mesh> mesh = Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc, Geometry::Box(Geometry::Vec3f(0.0f, 0.0f, 0.0f), 1.0f));
+	for(uint32_t i = 0; i < 4; ++i) {
+		ListNode * group = new ListNode;
+		root->addChild(group);
+		for(uint32_t j = 0; j < 5; ++j) {
+			ListNode * subgroup = new ListNode;
+			subgroup->moveRel(Geometry::Vec3(0, static_cast<float>(j), 0));
+			group->addChild(subgroup);
+			for(uint32_t k = 0; k < 10; ++k)
+				subgroup->addChild(new GeometryNode(mesh));
+		}
+	}
+	const auto groups = getChildNodes(root.get());
+	{
+		SceneManagement::SceneChangeTracker tracker(root.get(), 2);
+		const auto subtrees = tracker.collectSubtrees();
+		if(subtrees.size() != 20 || subtrees[7] != getChildNodes(groups[1])[2]) {
+			std::cout << "Wrong subtrees at depth two." << std::endl;
+			return false;
+		}
+		SceneManagement::saveMinSGSplitScene(sceneManager, sceneFile, tracker);
+		SceneManagement::SplitSceneFormat::Manifest manifest;
+		if(!SceneManagement::SplitSceneFormat::loadManifest(sceneFile, manifest) || manifest.partDepth != 2 || manifest.parts.size() != 20 ||
+				manifest.parts[7].path != std::vector<uint32_t>{1, 2}) {
+			std::cout << "Invalid manifest of a scene with parts at depth two." << std::endl;
+			return false;
+		}
+
+		// only the subgroup containing the transformed node is changed
+		getChildNodes(subtrees[7]).front()->moveRel(Geometry::Vec3(0, 0, 3.0f));
+		const auto changedSubtrees = tracker.collectChangedSubtrees();
+		if(changedSubtrees.size() != 1 || changedSubtrees.front() != subtrees[7] || tracker.isRootChanged()) {
+			std::cout << "Wrong changed subtree at depth two." << std::endl;
+			return false;
+		}
+		// a group above the part depth belongs to the root part
+		groups[2]->moveRel(Geometry::Vec3(5.0f, 0, 0));
+		if(tracker.collectChangedSubtrees().size() != 1 || !tracker.isRootChanged()) {
+			std::cout << "The root part has not been changed by a node above the part depth." << std::endl;
+			return false;
+		}
+		SceneManagement::saveMinSGSplitScene(sceneManager, sceneFile, tracker);
+		SceneManagement::SplitSceneFormat::Manifest newManifest;
+		if(!SceneManagement::SplitSceneFormat::loadManifest(sceneFile, newManifest) || countChangedParts(manifest, newManifest) != 1 ||
+				newManifest.rootFile == manifest.rootFile) {
+			std::cout << "Only the changed subtree at depth two has to be written." << std::endl;
+			return false;
+		}
+	}
+	if(root->isTransformationObserved()) {
+		std::cout << "The observers of the tracker have not been removed." << std::endl;
+		return false;
+	}
+
+	Util::Reference<GroupNode> loadedRoot = SceneManagement::loadMinSGSplitScene(sceneManager, sceneFile);
+	if(loadedRoot.isNull()) {
+		std::cout << "Loading the split scene with parts at depth two failed." << std::endl;
+		return false;
+	}
+	const auto loadedGroups = getChildNodes(loadedRoot.get());
+	if(loadedGroups.size() != 4 || collectNodes<GeometryNode>(loadedRoot.get()).size() != 200 ||
+			!(loadedGroups[2]->getRelTransformationMatrix() == groups[2]->getRelTransformationMatrix()) ||
+			!(getChildNodes(loadedGroups[1])[2]->getRelTransformationMatrix() == getChildNodes(groups[1])[2]->getRelTransformationMatrix()) ||
+			!(getChildNodes(getChildNodes(loadedGroups[1])[2]).front()->getRelTransformationMatrix() == getChildNodes(getChildNodes(groups[1])[2]).front()->getRelTransformationMatrix())) {
+		std::cout << "The loaded split scene with parts at depth two differs from the saved scene." << std::endl;
+		return false;
+	}
+	MinSG::destroy(loadedRoot.get());
+	MinSG::destroy(root.get());
+	return true;
+}
+
+int test_split_scene() {
+	std::cout << "Test incremental split MinSG scene export ... ";
+
+	Util::TemporaryDirectory tempDir("MinSGTest_SplitScene");
+	Util::FileName sceneFile = tempDir.getPath();
+	sceneFile.setFile("test_split_scene.minsgs");
+
+	SceneManagement::SceneManager sceneManager;
+
+	Rendering::VertexDescription vertexDesc;
+	vertexDesc.appendPosition3D();
+	vertexDesc.appendNormalFloat();
+
+	// 20 subtrees with 50 GeometryNodes each
+	Util::Reference<ListNode> root = new ListNode;
+	root->moveRel(Geometry::Vec3(1.0f, 2.0f, 3.0f));
+	for(uint32_t i = 0; i < 20; ++i) {
+		ListNode * group = new ListNode;
+		group->moveRel(Geometry::Vec3(static_cast<float>(i) * 10.0f, 0, 0));
+		root->addChild(group);
+		for(uint32_t j = 0; j < 50; ++j) {
+			GeometryNode * geoNode = new GeometryNode(Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc,
+					Geometry::Box(Geometry::Vec3f(0.0f, 0.0f, 0.0f), static_cast<float>(j + 1))));
+			geoNode->moveRel(Geometry::Vec3(0, static_cast<float>(j), 0));
+			group->addChild(geoNode);
+		}
+	}
+
+	SceneManagement::SceneChangeTracker tracker(root.get());
+	if(tracker.collectChangedSubtrees().size() != 20 || !tracker.isRootChanged()) {
+		std::cout << "A new tracker has to report the whole scene as changed." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// ----- initial export -----
+	Util::Timer timer;
+	timer.reset();
+	SceneManagement::saveMinSGSplitScene(sceneManager, sceneFile, tracker);
+	const double fullTime = timer.getMilliseconds();
+	SceneManagement::SplitSceneFormat::Manifest manifest;
+	if(!SceneManagement::SplitSceneFormat::loadManifest(sceneFile, manifest) || manifest.parts.size() != 20) {
+		std::cout << "Invalid manifest." << std::endl;
+		return EXIT_FAILURE;
+	}
+	if(!tracker.collectChangedSubtrees().empty() || tracker.isRootChanged()) {
+		std::cout << "The tracker has not been cleared." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// ----- transformation, added node, changed mesh -----
+	const auto groups = getChildNodes(root.get());
+	getChildNodes(groups[3]).back()->moveRel(Geometry::Vec3(0, 0, 5.0f));
+	static_cast<GroupNode *>(groups[7])->addChild(new GeometryNode(Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc,
+			Geometry::Box(Geometry::Vec3f(0.0f, 0.0f, 0.0f), 100.0f))));
+	tracker.markChanged(static_cast<GeometryNode *>(getChildNodes(groups[11]).front())->getMesh());
+	const auto changedSubtrees = tracker.collectChangedSubtrees();
+	if(changedSubtrees.size() != 3 || changedSubtrees[0] != groups[3] || changedSubtrees[1] != groups[7] || changedSubtrees[2] != groups[11] ||
+			tracker.isRootChanged()) {
+		std::cout << "Wrong changed subtrees." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	timer.reset();
+	SceneManagement::saveMinSGSplitScene(sceneManager, sceneFile, tracker);
+	const double incrementalTime = timer.getMilliseconds();
+	SceneManagement::SplitSceneFormat::Manifest newManifest;
+	if(!SceneManagement::SplitSceneFormat::loadManifest(sceneFile, newManifest) || countChangedParts(manifest, newManifest) != 3 ||
+			newManifest.rootFile != manifest.rootFile) {
+		std::cout << "Only the changed subtrees have to be written." << std::endl;
+		return EXIT_FAILURE;
+	}
+	Util::FileName oldPartFile(sceneFile);
+	oldPartFile.setFile(manifest.parts[3].file);
+	if(Util::FileUtils::isFile(oldPartFile)) {
+		std::cout << "Obsolete part file has not been removed." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// ----- removed subtree, transformed root -----
+	root->removeChild(groups[0]);
+	root->moveRel(Geometry::Vec3(0, 1.0f, 0));
+	if(!tracker.collectChangedSubtrees().empty() || !tracker.isRootChanged()) {
+		std::cout << "Wrong changes after removing a subtree." << std::endl;
+		return EXIT_FAILURE;
+	}
+	SceneManagement::saveMinSGSplitScene(sceneManager, sceneFile, tracker);
+	manifest = newManifest;
+	if(!SceneManagement::SplitSceneFormat::loadManifest(sceneFile, newManifest) || newManifest.parts.size() != 19 ||
+			newManifest.rootFile == manifest.rootFile) {
+		std::cout << "Wrong manifest after removing a subtree." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// ----- import -----
+	Util::Reference<GroupNode> loadedRoot = SceneManagement::loadMinSGSplitScene(sceneManager, sceneFile);
+	if(loadedRoot.isNull() || !(loadedRoot->getRelTransformationMatrix() == root->getRelTransformationMatrix())) {
+		std::cout << "Loading the split scene failed." << std::endl;
+		return EXIT_FAILURE;
+	}
+	const auto loadedGroups = getChildNodes(loadedRoot.get());
+	if(loadedGroups.size() != 19 || collectNodes<GeometryNode>(loadedRoot.get()).size() != 19 * 50 + 1 ||
+			!(getChildNodes(loadedGroups[2]).back()->getRelTransformationMatrix() == getChildNodes(groups[3]).back()->getRelTransformationMatrix())) {
+		std::cout << "The loaded split scene differs from the saved scene." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// a loaded scene keeps its part files
+	{
+		SceneManagement::SceneChangeTracker loadedTracker(loadedRoot.get());
+		loadedTracker.clear();
+		loadedGroups[5]->moveRel(Geometry::Vec3(0, 0, 1.0f));
+		SceneManagement::saveMinSGSplitScene(sceneManager, sceneFile, loadedTracker);
+		manifest = newManifest;
+		if(!SceneManagement::SplitSceneFormat::loadManifest(sceneFile, newManifest) || countChangedParts(manifest, newManifest) != 1) {
+			std::cout << "Only the changed subtree of the loaded scene has to be written." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	if(loadedRoot->isTransformationObserved()) {
+		std::cout << "The observers of the tracker have not been removed." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	MinSG::destroy(loadedRoot.get());
+	MinSG::destroy(root.get());
+
+	Util::FileName deepSceneFile = tempDir.getPath();
+	deepSceneFile.setFile("test_split_scene_deep.minsgs");
+	if(!testDeepParts(sceneManager, deepSceneFile, vertexDesc))
+		return EXIT_FAILURE;
+
+	// invalid manifests
+	Util::FileName invalidFile = tempDir.getPath();
+	invalidFile.setFile("test_split_scene_invalid.minsgs");
+	if(!isManifestRejected(invalidFile, "next x\nroot a.root.minsg\n") || !isManifestRejected(invalidFile, "next 99999999999\nroot a.root.minsg\n") ||
+			!isManifestRejected(invalidFile, "root a.root.minsg\npart 1/x a.0.msgb\n") || !isManifestRejected(invalidFile, "root a.root.minsg\npart a.0.msgb\n") ||
+			!isManifestRejected(invalidFile, "depth 2\nroot a.root.minsg\npart 1 a.0.msgb\n") || isManifestRejected(invalidFile, "next 1\nroot a.root.minsg\npart 0 a 0.msgb\n")) {
+		std::cout << "Wrong handling of invalid manifests." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "done (full save: " << fullTime << " ms, incremental save: " << incrementalTime << " ms).\n";
+	return EXIT_SUCCESS;
+}
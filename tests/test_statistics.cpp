@@ -12,7 +12,13 @@
 #include <Util/StringIdentifier.h>
 #include <Util/Timer.h>
 #include <cstdint>
+#include <cstdlib>
 #include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 // Prevent warning
 int test_statistics();
@@ -44,7 +50,88 @@ void testProfiler(uint32_t numEventTypes, uint32_t numEventsOverall) {
 	}
 }
 
+static bool testThreadShards() {
+	MinSG::Statistics stats;
+	const uint32_t counter = stats.addCounter("Test", "1");
+	stats.beginFrame();
+	std::vector<std::thread> threads;
+	for(uint32_t t = 0; t < 4; ++t) {
+		threads.emplace_back([&stats, counter]() {
+			for(uint32_t i = 0; i < 1000; ++i)
+				stats.addValueFromThread(counter, 1.0);
+		});
+	}
+	for(auto & thread : threads)
+		thread.join();
+	stats.addValue(counter, 1.0);
+	stats.endFrame();
+	if(stats.getValueAsInt(counter) != 4001)
+		return false;
+	// merged values are not added again
+	stats.beginFrame();
+	stats.endFrame();
+	return stats.getValueAsInt(counter) == 0;
+}
+
+static bool testPercentiles() {
+	MinSG::Statistics stats;
+	const uint32_t counter = stats.addCounter("Test", "1");
+	if(!stats.isHistoryEnabled(stats.getFrameDurationCounter()) || stats.getPercentile(counter, 50) != 0.0)
+		return false;
+	stats.enableHistory(counter, 100);
+	for(uint32_t frame = 1; frame <= 150; ++frame) {
+		stats.beginFrame();
+		stats.setValue(counter, static_cast<double>(frame));
+		stats.endFrame();
+	}
+	// the history contains the values of the frames 51 to 150
+	return stats.getHistorySize(counter) == 100 && stats.getPercentile(counter, 0) == 51.0 &&
+			stats.getPercentile(counter, 50) == 100.0 && stats.getPercentile(counter, 95) == 145.0 &&
+			stats.getPercentile(counter, 99) == 149.0 && stats.getPercentile(counter, 100) == 150.0;
+}
+
+static bool testEventRingBuffer() {
+	MinSG::Statistics stats;
+	stats.enableEvents();
+	stats.setEventCapacity(16);
+	for(uint32_t i = 0; i < 40; ++i)
+		stats.pushEvent(MinSG::Statistics::EVENT_TYPE_GEOMETRY, static_cast<double>(i));
+	if(stats.getNumEvents() != 16 || stats.getNumDroppedEvents() != 24 || stats.getEvent(0).value != 24.0 || stats.getEvent(15).value != 39.0)
+		return false;
+
+	std::stringstream stream;
+	stats.writeEvents(stream);
+	const auto events = MinSG::Statistics::readEvents(stream);
+	if(events.size() != stats.getNumEvents())
+		return false;
+	for(std::size_t i = 0; i < events.size(); ++i) {
+		if(!(events[i] == stats.getEvent(i)))
+			return false;
+	}
+
+	std::stringstream invalid("MSGX");
+	try {
+		MinSG::Statistics::readEvents(invalid);
+		return false;
+	} catch(const std::runtime_error &) {
+	}
+	return true;
+}
+
 int test_statistics() {
+	if(!testThreadShards()) {
+		std::cout << "The values of the thread shards have not been merged correctly." << std::endl;
+		return EXIT_FAILURE;
+	}
+	if(!testPercentiles()) {
+		std::cout << "Wrong percentiles." << std::endl;
+		return EXIT_FAILURE;
+	}
+	if(!testEventRingBuffer()) {
+		std::cout << "Wrong events in the ring buffer." << std::endl;
+		return EXIT_FAILURE;
+	}
+
 	std::ofstream output("test_statistics.tsv");
 	output << "class\tnumEventTypes\tnumEventsOverall\tduration\n";
 	Util::Timer timer;
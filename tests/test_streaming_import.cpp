@@ -0,0 +1,175 @@
+/*
+	This file is part of the MinSG library.
+	Copyright (C) 2026 Sascha Brandt <sascha@brandt.graphics>
+
+	This library is subject to the terms of the Mozilla Public License, v. 2.0.
+	You should have received a copy of the MPL along with this library; see the
+	file LICENSE. If not, you can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <MinSG/Core/Nodes/GeometryNode.h>
+#include <MinSG/Core/Nodes/ListNode.h>
+#include <MinSG/Ext/ValuatedRegion/ValuatedRegionNode.h>
+#include <MinSG/Helper/Helper.h>
+#include <MinSG/Helper/StdNodeVisitors.h>
+#include <MinSG/SceneManagement/ExportFunctions.h>
+#include <MinSG/SceneManagement/ImportFunctions.h>
+#include <MinSG/SceneManagement/SceneManager.h>
+#include <Geometry/Angle.h>
+#include <Geometry/Box.h>
+#include <Geometry/Vec3.h>
+#include <Rendering/Mesh/Mesh.h>
+#include <Rendering/Mesh/VertexDescription.h>
+#include <Rendering/MeshUtils/MeshBuilder.h>
+#include <Util/IO/FileName.h>
+#include <Util/IO/TemporaryDirectory.h>
+#include <Util/References.h>
+#include <Util/Timer.h>
+#include <Util/Utils.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace MinSG;
+
+// Prevent warning
+int test_streaming_import();
+
+//! Return true if both subtrees have the same structure, transformations and mesh sizes.
+static bool equalSubtrees(Node * a, Node * b) {
+	if(std::string(a->getTypeName()) != b->getTypeName() || !(a->getRelTransformationMatrix() == b->getRelTransformationMatrix()))
+		return false;
+	auto geoNodeA = dynamic_cast<GeometryNode *>(a);
+	auto geoNodeB = dynamic_cast<GeometryNode *>(b);
+	if(geoNodeA != nullptr) {
+		if(geoNodeA->getMesh() == nullptr || geoNodeB->getMesh() == nullptr ||
+				geoNodeA->getMesh()->getVertexCount() != geoNodeB->getMesh()->getVertexCount())
+			return false;
+	}
+	const auto childrenA = getChildNodes(a);
+	const auto childrenB = getChildNodes(b);
+	if(childrenA.size() != childrenB.size())
+		return false;
+	for(std::size_t i = 0; i < childrenA.size(); ++i) {
+		if(!equalSubtrees(childrenA[i], childrenB[i]))
+			return false;
+	}
+	return true;
+}
+
+/*! Call @p function and return the peak increase of the resident set size in bytes during the call.
+	The resident set size is sampled by a second thread every millisecond.	*/
+static double measurePeakMemory(const std::function<void ()> & function) {
+	const double memoryBefore = Util::Utils::getResidentSetMemorySize();
+	std::atomic<bool> finished(false);
+	double peakMemory = memoryBefore;
+	std::thread sampler([&finished, &peakMemory]() {
+		while(!finished) {
+			peakMemory = std::max(peakMemory, static_cast<double>(Util::Utils::getResidentSetMemorySize()));
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	});
+	function();
+	finished = true;
+	sampler.join();
+	peakMemory = std::max(peakMemory, static_cast<double>(Util::Utils::getResidentSetMemorySize()));
+	return peakMemory - memoryBefore;
+}
+
+int test_streaming_import() {
+	std::cout << "Test streaming MinSG scene import ... ";
+
+	Util::TemporaryDirectory tempDir("MinSGTest_StreamingImport");
+	Util::FileName sceneFile = tempDir.getPath();
+	sceneFile.setFile("test_streaming_import.minsg");
+
+	SceneManagement::SceneManager sceneManager;
+
+	Rendering::VertexDescription vertexDesc;
+	vertexDesc.appendPosition3D();
+	vertexDesc.appendNormalFloat();
+
+	// ----- EXPORT -----
+	// three levels of list nodes; the geometry nodes are mixed with the inner list nodes
+	{
+		Util::Reference<ListNode> root = new ListNode;
+		{	// a tree of GroupNodes that are no list nodes
+			ValuatedRegionNode * region = new ValuatedRegionNode(Geometry::Box(0, 10, 0, 10, 0, 10), Geometry::Vec3i(10, 1, 1));
+			root->addChild(region);
+			for(uint32_t i = 0; i < 10; ++i) {
+				ValuatedRegionNode * subRegion = new ValuatedRegionNode(Geometry::Box(i, i + 1, 0, 10, 0, 10), Geometry::Vec3i(1, 10, 1));
+				region->addChild(subRegion);
+				for(uint32_t j = 0; j < 10; ++j)
+					subRegion->addChild(new ValuatedRegionNode(Geometry::Box(i, i + 1, j, j + 1, 0, 10), Geometry::Vec3i(1, 1, 1)));
+			}
+		}
+		for(uint32_t i = 0; i < 10; ++i) {
+			ListNode * group = new ListNode;
+			group->moveRel(Geometry::Vec3(static_cast<float>(i) * 10.0f, 0, 0));
+			group->rotateLocal(Geometry::Angle::deg(static_cast<float>(i) * 30.0f), Geometry::Vec3(0, 1, 0));
+			group->setRelScaling(0.5f + static_cast<float>(i));
+			root->addChild(group);
+			for(uint32_t j = 0; j < 10; ++j) {
+				ListNode * subGroup = new ListNode;
+				subGroup->moveRel(Geometry::Vec3(0, static_cast<float>(j), 0));
+				group->addChild(subGroup);
+				group->addChild(new GeometryNode(Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc,
+						Geometry::Box(Geometry::Vec3f(0.0f, 0.0f, 0.0f), static_cast<float>(j + 1)))));
+				for(uint32_t k = 0; k < 10; ++k) {
+					GeometryNode * geoNode = new GeometryNode(Rendering::MeshUtils::MeshBuilder::createBox(vertexDesc,
+							Geometry::Box(Geometry::Vec3f(0.0f, 0.0f, 0.0f), 1.0f)));
+					geoNode->moveRel(Geometry::Vec3(0, 0, static_cast<float>(k)));
+					subGroup->addChild(geoNode);
+				}
+			}
+		}
+		std::deque<Node *> nodes;
+		nodes.push_back(root.get());
+		SceneManagement::saveMinSGFile(sceneManager, sceneFile, nodes);
+		MinSG::destroy(root.get());
+	}
+
+	// ----- IMPORT -----
+	/* The streamed import is measured first, so that it cannot reuse the memory released after the import
+		with the description of the whole scene. The memory includes the imported nodes and meshes. */
+	Util::Timer timer;
+	std::vector<Util::Reference<Node>> streamedNodes;
+	timer.reset();
+	const double streamingMemory = measurePeakMemory([&]() {
+		streamedNodes = SceneManagement::loadMinSGFile(sceneManager, sceneFile, SceneManagement::IMPORT_OPTION_STREAMING);
+	});
+	const double streamingTime = timer.getMilliseconds();
+	std::vector<Util::Reference<Node>> nodes;
+	timer.reset();
+	const double descriptionMemory = measurePeakMemory([&]() {
+		nodes = SceneManagement::loadMinSGFile(sceneManager, sceneFile);
+	});
+	const double descriptionTime = timer.getMilliseconds();
+
+	if(nodes.size() != 1 || streamedNodes.size() != 1) {
+		std::cout << "Wrong number of loaded nodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	if(collectNodes<GeometryNode>(streamedNodes.front().get()).size() != 1100 ||
+			collectNodes<ValuatedRegionNode>(streamedNodes.front().get()).size() != 111) {
+		std::cout << "Wrong number of GeometryNodes or ValuatedRegionNodes." << std::endl;
+		return EXIT_FAILURE;
+	}
+	if(!equalSubtrees(nodes.front().get(), streamedNodes.front().get())) {
+		std::cout << "The streamed scene differs from the imported scene." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	MinSG::destroy(nodes.front().get());
+	MinSG::destroy(streamedNodes.front().get());
+
+	std::cout << "done (description: " << descriptionTime << " ms, " << descriptionMemory / 1024.0 / 1024.0 << " MiB peak; "
+				<< "streaming: " << streamingTime << " ms, " << streamingMemory / 1024.0 / 1024.0 << " MiB peak).\n";
+	return EXIT_SUCCESS;
+}